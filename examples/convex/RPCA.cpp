@@ -9,13 +9,8 @@
 // NOTE: It is possible to simply include "elemental.hpp" instead
 #include "elemental-lite.hpp"
 #include "elemental/blas-like/level1/Axpy.hpp"
-#include "elemental/blas-like/level1/Scale.hpp"
 #include "elemental/lapack-like/Norm/Frobenius.hpp"
-#include "elemental/lapack-like/Norm/EntrywiseOne.hpp"
-#include "elemental/lapack-like/Norm/Max.hpp"
-#include "elemental/lapack-like/Norm/Two.hpp"
-#include "elemental/lapack-like/Norm/Zero.hpp"
-#include "elemental/convex/SingularValueSoftThreshold.hpp"
+#include "elemental/convex/RPCA.hpp"
 #include "elemental/matrices/Uniform.hpp"
 using namespace elem;
 
@@ -64,244 +59,6 @@ int Corrupt( DistMatrix<F>& A, double probCorrupt )
     return numCorrupt;
 }
 
-template<typename F,Distribution U,Distribution V>
-void Sign( DistMatrix<F,U,V>& A )
-{
-    const int localHeight = A.LocalHeight();
-    const int localWidth = A.LocalWidth();
-    for( int jLocal=0; jLocal<localWidth; ++jLocal )
-    {
-        for( int iLocal=0; iLocal<localHeight; ++iLocal )
-        {
-            const F alpha = A.GetLocal( iLocal, jLocal );
-            A.SetLocal( iLocal, jLocal, alpha/Abs(alpha) );
-        }
-    }
-}
-
-// If 'tau' is passed in as zero, it is set to 1/sqrt(max(m,n))
-template<typename F>
-void RPCA_ADMM
-( const DistMatrix<F>& M, DistMatrix<F>& L, DistMatrix<F>& S, 
-  typename Base<F>::type beta, 
-  typename Base<F>::type tau, 
-  typename Base<F>::type tol, 
-  int maxIts,
-  bool print )
-{
-    typedef typename Base<F>::type R;
-    const int m = M.Height();
-    const int n = M.Width();
-    const int commRank = mpi::CommRank( M.Grid().Comm() );
-
-    // If tau is not specified, then set it to 1/sqrt(max(m,n))
-    if( tau == R(0) )
-        tau = R(1)/sqrt(R(std::max(m,n)));
-
-    if( beta <= R(0) )
-        throw std::logic_error("beta cannot be non-positive");
-    if( tau <=  R(0) )
-        throw std::logic_error("tau cannot be non-positive");
-    if( tol <= R(0) )
-        throw std::logic_error("tol cannot be non-positive");
-
-    DistMatrix<F> E( M.Grid() ), Y( M.Grid() );
-    Zeros( m, n, Y );
-
-    const R frobM = FrobeniusNorm( M );
-    if( commRank == 0 )
-        std::cout << "|| M ||_F = " << frobM << std::endl;
-
-    int numIts = 0;
-    while( true )
-    {
-        ++numIts;
-
-        // ST_{tau/beta}(M - L + Y/beta)
-        S = M;
-        Axpy( F(-1), L, S );
-        Axpy( F(1)/beta, Y, S );
-        SoftThreshold( S, tau/beta );
-        const int numNonzeros = ZeroNorm( S );
-
-        // SVT_{1/beta}(M - S + Y/beta)
-        L = M;
-        Axpy( F(-1), S, L );
-        Axpy( F(1)/beta, Y, L );
-        const int rank = SingularValueSoftThreshold( L, R(1)/beta );
-      
-        // E := M - (L + S)
-        E = M;    
-        Axpy( F(-1), L, E );
-        Axpy( F(-1), S, E );
-        const R frobE = FrobeniusNorm( E );
-
-        if( frobE/frobM <= tol )            
-        {
-            if( commRank == 0 )
-                std::cout << "Converged after " << numIts << " iterations "
-                          << " with rank=" << rank 
-                          << ", numNonzeros=" << numNonzeros << " and "
-                          << "|| E ||_F / || M ||_F = " << frobE/frobM
-                          << std::endl;
-            break;
-        }
-        else if( numIts >= maxIts )
-        {
-            if( commRank == 0 )
-                std::cout << "Aborting after " << maxIts << " iterations"
-                          << std::endl;
-            break;
-        }
-        else
-        {
-            if( commRank == 0 )
-                std::cout << numIts << ": || E ||_F / || M ||_F = " 
-                          << frobE/frobM << ", rank=" << rank 
-                          << ", numNonzeros=" << numNonzeros << std::endl;
-        }
-        
-        // Y := Y + beta E
-        Axpy( beta, E, Y );
-    }
-}
-
-// If 'beta' or 'tau' is passed in as zero, then an estimate is used instead
-template<typename F>
-void RPCA_ALM
-( const DistMatrix<F>& M, DistMatrix<F>& L, DistMatrix<F>& S, 
-  typename Base<F>::type beta, 
-  typename Base<F>::type tau, 
-  typename Base<F>::type rho,
-  typename Base<F>::type tol, 
-  int maxIts,
-  bool print )
-{
-    typedef typename Base<F>::type R;
-
-    const int m = M.Height();
-    const int n = M.Width();
-    const int commRank = mpi::CommRank( M.Grid().Comm() );
-
-    // If tau is unspecified, set it to 1/sqrt(max(m,n))
-    if( tau == R(0) )
-        tau = R(1) / sqrt(R(std::max(m,n)));
-
-    if( tol <= R(0) )
-        throw std::logic_error("tol cannot be non-positive");
-    if( tau <= R(0) )
-        throw std::logic_error("tau cannot be non-positive");
-
-    DistMatrix<F> Y( M );
-    Sign( Y );
-    const R twoNorm = TwoNorm( Y );
-    const R maxNorm = MaxNorm( Y );
-    const R infNorm = maxNorm / tau; 
-    const R dualNorm = std::max( twoNorm, infNorm );
-    Scale( F(1)/dualNorm, Y );
-
-    // If beta is unspecified, set it to 1 / 2 || sign(M) ||_2
-    if( beta == R(0) )
-        beta = R(1) / (2*twoNorm);
-
-    if( beta <= R(0) )
-        throw std::logic_error("beta cannot be non-positive");
-
-    const R frobM = FrobeniusNorm( M );
-    if( commRank == 0 )
-        std::cout << "|| M ||_F = " << frobM << std::endl;
-
-    int numIts=0, numPrimalIts=0;
-    DistMatrix<F> LLast( M.Grid() ), SLast( M.Grid() ), E( M.Grid() );
-    while( true )
-    {
-        ++numIts;
-       
-        int rank, numNonzeros;
-        while( true )
-        {
-            ++numPrimalIts;
-
-            LLast = L;
-            SLast = S;
-
-            // ST_{tau/beta}(M - L + Y/beta)
-            S = M;
-            Axpy( F(-1), L, S );
-            Axpy( F(1)/beta, Y, S );
-            SoftThreshold( S, tau/beta );
-            numNonzeros = ZeroNorm( S );
-
-            // SVT_{1/beta}(M - S + Y/beta)
-            L = M;
-            Axpy( F(-1), S, L );
-            Axpy( F(1)/beta, Y, L );
-            if( commRank == 0 )
-                std::cout << "beta=" << beta << std::endl;
-            rank = SingularValueSoftThreshold( L, R(1)/beta );
-
-            Axpy( F(-1), L, LLast );
-            Axpy( F(-1), S, SLast );
-            const R frobLDiff = FrobeniusNorm( LLast );
-            const R frobSDiff = FrobeniusNorm( SLast );
-
-            if( frobLDiff/frobM < tol && frobSDiff/frobM < tol )
-            {
-                if( commRank == 0 )
-                    std::cout << "Primal loop converged" << std::endl;
-                break;
-            }
-            else 
-            {
-                if( commRank == 0 )
-                    std::cout << "  " << numPrimalIts 
-                              << ": \n"
-                              << "   || Delta L ||_F / || M ||_F = " 
-                              << frobLDiff/frobM << "\n"
-                              << "   || Delta S ||_F / || M ||_F = "
-                              << frobSDiff/frobM << "\n"
-                              << "   rank=" << rank
-                              << ", numNonzeros=" << numNonzeros << std::endl;
-            } 
-        }
-
-        // E := M - (L + S)
-        E = M;    
-        Axpy( -1., L, E );
-        Axpy( -1., S, E );
-        const R frobE = FrobeniusNorm( E );
-
-        if( frobE/frobM <= tol )            
-        {
-            if( commRank == 0 )
-                std::cout << "Converged after " << numIts << " iterations and "
-                          << numPrimalIts << " primal iterations with rank=" 
-                          << rank << ", numNonzeros=" << numNonzeros << " and "
-                          << "|| E ||_F / || M ||_F = " << frobE/frobM
-                          << std::endl;
-            break;
-        }
-        else if( numIts >= maxIts )
-        {
-            if( commRank == 0 )
-                std::cout << "Aborting after " << maxIts << " iterations"
-                          << std::endl;
-            break;
-        }
-        else
-        {
-            if( commRank == 0 )
-                std::cout << numPrimalIts << ": || E ||_F / || M ||_F = " 
-                          << frobE/frobM << ", rank=" << rank 
-                          << ", numNonzeros=" << numNonzeros << std::endl;
-        }
-        
-        // Y := Y + beta E
-        Axpy( beta, E, Y );
-        beta *= rho;
-    }
-}
-
 int 
 main( int argc, char* argv[] )
 {
@@ -324,6 +81,8 @@ main( int argc, char* argv[] )
         const int maxIts = Input("--maxIts","maximum iterations",1000);
         const double tol = Input("--tol","tolerance",1.e-6);
         const bool useALM = Input("--useALM","use ALM algorithm?",true);
+        const bool lowRankSVT = 
+            Input("--lowRankSVT","use low-rank SVT?",true);
         const bool print = Input("--print","print matrices",false);
         ProcessInput();
         PrintInputReport();
@@ -356,14 +115,36 @@ main( int argc, char* argv[] )
         DistMatrix<C> M( LTrue );
         Axpy( C(1), STrue, M );
 
-        DistMatrix<C> L, S;
-        Zeros( m, n, L );
-        Zeros( m, n, S ); 
+        RPCACtrl<double> ctrl;
+        ctrl.approach = ( useALM ? RPCA_ALM : RPCA_ADMM );
+        ctrl.beta = beta;
+        ctrl.tau = tau;
+        ctrl.rho = rho;
+        ctrl.tol = tol;
+        ctrl.maxIts = maxIts;
+        ctrl.lowRankSVT = lowRankSVT;
+        ctrl.progress = true;
 
-        if( useALM )
-            RPCA_ALM( M, L, S, beta, tau, rho, tol, maxIts, print );
-        else
-            RPCA_ADMM( M, L, S, beta, tau, tol, maxIts, print );
+        DistMatrix<C> L, S;
+        const RPCAInfo<double> info = RPCA( M, L, S, ctrl );
+        double shrinkTime=0, svtTime=0, updateTime=0;
+        for( int it=0; it<info.numPrimalIts; ++it )
+        {
+            shrinkTime += info.shrinkTimes[it];
+            svtTime += info.svtTimes[it];
+            updateTime += info.updateTimes[it];
+        }
+        if( commRank == 0 )
+            std::cout << ( info.converged ? "Converged" : "Aborted" ) 
+                      << " after " << info.numIts << " iterations and "
+                      << info.numPrimalIts << " primal iterations with rank="
+                      << info.rank << ", numNonzeros=" << info.numNonzeros 
+                      << " and || E ||_F / || M ||_F = " 
+                      << info.residuals.back() << "\n"
+                      << "Time in shrinkage: " << shrinkTime << " secs\n"
+                      << "Time in SVT:       " << svtTime << " secs\n"
+                      << "Time in updates:   " << updateTime << " secs" 
+                      << std::endl;
 
         if( print )
         {
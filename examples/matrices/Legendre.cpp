@@ -30,12 +30,11 @@ main( int argc, char* argv[] )
         DistMatrix<double> J;
         Legendre( n, J );
 
-#ifndef HAVE_PMRRR
         if( print )
             J.Print("Jacobi matrix for Legendre polynomials");
-#else
+
         // This will perform a lot of unnecessary work, but the code is simpler
-        // than directly calling PMRRR
+        // than directly calling HermitianTridiagEig
         //
         // We will compute Gaussian quadrature points and weights over [-1,+1]
         // using the eigenvalue decomposition of the Jacobi matrix for the 
@@ -57,7 +56,6 @@ main( int argc, char* argv[] )
         }
         if( print )
             weights.Print("weights");
-#endif
     }
     catch( ArgException& e )
     {
@@ -75,7 +75,6 @@ main( int argc, char* argv[] )
             AEven.Print("AEven");
             AOdd.Print("AOdd");
         }
-#ifdef HAVE_PMRRR
         DistMatrix<double,VR,STAR> wEven, wOdd;
         DistMatrix<double> XEven, XOdd;
         HermitianEig( LOWER, AEven, wEven, XEven );
@@ -89,7 +88,6 @@ main( int argc, char* argv[] )
             wEven.Print("wEven");
             wOdd.Print("wOdd");
         }
-#endif
     }
     catch( ArgException& e )
     {
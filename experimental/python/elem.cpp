@@ -0,0 +1,1593 @@
+/*
+   Copyright (c) 2011-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// A CPython extension module which wraps Matrix and DistMatrix for each of
+// the integral, single, double, single-complex, and double-complex scalar
+// types. The local entries of both are exported through the buffer protocol
+// as two-dimensional column-major arrays whose column stride is the leading
+// dimension, so that, for example,
+//
+//     A = elem.DistMatrix('D')
+//     elem.Uniform( A, 100, 100 )
+//     ALocal = numpy.asarray( A )
+//
+// views the local matrix of A without copying it. Every routine which
+// computes or communicates releases the GIL while it runs.
+//
+// Routines which may reallocate a matrix (Resize, Uniform, ExplicitQR, and
+// SVD) raise BufferError while any view of its entries is alive.
+#include "Python.h"
+#include "elemental.hpp"
+using namespace elem;
+
+// Single characters are bytes in Python 2 and strings in Python 3
+#if PY_MAJOR_VERSION >= 3
+# define CHAR_FORMAT "C"
+typedef int CharArg;
+#else
+# define CHAR_FORMAT "c"
+typedef char CharArg;
+#endif
+
+namespace {
+
+//
+// Scalar conversion
+//
+
+struct ScalarInfo
+{
+    char code;
+    ScalarTypes type;
+    const char* format;
+};
+
+const ScalarInfo scalarInfos[] =
+{
+    { 'i', INTEGRAL, "i"  },
+    { 'f', SINGLE,   "f"  },
+    { 'd', DOUBLE,   "d"  },
+    { 'F', SCOMPLEX, "Zf" },
+    { 'D', DCOMPLEX, "Zd" }
+};
+const int numScalarInfos = sizeof(scalarInfos)/sizeof(ScalarInfo);
+
+const ScalarInfo*
+InfoOf( ScalarTypes type )
+{
+    for( int k=0; k<numScalarInfos; ++k )
+        if( scalarInfos[k].type == type )
+            return &scalarInfos[k];
+    return 0;
+}
+
+bool
+CodeToScalarType( char code, ScalarTypes& type )
+{
+    for( int k=0; k<numScalarInfos; ++k )
+    {
+        if( scalarInfos[k].code == code )
+        {
+            type = scalarInfos[k].type;
+            return true;
+        }
+    }
+    PyErr_Format
+    ( PyExc_ValueError, "Unknown scalar type '%c', expected one of ifdFD",
+      code );
+    return false;
+}
+
+ScalarTypes
+RealScalarType( ScalarTypes type )
+{
+    switch( type )
+    {
+    case SCOMPLEX: return SINGLE;
+    case DCOMPLEX: return DOUBLE;
+    default:       return type;
+    }
+}
+
+PyObject*
+ToPython( ScalarTypes type, const void* alpha )
+{
+    switch( type )
+    {
+    case INTEGRAL:
+        return PyLong_FromLong( *static_cast<const int*>(alpha) );
+    case SINGLE:
+        return PyFloat_FromDouble( *static_cast<const float*>(alpha) );
+    case DOUBLE:
+        return PyFloat_FromDouble( *static_cast<const double*>(alpha) );
+    case SCOMPLEX:
+    {
+        const scomplex beta = *static_cast<const scomplex*>(alpha);
+        return PyComplex_FromDoubles( beta.real, beta.imag );
+    }
+    case DCOMPLEX:
+    {
+        const dcomplex beta = *static_cast<const dcomplex*>(alpha);
+        return PyComplex_FromDoubles( beta.real, beta.imag );
+    }
+    default:
+        PyErr_SetString( PyExc_TypeError, "Unknown scalar type" );
+        return 0;
+    }
+}
+
+// Returns false, with a Python exception set, if obj could not be converted
+bool
+FromPython( PyObject* obj, ScalarTypes type, void* alpha )
+{
+    switch( type )
+    {
+    case INTEGRAL:
+        *static_cast<int*>(alpha) = PyLong_AsLong( obj );
+        break;
+    case SINGLE:
+        *static_cast<float*>(alpha) = PyFloat_AsDouble( obj );
+        break;
+    case DOUBLE:
+        *static_cast<double*>(alpha) = PyFloat_AsDouble( obj );
+        break;
+    case SCOMPLEX:
+        *static_cast<scomplex*>(alpha) =
+            scomplex
+            ( PyComplex_RealAsDouble( obj ), PyComplex_ImagAsDouble( obj ) );
+        break;
+    case DCOMPLEX:
+        *static_cast<dcomplex*>(alpha) =
+            dcomplex
+            ( PyComplex_RealAsDouble( obj ), PyComplex_ImagAsDouble( obj ) );
+        break;
+    default:
+        PyErr_SetString( PyExc_TypeError, "Unknown scalar type" );
+        return false;
+    }
+    return !PyErr_Occurred();
+}
+
+//
+// Calls into Elemental with the GIL released. The functor must not touch
+// any Python objects; C++ exceptions are converted into RuntimeError.
+//
+
+template<class Functor>
+bool
+CallWithoutGIL( Functor& functor )
+{
+    std::string error;
+    Py_BEGIN_ALLOW_THREADS
+    try { functor(); }
+    catch( std::exception& e ) { error = e.what(); }
+    Py_END_ALLOW_THREADS
+    if( !error.empty() )
+    {
+        PyErr_SetString( PyExc_RuntimeError, error.c_str() );
+        return false;
+    }
+    return true;
+}
+
+// Runs functor.Apply<F>() for the floating-point type F with the GIL released
+template<class Functor>
+bool
+CallFieldWithoutGIL( ScalarTypes type, Functor& functor )
+{
+    std::string error;
+    Py_BEGIN_ALLOW_THREADS
+    try
+    {
+        switch( type )
+        {
+        case SINGLE:   functor.template Apply<float>();    break;
+        case DOUBLE:   functor.template Apply<double>();   break;
+        case SCOMPLEX: functor.template Apply<scomplex>(); break;
+        case DCOMPLEX: functor.template Apply<dcomplex>(); break;
+        default: throw std::logic_error("Expected a floating-point matrix");
+        }
+    }
+    catch( std::exception& e ) { error = e.what(); }
+    Py_END_ALLOW_THREADS
+    if( !error.empty() )
+    {
+        PyErr_SetString( PyExc_RuntimeError, error.c_str() );
+        return false;
+    }
+    return true;
+}
+
+//
+// Grid
+//
+
+struct GridObject
+{
+    PyObject_HEAD
+    const elem::Grid* grid;
+    bool owner;
+};
+
+extern PyTypeObject GridType;
+
+int
+Grid_init( GridObject* self, PyObject* args, PyObject* kwds )
+{
+    int height = 0;
+    static const char* kwlist[] = { "height", 0 };
+    if( !PyArg_ParseTupleAndKeywords
+        ( args, kwds, "|i", const_cast<char**>(kwlist), &height ) )
+        return -1;
+    if( self->owner )
+        delete self->grid;
+    self->grid = 0;
+    self->owner = false;
+    try
+    {
+        if( height == 0 )
+            self->grid = &elem::DefaultGrid();
+        else
+        {
+            const int size = mpi::CommSize( mpi::COMM_WORLD );
+            if( height < 0 || size % height != 0 )
+                throw std::logic_error
+                ("The grid height must evenly divide the number of processes");
+            self->grid = new elem::Grid( mpi::COMM_WORLD, height, size/height );
+            self->owner = true;
+        }
+    }
+    catch( std::exception& e )
+    {
+        PyErr_SetString( PyExc_RuntimeError, e.what() );
+        return -1;
+    }
+    return 0;
+}
+
+void
+Grid_dealloc( GridObject* self )
+{
+    if( self->owner )
+        delete self->grid;
+    Py_TYPE(self)->tp_free( reinterpret_cast<PyObject*>(self) );
+}
+
+bool
+GridIsInitialized( GridObject* self )
+{
+    if( self->grid == 0 )
+    {
+        PyErr_SetString( PyExc_RuntimeError, "The grid was not initialized" );
+        return false;
+    }
+    return true;
+}
+
+PyObject* Grid_Height( GridObject* self )
+{ return GridIsInitialized(self) ? PyLong_FromLong(self->grid->Height()) : 0; }
+PyObject* Grid_Width( GridObject* self )
+{ return GridIsInitialized(self) ? PyLong_FromLong(self->grid->Width()) : 0; }
+PyObject* Grid_Size( GridObject* self )
+{ return GridIsInitialized(self) ? PyLong_FromLong(self->grid->Size()) : 0; }
+PyObject* Grid_Row( GridObject* self )
+{ return GridIsInitialized(self) ? PyLong_FromLong(self->grid->Row()) : 0; }
+PyObject* Grid_Col( GridObject* self )
+{ return GridIsInitialized(self) ? PyLong_FromLong(self->grid->Col()) : 0; }
+PyObject* Grid_Rank( GridObject* self )
+{ return GridIsInitialized(self) ? PyLong_FromLong(self->grid->Rank()) : 0; }
+
+PyMethodDef Grid_methods[] =
+{
+    { "Height", (PyCFunction)Grid_Height, METH_NOARGS, "Process grid height" },
+    { "Width", (PyCFunction)Grid_Width, METH_NOARGS, "Process grid width" },
+    { "Size", (PyCFunction)Grid_Size, METH_NOARGS, "Number of processes" },
+    { "Row", (PyCFunction)Grid_Row, METH_NOARGS, "This process's grid row" },
+    { "Col", (PyCFunction)Grid_Col, METH_NOARGS, "This process's grid col" },
+    { "Rank", (PyCFunction)Grid_Rank, METH_NOARGS, "This process's rank" },
+    { 0 }
+};
+
+//
+// Matrix and DistMatrix
+//
+// Both hold their matrix through the type-erased base class and count the
+// number of live buffer exports so that reallocation can be refused.
+//
+
+struct MatrixObject
+{
+    PyObject_HEAD
+    AutoMatrix<int>* A;
+    int exports;
+};
+
+struct DistMatrixObject
+{
+    PyObject_HEAD
+    AutoDistMatrix<int>* A;
+    PyObject* grid;
+    int exports;
+};
+
+extern PyTypeObject MatrixType;
+extern PyTypeObject DistMatrixType;
+
+bool
+IsMatrix( PyObject* obj )
+{ return PyObject_TypeCheck( obj, &MatrixType ); }
+
+bool
+IsDistMatrix( PyObject* obj )
+{ return PyObject_TypeCheck( obj, &DistMatrixType ); }
+
+int
+ExportsOf( PyObject* obj )
+{
+    if( IsMatrix( obj ) )
+        return reinterpret_cast<MatrixObject*>(obj)->exports;
+    else
+        return reinterpret_cast<DistMatrixObject*>(obj)->exports;
+}
+
+bool
+AssertNotExported( PyObject* obj )
+{
+    if( ExportsOf( obj ) > 0 )
+    {
+        PyErr_SetString
+        ( PyExc_BufferError,
+          "Cannot reallocate a matrix while views of its entries exist" );
+        return false;
+    }
+    return true;
+}
+
+// Shared by Matrix and DistMatrix: export the local matrix in column-major
+// order with a column stride of ldim entries
+int
+GetLocalBuffer
+( PyObject* exporter, AutoMatrix<int>& A, int& exports,
+  Py_buffer* view, int flags )
+{
+    const ScalarInfo* info = InfoOf( A.DataType() );
+    const int height = A.Height();
+    const int width = A.Width();
+    const int ldim = A.LDim();
+    const Py_ssize_t itemSize = A.DataSize();
+    // A row vector is only contiguous if its entries are adjacent, which is
+    // not the case for, e.g., a row of a larger matrix
+    const bool contiguous = ( width <= 1 || ldim == height );
+    const bool trivial = ( contiguous && (height <= 1 || width <= 1) );
+    if( info == 0 )
+    {
+        PyErr_SetString( PyExc_BufferError, "Unknown scalar type" );
+        return -1;
+    }
+    if( (flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && A.Locked() )
+    {
+        PyErr_SetString( PyExc_BufferError, "The matrix is locked" );
+        return -1;
+    }
+    if( (flags & PyBUF_STRIDES) != PyBUF_STRIDES && !trivial )
+    {
+        PyErr_SetString
+        ( PyExc_BufferError, "The matrix requires a strided buffer" );
+        return -1;
+    }
+    if( ((flags & PyBUF_C_CONTIGUOUS) == PyBUF_C_CONTIGUOUS && !trivial) ||
+        ((flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS && !contiguous) ||
+        ((flags & PyBUF_ANY_CONTIGUOUS) == PyBUF_ANY_CONTIGUOUS &&
+         !contiguous) )
+    {
+        PyErr_SetString
+        ( PyExc_BufferError, "The matrix is not contiguous in that order" );
+        return -1;
+    }
+
+    // The shape and strides live until the view is released
+    Py_ssize_t* dims = new Py_ssize_t[4];
+    dims[0] = height;
+    dims[1] = width;
+    dims[2] = itemSize;
+    dims[3] = itemSize*ldim;
+
+    view->buf = const_cast<void*>(A.LockedBuffer());
+    view->obj = exporter;
+    Py_INCREF( exporter );
+    view->len = itemSize*height*width;
+    view->readonly = A.Locked();
+    view->itemsize = itemSize;
+    view->format =
+        ( (flags & PyBUF_FORMAT) == PyBUF_FORMAT ?
+          const_cast<char*>(info->format) : 0 );
+    view->ndim = 2;
+    view->shape = ( (flags & PyBUF_ND) == PyBUF_ND ? &dims[0] : 0 );
+    view->strides = ( (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? &dims[2] : 0 );
+    view->suboffsets = 0;
+    view->internal = dims;
+    ++exports;
+    return 0;
+}
+
+void
+ReleaseLocalBuffer( int& exports, Py_buffer* view )
+{
+    delete[] static_cast<Py_ssize_t*>(view->internal);
+    --exports;
+}
+
+// Copy a single entry of a local matrix into or out of Python; the casts
+// select the untyped overloads of GetBlock and SetBlock
+PyObject*
+GetLocalEntry( const AutoMatrix<int>& A, int i, int j )
+{
+    byte alpha[sizeof(dcomplex)];
+    try { A.GetBlock( i, j, 1, 1, static_cast<void*>(alpha), 1 ); }
+    catch( std::exception& e )
+    {
+        PyErr_SetString( PyExc_IndexError, e.what() );
+        return 0;
+    }
+    return ToPython( A.DataType(), alpha );
+}
+
+PyObject*
+SetLocalEntry( AutoMatrix<int>& A, int i, int j, PyObject* value )
+{
+    byte alpha[sizeof(dcomplex)];
+    if( !FromPython( value, A.DataType(), alpha ) )
+        return 0;
+    try { A.SetBlock( i, j, 1, 1, static_cast<const void*>(alpha), 1 ); }
+    catch( std::exception& e )
+    {
+        PyErr_SetString( PyExc_IndexError, e.what() );
+        return 0;
+    }
+    Py_RETURN_NONE;
+}
+
+//
+// Matrix
+//
+
+int
+Matrix_init( MatrixObject* self, PyObject* args, PyObject* kwds )
+{
+    CharArg code = 'd';
+    int height = 0, width = 0;
+    static const char* kwlist[] = { "type", "height", "width", 0 };
+    if( !PyArg_ParseTupleAndKeywords
+        ( args, kwds, "|" CHAR_FORMAT "ii", const_cast<char**>(kwlist),
+          &code, &height, &width ) )
+        return -1;
+    ScalarTypes type = DOUBLE;
+    if( !CodeToScalarType( code, type ) )
+        return -1;
+    if( self->exports > 0 )
+    {
+        PyErr_SetString
+        ( PyExc_BufferError, "Cannot reinitialize an exported matrix" );
+        return -1;
+    }
+    delete self->A;
+    self->A = 0;
+    try { self->A = AutoMatrix<int>::Create( type, height, width ); }
+    catch( std::exception& e )
+    {
+        PyErr_SetString( PyExc_RuntimeError, e.what() );
+        return -1;
+    }
+    return 0;
+}
+
+void
+Matrix_dealloc( MatrixObject* self )
+{
+    delete self->A;
+    Py_TYPE(self)->tp_free( reinterpret_cast<PyObject*>(self) );
+}
+
+int
+Matrix_getbuffer( MatrixObject* self, Py_buffer* view, int flags )
+{
+    return GetLocalBuffer
+    ( reinterpret_cast<PyObject*>(self), *self->A, self->exports,
+      view, flags );
+}
+
+void
+Matrix_releasebuffer( MatrixObject* self, Py_buffer* view )
+{ ReleaseLocalBuffer( self->exports, view ); }
+
+PyObject* Matrix_Height( MatrixObject* self )
+{ return PyLong_FromLong( self->A->Height() ); }
+PyObject* Matrix_Width( MatrixObject* self )
+{ return PyLong_FromLong( self->A->Width() ); }
+PyObject* Matrix_LDim( MatrixObject* self )
+{ return PyLong_FromLong( self->A->LDim() ); }
+
+PyObject*
+Matrix_Type( MatrixObject* self )
+{
+    const char code = InfoOf( self->A->DataType() )->code;
+    return PyUnicode_FromStringAndSize( &code, 1 );
+}
+
+PyObject*
+Matrix_Resize( MatrixObject* self, PyObject* args )
+{
+    int height, width;
+    if( !PyArg_ParseTuple( args, "ii", &height, &width ) ||
+        !AssertNotExported( reinterpret_cast<PyObject*>(self) ) )
+        return 0;
+    try { self->A->ResizeTo( height, width ); }
+    catch( std::exception& e )
+    {
+        PyErr_SetString( PyExc_RuntimeError, e.what() );
+        return 0;
+    }
+    Py_RETURN_NONE;
+}
+
+PyObject*
+Matrix_Get( MatrixObject* self, PyObject* args )
+{
+    int i, j;
+    if( !PyArg_ParseTuple( args, "ii", &i, &j ) )
+        return 0;
+    return GetLocalEntry( *self->A, i, j );
+}
+
+PyObject*
+Matrix_Set( MatrixObject* self, PyObject* args )
+{
+    int i, j;
+    PyObject* value;
+    if( !PyArg_ParseTuple( args, "iiO", &i, &j, &value ) )
+        return 0;
+    return SetLocalEntry( *self->A, i, j, value );
+}
+
+struct PrintMatrix
+{
+    const AutoMatrix<int>* A;
+    std::string msg;
+    void operator()() { A->Print( msg ); }
+};
+
+PyObject*
+Matrix_Print( MatrixObject* self, PyObject* args )
+{
+    const char* msg = "";
+    if( !PyArg_ParseTuple( args, "|s", &msg ) )
+        return 0;
+    PrintMatrix print;
+    print.A = self->A;
+    print.msg = msg;
+    if( !CallWithoutGIL( print ) )
+        return 0;
+    Py_RETURN_NONE;
+}
+
+PyMethodDef Matrix_methods[] =
+{
+    { "Height", (PyCFunction)Matrix_Height, METH_NOARGS, "Matrix height" },
+    { "Width", (PyCFunction)Matrix_Width, METH_NOARGS, "Matrix width" },
+    { "LDim", (PyCFunction)Matrix_LDim, METH_NOARGS, "Leading dimension" },
+    { "Type", (PyCFunction)Matrix_Type, METH_NOARGS,
+      "Scalar type code: one of ifdFD" },
+    { "Resize", (PyCFunction)Matrix_Resize, METH_VARARGS,
+      "Resize(height,width)" },
+    { "Get", (PyCFunction)Matrix_Get, METH_VARARGS, "Get(i,j)" },
+    { "Set", (PyCFunction)Matrix_Set, METH_VARARGS, "Set(i,j,alpha)" },
+    { "Print", (PyCFunction)Matrix_Print, METH_VARARGS, "Print(msg='')" },
+    { 0 }
+};
+
+//
+// DistMatrix
+//
+
+struct DistInfo
+{
+    const char* name;
+    Distribution2D dist;
+};
+
+const DistInfo distInfos[] =
+{
+    { "MC,MR", MC_MR     }, { "MC,*",  MC_STAR   }, { "MD,*",  MD_STAR   },
+    { "MR,MC", MR_MC     }, { "MR,*",  MR_STAR   }, { "*,MC",  STAR_MC   },
+    { "*,MD",  STAR_MD   }, { "*,MR",  STAR_MR   }, { "*,*",   STAR_STAR },
+    { "*,VC",  STAR_VC   }, { "*,VR",  STAR_VR   }, { "VC,*",  VC_STAR   },
+    { "VR,*",  VR_STAR   }
+};
+const int numDistInfos = sizeof(distInfos)/sizeof(DistInfo);
+
+bool
+NameToDist( std::string name, Distribution2D& dist )
+{
+    std::string stripped;
+    for( std::size_t k=0; k<name.size(); ++k )
+        if( name[k] != ' ' )
+            stripped += name[k];
+    for( int k=0; k<numDistInfos; ++k )
+    {
+        if( stripped == distInfos[k].name )
+        {
+            dist = distInfos[k].dist;
+            return true;
+        }
+    }
+    PyErr_Format
+    ( PyExc_ValueError, "Unknown distribution '%s'", name.c_str() );
+    return false;
+}
+
+const char*
+DistToName( Distribution2D dist )
+{
+    for( int k=0; k<numDistInfos; ++k )
+        if( distInfos[k].dist == dist )
+            return distInfos[k].name;
+    return "?";
+}
+
+template<typename T>
+AutoDistMatrix<int>*
+NewDistMatrix( Distribution2D dist, const elem::Grid& g )
+{
+    switch( dist )
+    {
+    case MC_MR:     return new DistMatrix<T,MC,  MR  >( g );
+    case MC_STAR:   return new DistMatrix<T,MC,  STAR>( g );
+    case MD_STAR:   return new DistMatrix<T,MD,  STAR>( g );
+    case MR_MC:     return new DistMatrix<T,MR,  MC  >( g );
+    case MR_STAR:   return new DistMatrix<T,MR,  STAR>( g );
+    case STAR_MC:   return new DistMatrix<T,STAR,MC  >( g );
+    case STAR_MD:   return new DistMatrix<T,STAR,MD  >( g );
+    case STAR_MR:   return new DistMatrix<T,STAR,MR  >( g );
+    case STAR_STAR: return new DistMatrix<T,STAR,STAR>( g );
+    case STAR_VC:   return new DistMatrix<T,STAR,VC  >( g );
+    case STAR_VR:   return new DistMatrix<T,STAR,VR  >( g );
+    case VC_STAR:   return new DistMatrix<T,VC,  STAR>( g );
+    default:        return new DistMatrix<T,VR,  STAR>( g );
+    }
+}
+
+AutoDistMatrix<int>*
+NewDistMatrix( ScalarTypes type, Distribution2D dist, const elem::Grid& g )
+{
+    switch( type )
+    {
+    case INTEGRAL: return NewDistMatrix<int>( dist, g );
+    case SINGLE:   return NewDistMatrix<float>( dist, g );
+    case DOUBLE:   return NewDistMatrix<double>( dist, g );
+    case SCOMPLEX: return NewDistMatrix<scomplex>( dist, g );
+    default:       return NewDistMatrix<dcomplex>( dist, g );
+    }
+}
+
+int
+DistMatrix_init( DistMatrixObject* self, PyObject* args, PyObject* kwds )
+{
+    CharArg code = 'd';
+    const char* distName = "MC,MR";
+    PyObject* grid = 0;
+    static const char* kwlist[] = { "type", "dist", "grid", 0 };
+    if( !PyArg_ParseTupleAndKeywords
+        ( args, kwds, "|" CHAR_FORMAT "sO!", const_cast<char**>(kwlist),
+          &code, &distName, &GridType, &grid ) )
+        return -1;
+    ScalarTypes type = DOUBLE;
+    Distribution2D dist = MC_MR;
+    if( !CodeToScalarType( code, type ) || !NameToDist( distName, dist ) )
+        return -1;
+    if( self->exports > 0 )
+    {
+        PyErr_SetString
+        ( PyExc_BufferError, "Cannot reinitialize an exported matrix" );
+        return -1;
+    }
+    if( grid == 0 )
+        grid = PyObject_CallObject( reinterpret_cast<PyObject*>(&GridType), 0 );
+    else
+        Py_INCREF( grid );
+    if( grid == 0 ||
+        !GridIsInitialized( reinterpret_cast<GridObject*>(grid) ) )
+    {
+        Py_XDECREF( grid );
+        return -1;
+    }
+    delete self->A;
+    self->A = 0;
+    Py_CLEAR( self->grid );
+    self->grid = grid;
+    try
+    {
+        self->A = NewDistMatrix
+        ( type, dist, *reinterpret_cast<GridObject*>(grid)->grid );
+    }
+    catch( std::exception& e )
+    {
+        PyErr_SetString( PyExc_RuntimeError, e.what() );
+        return -1;
+    }
+    return 0;
+}
+
+void
+DistMatrix_dealloc( DistMatrixObject* self )
+{
+    delete self->A;
+    Py_XDECREF( self->grid );
+    Py_TYPE(self)->tp_free( reinterpret_cast<PyObject*>(self) );
+}
+
+int
+DistMatrix_getbuffer( DistMatrixObject* self, Py_buffer* view, int flags )
+{
+    return GetLocalBuffer
+    ( reinterpret_cast<PyObject*>(self), self->A->Matrix(), self->exports,
+      view, flags );
+}
+
+void
+DistMatrix_releasebuffer( DistMatrixObject* self, Py_buffer* view )
+{ ReleaseLocalBuffer( self->exports, view ); }
+
+PyObject* DistMatrix_Height( DistMatrixObject* self )
+{ return PyLong_FromLong( self->A->Height() ); }
+PyObject* DistMatrix_Width( DistMatrixObject* self )
+{ return PyLong_FromLong( self->A->Width() ); }
+PyObject* DistMatrix_LocalHeight( DistMatrixObject* self )
+{ return PyLong_FromLong( self->A->LocalHeight() ); }
+PyObject* DistMatrix_LocalWidth( DistMatrixObject* self )
+{ return PyLong_FromLong( self->A->LocalWidth() ); }
+PyObject* DistMatrix_LDim( DistMatrixObject* self )
+{ return PyLong_FromLong( self->A->LDim() ); }
+PyObject* DistMatrix_ColShift( DistMatrixObject* self )
+{ return PyLong_FromLong( self->A->ColShift() ); }
+PyObject* DistMatrix_RowShift( DistMatrixObject* self )
+{ return PyLong_FromLong( self->A->RowShift() ); }
+PyObject* DistMatrix_ColStride( DistMatrixObject* self )
+{ return PyLong_FromLong( self->A->ColStride() ); }
+PyObject* DistMatrix_RowStride( DistMatrixObject* self )
+{ return PyLong_FromLong( self->A->RowStride() ); }
+
+PyObject*
+DistMatrix_Type( DistMatrixObject* self )
+{
+    const char code = InfoOf( self->A->DataType() )->code;
+    return PyUnicode_FromStringAndSize( &code, 1 );
+}
+
+PyObject*
+DistMatrix_Dist( DistMatrixObject* self )
+{ return PyUnicode_FromString( DistToName( self->A->Dist2D() ) ); }
+
+PyObject*
+DistMatrix_Grid( DistMatrixObject* self )
+{
+    Py_INCREF( self->grid );
+    return self->grid;
+}
+
+PyObject*
+DistMatrix_Resize( DistMatrixObject* self, PyObject* args )
+{
+    int height, width;
+    if( !PyArg_ParseTuple( args, "ii", &height, &width ) ||
+        !AssertNotExported( reinterpret_cast<PyObject*>(self) ) )
+        return 0;
+    try { self->A->ResizeTo( height, width ); }
+    catch( std::exception& e )
+    {
+        PyErr_SetString( PyExc_RuntimeError, e.what() );
+        return 0;
+    }
+    Py_RETURN_NONE;
+}
+
+struct GetDistEntry
+{
+    const AutoDistMatrix<int>* A;
+    int i, j;
+    byte alpha[sizeof(dcomplex)];
+    void operator()() { A->GetBlock( i, j, 1, 1, static_cast<void*>(alpha), 1 ); }
+};
+
+// Collective over the grid
+PyObject*
+DistMatrix_Get( DistMatrixObject* self, PyObject* args )
+{
+    GetDistEntry get;
+    get.A = self->A;
+    if( !PyArg_ParseTuple( args, "ii", &get.i, &get.j ) ||
+        !CallWithoutGIL( get ) )
+        return 0;
+    return ToPython( self->A->DataType(), get.alpha );
+}
+
+// Each process sets its own copy of the entry, if it owns one
+PyObject*
+DistMatrix_Set( DistMatrixObject* self, PyObject* args )
+{
+    int i, j;
+    PyObject* value;
+    if( !PyArg_ParseTuple( args, "iiO", &i, &j, &value ) )
+        return 0;
+    byte alpha[sizeof(dcomplex)];
+    if( !FromPython( value, self->A->DataType(), alpha ) )
+        return 0;
+    try { self->A->SetBlock( i, j, 1, 1, static_cast<const void*>(alpha), 1 ); }
+    catch( std::exception& e )
+    {
+        PyErr_SetString( PyExc_IndexError, e.what() );
+        return 0;
+    }
+    Py_RETURN_NONE;
+}
+
+PyObject*
+DistMatrix_GetLocal( DistMatrixObject* self, PyObject* args )
+{
+    int iLocal, jLocal;
+    if( !PyArg_ParseTuple( args, "ii", &iLocal, &jLocal ) )
+        return 0;
+    return GetLocalEntry( self->A->LockedMatrix(), iLocal, jLocal );
+}
+
+PyObject*
+DistMatrix_SetLocal( DistMatrixObject* self, PyObject* args )
+{
+    int iLocal, jLocal;
+    PyObject* value;
+    if( !PyArg_ParseTuple( args, "iiO", &iLocal, &jLocal, &value ) )
+        return 0;
+    return SetLocalEntry( self->A->Matrix(), iLocal, jLocal, value );
+}
+
+struct PrintDistMatrix
+{
+    const AutoDistMatrix<int>* A;
+    std::string msg;
+    bool summary;
+    void operator()()
+    {
+        if( summary )
+            A->PrintSummary( msg );
+        else
+            A->Print( msg );
+    }
+};
+
+PyObject*
+DistMatrix_Print( DistMatrixObject* self, PyObject* args )
+{
+    const char* msg = "";
+    if( !PyArg_ParseTuple( args, "|s", &msg ) )
+        return 0;
+    PrintDistMatrix print;
+    print.A = self->A;
+    print.msg = msg;
+    print.summary = false;
+    if( !CallWithoutGIL( print ) )
+        return 0;
+    Py_RETURN_NONE;
+}
+
+PyObject*
+DistMatrix_PrintSummary( DistMatrixObject* self, PyObject* args )
+{
+    const char* msg = "";
+    if( !PyArg_ParseTuple( args, "|s", &msg ) )
+        return 0;
+    PrintDistMatrix print;
+    print.A = self->A;
+    print.msg = msg;
+    print.summary = true;
+    if( !CallWithoutGIL( print ) )
+        return 0;
+    Py_RETURN_NONE;
+}
+
+PyMethodDef DistMatrix_methods[] =
+{
+    { "Height", (PyCFunction)DistMatrix_Height, METH_NOARGS, "Height" },
+    { "Width", (PyCFunction)DistMatrix_Width, METH_NOARGS, "Width" },
+    { "LocalHeight", (PyCFunction)DistMatrix_LocalHeight, METH_NOARGS,
+      "Local height" },
+    { "LocalWidth", (PyCFunction)DistMatrix_LocalWidth, METH_NOARGS,
+      "Local width" },
+    { "LDim", (PyCFunction)DistMatrix_LDim, METH_NOARGS,
+      "Leading dimension of the local matrix" },
+    { "ColShift", (PyCFunction)DistMatrix_ColShift, METH_NOARGS,
+      "Global row of the first local row" },
+    { "RowShift", (PyCFunction)DistMatrix_RowShift, METH_NOARGS,
+      "Global column of the first local column" },
+    { "ColStride", (PyCFunction)DistMatrix_ColStride, METH_NOARGS,
+      "Global stride between local rows" },
+    { "RowStride", (PyCFunction)DistMatrix_RowStride, METH_NOARGS,
+      "Global stride between local columns" },
+    { "Type", (PyCFunction)DistMatrix_Type, METH_NOARGS,
+      "Scalar type code: one of ifdFD" },
+    { "Dist", (PyCFunction)DistMatrix_Dist, METH_NOARGS,
+      "Distribution, e.g., 'MC,MR'" },
+    { "Grid", (PyCFunction)DistMatrix_Grid, METH_NOARGS, "Process grid" },
+    { "Resize", (PyCFunction)DistMatrix_Resize, METH_VARARGS,
+      "Resize(height,width)" },
+    { "Get", (PyCFunction)DistMatrix_Get, METH_VARARGS,
+      "Get(i,j): collective" },
+    { "Set", (PyCFunction)DistMatrix_Set, METH_VARARGS, "Set(i,j,alpha)" },
+    { "GetLocal", (PyCFunction)DistMatrix_GetLocal, METH_VARARGS,
+      "GetLocal(iLocal,jLocal)" },
+    { "SetLocal", (PyCFunction)DistMatrix_SetLocal, METH_VARARGS,
+      "SetLocal(iLocal,jLocal,alpha)" },
+    { "Print", (PyCFunction)DistMatrix_Print, METH_VARARGS,
+      "Print(msg=''): collective" },
+    { "PrintSummary", (PyCFunction)DistMatrix_PrintSummary, METH_VARARGS,
+      "PrintSummary(msg=''): collective" },
+    { 0 }
+};
+
+//
+// Operands of the computational routines
+//
+
+// Either a Matrix or a [MC,MR] DistMatrix
+struct Operand
+{
+    PyObject* obj;
+    AutoMatrix<int>* local;
+    AutoDistMatrix<int>* dist;
+
+    ScalarTypes Type() const
+    { return local != 0 ? local->DataType() : dist->DataType(); }
+
+    template<typename T>
+    Matrix<T>& Local() const
+    { return local->Cast<T>(); }
+
+    template<typename T>
+    DistMatrix<T>& Dist() const
+    {
+        DistMatrix<T>* A = dynamic_cast<DistMatrix<T>*>(dist);
+        if( A == 0 )
+            throw std::logic_error
+            ("Expected [MC,MR] DistMatrices of the same scalar type");
+        return *A;
+    }
+};
+
+// For use with the O& format of PyArg_ParseTuple
+int
+ToOperand( PyObject* obj, void* address )
+{
+    Operand* operand = static_cast<Operand*>(address);
+    operand->obj = obj;
+    operand->local = 0;
+    operand->dist = 0;
+    if( IsMatrix( obj ) )
+        operand->local = reinterpret_cast<MatrixObject*>(obj)->A;
+    else if( IsDistMatrix( obj ) )
+        operand->dist = reinterpret_cast<DistMatrixObject*>(obj)->A;
+    else
+    {
+        PyErr_SetString( PyExc_TypeError, "Expected a Matrix or DistMatrix" );
+        return 0;
+    }
+    return 1;
+}
+
+bool
+AssertSameKind( const Operand& A, const Operand& B )
+{
+    if( (A.local != 0) != (B.local != 0) )
+    {
+        PyErr_SetString
+        ( PyExc_TypeError, "Cannot mix Matrix and DistMatrix arguments" );
+        return false;
+    }
+    if( A.Type() != B.Type() )
+    {
+        PyErr_SetString
+        ( PyExc_TypeError, "The arguments must have the same scalar type" );
+        return false;
+    }
+    return true;
+}
+
+// Returns a new, empty Matrix or DistMatrix of the same kind as A, in which
+// case the result is distributed over the same grid
+PyObject*
+NewLike( const Operand& A, ScalarTypes type, Distribution2D dist=MC_MR )
+{
+    PyObject* result;
+    const char code = InfoOf( type )->code;
+    if( A.local != 0 )
+        result = PyObject_CallFunction
+        ( reinterpret_cast<PyObject*>(&MatrixType),
+          const_cast<char*>(CHAR_FORMAT), code );
+    else
+        result = PyObject_CallFunction
+        ( reinterpret_cast<PyObject*>(&DistMatrixType),
+          const_cast<char*>(CHAR_FORMAT "sO"), code, DistToName(dist),
+          reinterpret_cast<DistMatrixObject*>(A.obj)->grid );
+    return result;
+}
+
+Operand
+OperandOf( PyObject* obj )
+{
+    Operand operand;
+    ToOperand( obj, &operand );
+    return operand;
+}
+
+//
+// Module-level routines
+//
+
+PyObject*
+Initialize_( PyObject* self )
+{
+    static int argc = 1;
+    static char name[] = "python";
+    static char* argvArray[] = { name, 0 };
+    static char** argv = argvArray;
+    try { elem::Initialize( argc, argv ); }
+    catch( std::exception& e )
+    {
+        PyErr_SetString( PyExc_RuntimeError, e.what() );
+        return 0;
+    }
+    Py_RETURN_NONE;
+}
+
+PyObject*
+Finalize_( PyObject* self )
+{
+    try { elem::Finalize(); }
+    catch( std::exception& e )
+    {
+        PyErr_SetString( PyExc_RuntimeError, e.what() );
+        return 0;
+    }
+    Py_RETURN_NONE;
+}
+
+PyObject*
+SetBlocksize_( PyObject* self, PyObject* args )
+{
+    int blocksize;
+    if( !PyArg_ParseTuple( args, "i", &blocksize ) )
+        return 0;
+    elem::SetBlocksize( blocksize );
+    Py_RETURN_NONE;
+}
+
+PyObject*
+Blocksize_( PyObject* self )
+{ return PyLong_FromLong( elem::Blocksize() ); }
+
+struct UniformCall
+{
+    AutoMatrix<int>* local;
+    AutoDistMatrix<int>* dist;
+    int m, n;
+
+    template<typename T>
+    void Apply()
+    {
+        if( local != 0 )
+            Uniform( m, n, local->Cast<T>() );
+        else
+            ApplyDist<T>();
+    }
+
+    template<typename T>
+    void ApplyDist()
+    {
+        AutoDistMatrix<int>& A = *dist;
+        switch( A.Dist2D() )
+        {
+        case MC_MR:   Uniform( m, n, static_cast<DistMatrix<T,MC,MR>&>(A) );
+                      break;
+        case MC_STAR: Uniform( m, n, static_cast<DistMatrix<T,MC,STAR>&>(A) );
+                      break;
+        case MD_STAR: Uniform( m, n, static_cast<DistMatrix<T,MD,STAR>&>(A) );
+                      break;
+        case MR_MC:   Uniform( m, n, static_cast<DistMatrix<T,MR,MC>&>(A) );
+                      break;
+        case MR_STAR: Uniform( m, n, static_cast<DistMatrix<T,MR,STAR>&>(A) );
+                      break;
+        case STAR_MC: Uniform( m, n, static_cast<DistMatrix<T,STAR,MC>&>(A) );
+                      break;
+        case STAR_MD: Uniform( m, n, static_cast<DistMatrix<T,STAR,MD>&>(A) );
+                      break;
+        case STAR_MR: Uniform( m, n, static_cast<DistMatrix<T,STAR,MR>&>(A) );
+                      break;
+        case STAR_STAR:
+            Uniform( m, n, static_cast<DistMatrix<T,STAR,STAR>&>(A) ); break;
+        case STAR_VC: Uniform( m, n, static_cast<DistMatrix<T,STAR,VC>&>(A) );
+                      break;
+        case STAR_VR: Uniform( m, n, static_cast<DistMatrix<T,STAR,VR>&>(A) );
+                      break;
+        case VC_STAR: Uniform( m, n, static_cast<DistMatrix<T,VC,STAR>&>(A) );
+                      break;
+        case VR_STAR: Uniform( m, n, static_cast<DistMatrix<T,VR,STAR>&>(A) );
+                      break;
+        }
+    }
+
+    void operator()()
+    {
+        const ScalarTypes type =
+            ( local != 0 ? local->DataType() : dist->DataType() );
+        if( type == INTEGRAL )
+            Apply<int>();
+        else if( type == SINGLE )
+            Apply<float>();
+        else if( type == DOUBLE )
+            Apply<double>();
+        else if( type == SCOMPLEX )
+            Apply<scomplex>();
+        else
+            Apply<dcomplex>();
+    }
+};
+
+// Any distribution is allowed
+PyObject*
+Uniform_( PyObject* self, PyObject* args )
+{
+    Operand A;
+    UniformCall call;
+    if( !PyArg_ParseTuple( args, "O&ii", ToOperand, &A, &call.m, &call.n ) ||
+        !AssertNotExported( A.obj ) )
+        return 0;
+    call.local = A.local;
+    call.dist = A.dist;
+    if( !CallWithoutGIL( call ) )
+        return 0;
+    Py_RETURN_NONE;
+}
+
+struct GemmCall
+{
+    Orientation orientA, orientB;
+    byte alpha[sizeof(dcomplex)], beta[sizeof(dcomplex)];
+    Operand A, B, C;
+
+    template<typename F>
+    void Apply()
+    {
+        const F alphaF = *reinterpret_cast<const F*>(alpha);
+        const F betaF = *reinterpret_cast<const F*>(beta);
+        if( A.local != 0 )
+            Gemm
+            ( orientA, orientB,
+              alphaF, A.Local<F>(), B.Local<F>(), betaF, C.Local<F>() );
+        else
+            Gemm
+            ( orientA, orientB,
+              alphaF, A.Dist<F>(), B.Dist<F>(), betaF, C.Dist<F>() );
+    }
+};
+
+PyObject*
+Gemm_( PyObject* self, PyObject* args )
+{
+    CharArg orientA, orientB;
+    PyObject *alpha, *beta;
+    GemmCall call;
+    if( !PyArg_ParseTuple
+        ( args, CHAR_FORMAT CHAR_FORMAT "OO&O&OO&", &orientA, &orientB, &alpha,
+          ToOperand, &call.A, ToOperand, &call.B, &beta,
+          ToOperand, &call.C ) ||
+        !AssertSameKind( call.A, call.B ) ||
+        !AssertSameKind( call.A, call.C ) ||
+        !FromPython( alpha, call.A.Type(), call.alpha ) ||
+        !FromPython( beta, call.A.Type(), call.beta ) )
+        return 0;
+    try
+    {
+        call.orientA = CharToOrientation( orientA );
+        call.orientB = CharToOrientation( orientB );
+    }
+    catch( std::exception& e )
+    {
+        PyErr_SetString( PyExc_ValueError, e.what() );
+        return 0;
+    }
+    if( !CallFieldWithoutGIL( call.A.Type(), call ) )
+        return 0;
+    Py_RETURN_NONE;
+}
+
+struct CholeskyCall
+{
+    UpperOrLower uplo;
+    Operand A;
+
+    template<typename F>
+    void Apply()
+    {
+        if( A.local != 0 )
+            Cholesky( uplo, A.Local<F>() );
+        else
+            Cholesky( uplo, A.Dist<F>() );
+    }
+};
+
+PyObject*
+Cholesky_( PyObject* self, PyObject* args )
+{
+    CharArg uplo;
+    CholeskyCall call;
+    if( !PyArg_ParseTuple( args, CHAR_FORMAT "O&", &uplo, ToOperand, &call.A ) )
+        return 0;
+    try { call.uplo = CharToUpperOrLower( uplo ); }
+    catch( std::exception& e )
+    {
+        PyErr_SetString( PyExc_ValueError, e.what() );
+        return 0;
+    }
+    if( !CallFieldWithoutGIL( call.A.Type(), call ) )
+        return 0;
+    Py_RETURN_NONE;
+}
+
+struct LUCall
+{
+    Operand A, p;
+
+    template<typename F>
+    void Apply()
+    {
+        if( A.local != 0 )
+            LU( A.Local<F>(), p.local->Cast<int>() );
+        else
+            LU( A.Dist<F>(),
+                static_cast<DistMatrix<int,VC,STAR>&>(*p.dist) );
+    }
+};
+
+// Overwrites A with its LU factors and returns the pivot vector, which is
+// an integral [VC,* ] DistMatrix when A is distributed
+PyObject*
+LU_( PyObject* self, PyObject* args )
+{
+    LUCall call;
+    if( !PyArg_ParseTuple( args, "O&", ToOperand, &call.A ) )
+        return 0;
+    PyObject* p = NewLike( call.A, INTEGRAL, VC_STAR );
+    if( p == 0 )
+        return 0;
+    call.p = OperandOf( p );
+    if( !CallFieldWithoutGIL( call.A.Type(), call ) )
+    {
+        Py_DECREF( p );
+        return 0;
+    }
+    return p;
+}
+
+struct ExplicitQRCall
+{
+    Operand A, R;
+
+    template<typename F>
+    void Apply()
+    {
+        if( A.local != 0 )
+            qr::Explicit( A.Local<F>(), R.Local<F>() );
+        else
+            qr::Explicit( A.Dist<F>(), R.Dist<F>() );
+    }
+};
+
+// Overwrites A with Q and returns R
+PyObject*
+ExplicitQR_( PyObject* self, PyObject* args )
+{
+    ExplicitQRCall call;
+    if( !PyArg_ParseTuple( args, "O&", ToOperand, &call.A ) ||
+        !AssertNotExported( call.A.obj ) )
+        return 0;
+    PyObject* R = NewLike( call.A, call.A.Type() );
+    if( R == 0 )
+        return 0;
+    call.R = OperandOf( R );
+    if( !CallFieldWithoutGIL( call.A.Type(), call ) )
+    {
+        Py_DECREF( R );
+        return 0;
+    }
+    return R;
+}
+
+struct SVDCall
+{
+    Operand A, s, V;
+    bool vectors;
+
+    template<typename F>
+    void Apply()
+    {
+        typedef typename Base<F>::type R;
+        if( A.local != 0 )
+        {
+            if( vectors )
+                SVD( A.Local<F>(), s.Local<R>(), V.Local<F>() );
+            else
+                SVD( A.Local<F>(), s.Local<R>() );
+        }
+        else
+        {
+            DistMatrix<R,VR,STAR>& sDist =
+                static_cast<DistMatrix<R,VR,STAR>&>(*s.dist);
+            if( vectors )
+                SVD( A.Dist<F>(), sDist, V.Dist<F>() );
+            else
+                SVD( A.Dist<F>(), sDist );
+        }
+    }
+};
+
+// Overwrites A with U and returns (s,V), where s is a real [VR,* ]
+// DistMatrix when A is distributed
+PyObject*
+SVD_( PyObject* self, PyObject* args )
+{
+    SVDCall call;
+    call.vectors = true;
+    if( !PyArg_ParseTuple( args, "O&", ToOperand, &call.A ) ||
+        !AssertNotExported( call.A.obj ) )
+        return 0;
+    PyObject* s = NewLike( call.A, RealScalarType(call.A.Type()), VR_STAR );
+    PyObject* V = NewLike( call.A, call.A.Type() );
+    if( s == 0 || V == 0 )
+    {
+        Py_XDECREF( s );
+        Py_XDECREF( V );
+        return 0;
+    }
+    call.s = OperandOf( s );
+    call.V = OperandOf( V );
+    if( !CallFieldWithoutGIL( call.A.Type(), call ) )
+    {
+        Py_DECREF( s );
+        Py_DECREF( V );
+        return 0;
+    }
+    return Py_BuildValue( "NN", s, V );
+}
+
+// Returns the singular values of A, which is overwritten
+PyObject*
+SingularValues_( PyObject* self, PyObject* args )
+{
+    SVDCall call;
+    call.vectors = false;
+    if( !PyArg_ParseTuple( args, "O&", ToOperand, &call.A ) ||
+        !AssertNotExported( call.A.obj ) )
+        return 0;
+    PyObject* s = NewLike( call.A, RealScalarType(call.A.Type()), VR_STAR );
+    if( s == 0 )
+        return 0;
+    call.s = OperandOf( s );
+    if( !CallFieldWithoutGIL( call.A.Type(), call ) )
+    {
+        Py_DECREF( s );
+        return 0;
+    }
+    return s;
+}
+
+struct HermitianGenDefiniteEigCall
+{
+    UpperOrLower uplo;
+    Operand A, B, w, X;
+
+    template<typename F>
+    void Apply()
+    {
+        if( A.local != 0 )
+            throw std::logic_error
+            ("HermitianGenDefiniteEig requires DistMatrix arguments");
+        Run( A.Dist<F>() );
+    }
+
+    // The distributed eigensolvers only support double precision
+    template<typename F>
+    void Run( DistMatrix<F>& ADist )
+    { throw std::logic_error("HermitianGenDefiniteEig requires 'd' or 'D'"); }
+
+    void Run( DistMatrix<double>& ADist )
+    {
+        HermitianGenDefiniteEig
+        ( AXBX, uplo, ADist, B.Dist<double>(),
+          static_cast<DistMatrix<double,VR,STAR>&>(*w.dist),
+          X.Dist<double>() );
+    }
+
+    void Run( DistMatrix<dcomplex>& ADist )
+    {
+        HermitianGenDefiniteEig
+        ( AXBX, uplo, ADist, B.Dist<dcomplex>(),
+          static_cast<DistMatrix<double,VR,STAR>&>(*w.dist),
+          X.Dist<dcomplex>() );
+    }
+};
+
+// Solves A X = B X diag(w), overwriting A and B, and returns (w,X)
+PyObject*
+HermitianGenDefiniteEig_( PyObject* self, PyObject* args )
+{
+    CharArg uplo = 'L';
+    HermitianGenDefiniteEigCall call;
+    if( !PyArg_ParseTuple
+        ( args, "O&O&|" CHAR_FORMAT, ToOperand, &call.A, ToOperand, &call.B, &uplo ) ||
+        !AssertSameKind( call.A, call.B ) )
+        return 0;
+    try { call.uplo = CharToUpperOrLower( uplo ); }
+    catch( std::exception& e )
+    {
+        PyErr_SetString( PyExc_ValueError, e.what() );
+        return 0;
+    }
+    PyObject* w = NewLike( call.A, RealScalarType(call.A.Type()), VR_STAR );
+    PyObject* X = NewLike( call.A, call.A.Type() );
+    if( w == 0 || X == 0 )
+    {
+        Py_XDECREF( w );
+        Py_XDECREF( X );
+        return 0;
+    }
+    call.w = OperandOf( w );
+    call.X = OperandOf( X );
+    if( !CallFieldWithoutGIL( call.A.Type(), call ) )
+    {
+        Py_DECREF( w );
+        Py_DECREF( X );
+        return 0;
+    }
+    return Py_BuildValue( "NN", w, X );
+}
+
+PyMethodDef elem_methods[] =
+{
+    { "Initialize", (PyCFunction)Initialize_, METH_NOARGS,
+      "Initialize Elemental (and MPI, if necessary)" },
+    { "Finalize", (PyCFunction)Finalize_, METH_NOARGS, "Finalize Elemental" },
+    { "SetBlocksize", (PyCFunction)SetBlocksize_, METH_VARARGS,
+      "SetBlocksize(blocksize)" },
+    { "Blocksize", (PyCFunction)Blocksize_, METH_NOARGS,
+      "Algorithmic blocksize" },
+    { "Uniform", (PyCFunction)Uniform_, METH_VARARGS,
+      "Uniform(A,m,n): resize A to m x n with entries from the unit ball" },
+    { "Gemm", (PyCFunction)Gemm_, METH_VARARGS,
+      "Gemm(orientA,orientB,alpha,A,B,beta,C): C := alpha A B + beta C" },
+    { "Cholesky", (PyCFunction)Cholesky_, METH_VARARGS,
+      "Cholesky(uplo,A): overwrite a triangle of A with its Cholesky factor" },
+    { "LU", (PyCFunction)LU_, METH_VARARGS,
+      "p = LU(A): overwrite A with its partially-pivoted LU factors" },
+    { "ExplicitQR", (PyCFunction)ExplicitQR_, METH_VARARGS,
+      "R = ExplicitQR(A): overwrite A with Q" },
+    { "SVD", (PyCFunction)SVD_, METH_VARARGS,
+      "s, V = SVD(A): overwrite A with U" },
+    { "SingularValues", (PyCFunction)SingularValues_, METH_VARARGS,
+      "s = SingularValues(A)" },
+    { "HermitianGenDefiniteEig", (PyCFunction)HermitianGenDefiniteEig_,
+      METH_VARARGS, "w, X = HermitianGenDefiniteEig(A,B,uplo='L')" },
+    { 0 }
+};
+
+//
+// Type objects
+//
+
+#if PY_MAJOR_VERSION >= 3
+PyBufferProcs Matrix_as_buffer =
+{ (getbufferproc)Matrix_getbuffer, (releasebufferproc)Matrix_releasebuffer };
+PyBufferProcs DistMatrix_as_buffer =
+{ (getbufferproc)DistMatrix_getbuffer,
+  (releasebufferproc)DistMatrix_releasebuffer };
+const long bufferFlags = 0;
+#else
+PyBufferProcs Matrix_as_buffer =
+{ 0, 0, 0, 0,
+  (getbufferproc)Matrix_getbuffer, (releasebufferproc)Matrix_releasebuffer };
+PyBufferProcs DistMatrix_as_buffer =
+{ 0, 0, 0, 0,
+  (getbufferproc)DistMatrix_getbuffer,
+  (releasebufferproc)DistMatrix_releasebuffer };
+const long bufferFlags = Py_TPFLAGS_HAVE_NEWBUFFER;
+#endif
+
+PyTypeObject GridType = { PyVarObject_HEAD_INIT(0,0) "elem.Grid" };
+PyTypeObject MatrixType = { PyVarObject_HEAD_INIT(0,0) "elem.Matrix" };
+PyTypeObject DistMatrixType = { PyVarObject_HEAD_INIT(0,0) "elem.DistMatrix" };
+
+bool
+ReadyTypes()
+{
+    GridType.tp_basicsize = sizeof(GridObject);
+    GridType.tp_flags = Py_TPFLAGS_DEFAULT;
+    GridType.tp_doc = "Grid(height=0): a process grid over MPI_COMM_WORLD, "
+                      "or the default grid if height is zero";
+    GridType.tp_new = PyType_GenericNew;
+    GridType.tp_init = (initproc)Grid_init;
+    GridType.tp_dealloc = (destructor)Grid_dealloc;
+    GridType.tp_methods = Grid_methods;
+
+    MatrixType.tp_basicsize = sizeof(MatrixObject);
+    MatrixType.tp_flags = Py_TPFLAGS_DEFAULT | bufferFlags;
+    MatrixType.tp_doc = "Matrix(type='d',height=0,width=0)";
+    MatrixType.tp_new = PyType_GenericNew;
+    MatrixType.tp_init = (initproc)Matrix_init;
+    MatrixType.tp_dealloc = (destructor)Matrix_dealloc;
+    MatrixType.tp_methods = Matrix_methods;
+    MatrixType.tp_as_buffer = &Matrix_as_buffer;
+
+    DistMatrixType.tp_basicsize = sizeof(DistMatrixObject);
+    DistMatrixType.tp_flags = Py_TPFLAGS_DEFAULT | bufferFlags;
+    DistMatrixType.tp_doc = "DistMatrix(type='d',dist='MC,MR',grid=Grid())";
+    DistMatrixType.tp_new = PyType_GenericNew;
+    DistMatrixType.tp_init = (initproc)DistMatrix_init;
+    DistMatrixType.tp_dealloc = (destructor)DistMatrix_dealloc;
+    DistMatrixType.tp_methods = DistMatrix_methods;
+    DistMatrixType.tp_as_buffer = &DistMatrix_as_buffer;
+
+    return PyType_Ready( &GridType ) >= 0 &&
+           PyType_Ready( &MatrixType ) >= 0 &&
+           PyType_Ready( &DistMatrixType ) >= 0;
+}
+
+PyObject*
+CreateModule()
+{
+    if( !ReadyTypes() )
+        return 0;
+#if PY_MAJOR_VERSION >= 3
+    static PyModuleDef moduleDef =
+    { PyModuleDef_HEAD_INIT, "elem", "Python interface to Elemental", -1,
+      elem_methods };
+    PyObject* module = PyModule_Create( &moduleDef );
+#else
+    PyObject* module =
+        Py_InitModule3( "elem", elem_methods, "Python interface to Elemental" );
+#endif
+    if( module == 0 )
+        return 0;
+    Py_INCREF( &GridType );
+    Py_INCREF( &MatrixType );
+    Py_INCREF( &DistMatrixType );
+    PyModule_AddObject
+    ( module, "Grid", reinterpret_cast<PyObject*>(&GridType) );
+    PyModule_AddObject
+    ( module, "Matrix", reinterpret_cast<PyObject*>(&MatrixType) );
+    PyModule_AddObject
+    ( module, "DistMatrix", reinterpret_cast<PyObject*>(&DistMatrixType) );
+    return module;
+}
+
+} // anonymous namespace
+
+#if PY_MAJOR_VERSION >= 3
+PyMODINIT_FUNC
+PyInit_elem()
+{ return CreateModule(); }
+#else
+PyMODINIT_FUNC
+initelem()
+{ CreateModule(); }
+#endif
@@ -1,44 +1,41 @@
-import elem
+import elem, numpy
 
 elem.Initialize()
 
 grid = elem.Grid()
-A = elem.DistMat( grid )
+A = elem.DistMatrix( 'd', 'MC,MR', grid )
 A.Resize(8,8)
-localHeight = A.LocalHeight()
-localWidth = A.LocalWidth()
 colShift = A.ColShift()
 rowShift = A.RowShift()
 colStride = A.ColStride()
 rowStride = A.RowStride()
-#for jLocal in xrange(0,localWidth):
-#  j = rowShift + jLocal*rowStride
-#  for iLocal in xrange(0,localHeight):
-#    i = colShift + iLocal*colStride
-#    A.SetLocal(iLocal,jLocal,i-j)
-data = A.Data()
-ldim = A.LDim()
-for jLocal in xrange(0,localWidth):
+
+# View the local entries of A without copying them
+data = numpy.asarray( A )
+for jLocal in range(0,A.LocalWidth()):
   j = rowShift + jLocal*rowStride
-  for iLocal in xrange(0,localHeight):
+  for iLocal in range(0,A.LocalHeight()):
     i = colShift + iLocal*colStride
-    data[iLocal+jLocal*ldim] = i-j
+    data[iLocal,jLocal] = i-j
 A.Print("Original A")
 
+# Views must be released before A can be reallocated
+del data
+
 rank = grid.Rank()
 if rank == 0:
-  print "Running SVD..."
-[s,V] = elem.SVD(A)
+  print("Running SVD...")
+s, V = elem.SVD(A)
 
 A.Print("U")
 s.Print("s")
 V.Print("V")
 
-elem.UniformDistMat( A, 8, 8 )
+elem.Uniform( A, 8, 8 )
 A.Print("New A")
 
 if rank == 0:
-  print "Running QR..."
+  print("Running QR...")
 R = elem.ExplicitQR(A)
 
 A.Print("Q")
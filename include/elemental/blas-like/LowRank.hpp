@@ -0,0 +1,193 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef BLAS_LOWRANK_HPP
+#define BLAS_LOWRANK_HPP
+
+#include "elemental/blas-like/level1/Conjugate.hpp"
+#include "elemental/blas-like/level1/DiagonalScale.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// BLAS-like operations involving a LowRankDistMatrix, A = U diag(s) V^H,
+// which never form A explicitly. Each product is applied as a sequence of
+// skinny products through the rank-r inner dimension.
+//
+
+namespace elem {
+
+namespace low_rank {
+
+// Return the factors X and Y such that op(A) = X diag(s) Y^H, conjugating
+// into temporaries when op(A) = A^T = conj(V) diag(s) U^T
+template<typename T>
+inline void
+OrientedFactors
+( Orientation orientation, const LowRankDistMatrix<T>& A,
+  DistMatrix<T>& X, DistMatrix<T>& Y )
+{
+    if( orientation == NORMAL )
+    {
+        LockedView( X, A.LockedU() );
+        LockedView( Y, A.LockedV() );
+    }
+    else if( orientation == ADJOINT )
+    {
+        LockedView( X, A.LockedV() );
+        LockedView( Y, A.LockedU() );
+    }
+    else
+    {
+        Conjugate( A.LockedV(), X );
+        Conjugate( A.LockedU(), Y );
+    }
+}
+
+} // namespace low_rank
+
+// Y := alpha A + Y
+template<typename T>
+inline void
+Axpy( T alpha, const LowRankDistMatrix<T>& A, DistMatrix<T>& Y )
+{
+#ifndef RELEASE
+    PushCallStack("Axpy");
+    if( A.Height() != Y.Height() || A.Width() != Y.Width() )
+        throw std::logic_error("Nonconformal Axpy");
+    if( A.Grid() != Y.Grid() )
+        throw std::logic_error("A and Y must be distributed over same grid");
+#endif
+    if( A.Rank() > 0 )
+    {
+        DistMatrix<T> US( A.Grid() );
+        US = A.LockedU();
+        DiagonalScale( RIGHT, NORMAL, A.LockedS(), US );
+        Gemm( NORMAL, ADJOINT, alpha, US, A.LockedV(), T(1), Y );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T>
+inline void
+Axpy
+( typename Base<T>::type alpha,
+  const LowRankDistMatrix<T>& A, DistMatrix<T>& Y )
+{ Axpy( T(alpha), A, Y ); }
+
+// A := alpha A, which only modifies the left factor
+template<typename T>
+inline void
+Scale( T alpha, LowRankDistMatrix<T>& A )
+{ Scale( alpha, A.U() ); }
+
+template<typename T>
+inline void
+Scale( typename Base<T>::type alpha, LowRankDistMatrix<T>& A )
+{ Scale( T(alpha), A.U() ); }
+
+// C := alpha op(A) op(B) + beta C, where A is low-rank
+template<typename T>
+inline void
+Gemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const LowRankDistMatrix<T>& A, const DistMatrix<T>& B,
+  T beta,                                       DistMatrix<T>& C )
+{
+#ifndef RELEASE
+    PushCallStack("Gemm");
+    const int aInner =
+        ( orientationOfA==NORMAL ? A.Width() : A.Height() );
+    const int bInner =
+        ( orientationOfB==NORMAL ? B.Height() : B.Width() );
+    if( aInner != bInner )
+        throw std::logic_error("Nonconformal Gemm");
+#endif
+    const Grid& g = A.Grid();
+    if( A.Rank() == 0 )
+        Scale( beta, C );
+    else
+    {
+        // op(A) op(B) = X (diag(s) (Y^H op(B)))
+        DistMatrix<T> X( g ), Y( g ), Z( g );
+        low_rank::OrientedFactors( orientationOfA, A, X, Y );
+        const int k =
+            ( orientationOfB==NORMAL ? B.Width() : B.Height() );
+        Zeros( A.Rank(), k, Z );
+        Gemm( ADJOINT, orientationOfB, T(1), Y, B, T(0), Z );
+        DiagonalScale( LEFT, NORMAL, A.LockedS(), Z );
+        Gemm( NORMAL, NORMAL, alpha, X, Z, beta, C );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// C := alpha op(A) op(B) + beta C, where B is low-rank
+template<typename T>
+inline void
+Gemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DistMatrix<T>& A, const LowRankDistMatrix<T>& B,
+  T beta,                                DistMatrix<T>& C )
+{
+#ifndef RELEASE
+    PushCallStack("Gemm");
+    const int aInner =
+        ( orientationOfA==NORMAL ? A.Width() : A.Height() );
+    const int bInner =
+        ( orientationOfB==NORMAL ? B.Height() : B.Width() );
+    if( aInner != bInner )
+        throw std::logic_error("Nonconformal Gemm");
+#endif
+    const Grid& g = A.Grid();
+    if( B.Rank() == 0 )
+        Scale( beta, C );
+    else
+    {
+        // op(A) op(B) = ((op(A) X) diag(s)) Y^H
+        DistMatrix<T> X( g ), Y( g ), Z( g );
+        low_rank::OrientedFactors( orientationOfB, B, X, Y );
+        const int m =
+            ( orientationOfA==NORMAL ? A.Height() : A.Width() );
+        Zeros( m, B.Rank(), Z );
+        Gemm( orientationOfA, NORMAL, T(1), A, X, T(0), Z );
+        DiagonalScale( RIGHT, NORMAL, B.LockedS(), Z );
+        Gemm( NORMAL, ADJOINT, alpha, Z, Y, beta, C );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// y := alpha op(A) x + beta y, where x and y are column vectors
+template<typename T>
+inline void
+Gemv
+( Orientation orientation,
+  T alpha, const LowRankDistMatrix<T>& A, const DistMatrix<T>& x,
+  T beta,                                       DistMatrix<T>& y )
+{
+#ifndef RELEASE
+    PushCallStack("Gemv");
+    if( x.Width() != 1 || y.Width() != 1 )
+        throw std::logic_error("x and y must be column vectors");
+#endif
+    Gemm( orientation, NORMAL, alpha, A, x, beta, y );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
+
+#endif // ifndef BLAS_LOWRANK_HPP
@@ -17,5 +17,6 @@
 #include "./blas-like/level1.hpp"
 #include "./blas-like/level2.hpp"
 #include "./blas-like/level3.hpp"
+#include "./blas-like/LowRank.hpp"
 
 #endif // ifndef BLAS_IMPL_HPP
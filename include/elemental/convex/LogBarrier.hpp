@@ -74,6 +74,66 @@ LogBarrier( UpperOrLower uplo, DistMatrix<F>& A, bool canOverwrite=false )
     return barrier;
 }
 
+//
+// Versions which accept the Cholesky factor of A, stored in the uplo
+// triangle of CA, so that -log(det(A)) = -2 sum_i log(CA(i,i)) only requires
+// a sweep over the locally owned diagonal entries
+//
+
+template<typename F>
+inline typename Base<F>::type
+FactoredLogBarrier( UpperOrLower uplo, const Matrix<F>& CA )
+{
+#ifndef RELEASE
+    PushCallStack("FactoredLogBarrier");
+    if( CA.Height() != CA.Width() )
+        throw std::logic_error("CA must be square");
+#endif
+    typedef typename Base<F>::type R;
+    const int n = CA.Height();
+    R barrier = 0;
+    for( int j=0; j<n; ++j )
+        barrier -= 2*Log( RealPart(CA.Get(j,j)) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return barrier;
+}
+
+template<typename F>
+inline typename Base<F>::type
+FactoredLogBarrier( UpperOrLower uplo, const DistMatrix<F>& CA )
+{
+#ifndef RELEASE
+    PushCallStack("FactoredLogBarrier");
+    if( CA.Height() != CA.Width() )
+        throw std::logic_error("CA must be square");
+#endif
+    typedef typename Base<F>::type R;
+    const int localWidth = CA.LocalWidth();
+    const int colShift = CA.ColShift();
+    const int rowShift = CA.RowShift();
+    const int colStride = CA.ColStride();
+    const int rowStride = CA.RowStride();
+    R localBarrier = 0;
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        if( j >= colShift && (j-colShift) % colStride == 0 )
+        {
+            const int iLocal = (j-colShift) / colStride;
+            localBarrier -= 2*Log( RealPart(CA.GetLocal(iLocal,jLocal)) );
+        }
+    }
+    R barrier;
+    mpi::AllReduce
+    ( &localBarrier, &barrier, 1, mpi::SUM, CA.Grid().VCComm() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return barrier;
+}
+
 } // namespace elem
 
 #endif // ifndef CONVEX_LOGBARRIER_HPP
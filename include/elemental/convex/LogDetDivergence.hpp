@@ -18,6 +18,111 @@
 
 namespace elem {
 
+namespace log_det_div {
+
+//
+// Given the Cholesky factors of A and B, overwrite the factor of A with the
+// triangular matrix Z, where
+//
+//   A B^{-1} = Z Z^H, Z = L_B^{-1} L_A,   if uplo == LOWER,
+//   B^{-1} A = Z^H Z, Z = U_A U_B^{-1},   if uplo == UPPER,
+//
+// so that, in both cases, tr(A B^{-1}) = || Z ||_F^2.
+//
+template<typename F>
+inline void
+FormZ( UpperOrLower uplo, const Matrix<F>& CB, Matrix<F>& CA )
+{
+    if( uplo == LOWER )
+        Trtrsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), CB, CA );
+    else
+    {
+        MakeTriangular( UPPER, CA );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), CB, CA );
+    }
+}
+
+template<typename F>
+inline void
+FormZ( UpperOrLower uplo, const DistMatrix<F>& CB, DistMatrix<F>& CA )
+{
+    if( uplo == LOWER )
+        Trtrsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), CB, CA );
+    else
+    {
+        MakeTriangular( UPPER, CA );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), CB, CA );
+    }
+}
+
+//
+// Return || Z ||_F^2 - log(det(Z Z^H)) - n from a single sweep over the
+// uplo triangle of Z, which is assumed to be triangular, so that neither
+// the opposite triangle nor a copy of the diagonal is ever formed
+//
+template<typename F>
+inline typename Base<F>::type
+FromZ( UpperOrLower uplo, const Matrix<F>& Z )
+{
+    typedef typename Base<F>::type R;
+    const int n = Z.Height();
+    const int ldim = Z.LDim();
+    const F* ZBuffer = Z.LockedBuffer();
+    R frobNormSquared = 0, logDet = 0;
+    for( int j=0; j<n; ++j )
+    {
+        const int iBeg = ( uplo==LOWER ? j : 0 );
+        const int iEnd = ( uplo==LOWER ? n : j+1 );
+        for( int i=iBeg; i<iEnd; ++i )
+        {
+            const F zeta = ZBuffer[i+j*ldim];
+            const R zetaAbs = Abs(zeta);
+            frobNormSquared += zetaAbs*zetaAbs;
+        }
+        logDet += 2*Log( RealPart(ZBuffer[j+j*ldim]) );
+    }
+    return frobNormSquared - logDet - R(n);
+}
+
+template<typename F>
+inline typename Base<F>::type
+FromZ( UpperOrLower uplo, const DistMatrix<F>& Z )
+{
+    typedef typename Base<F>::type R;
+    const int n = Z.Height();
+    const int localWidth = Z.LocalWidth();
+    const int colShift = Z.ColShift();
+    const int rowShift = Z.RowShift();
+    const int colStride = Z.ColStride();
+    const int rowStride = Z.RowStride();
+    const int ldim = Z.LDim();
+    const F* ZBuffer = Z.LockedBuffer();
+
+    // Accumulate [ || Z ||_F^2, log(det(Z Z^H)) ] locally
+    R localTerms[2] = { 0, 0 };
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        const int iLocalBeg =
+            ( uplo==LOWER ? Length_(j,colShift,colStride) : 0 );
+        const int iLocalEnd =
+            ( uplo==LOWER ? Z.LocalHeight() : Length_(j+1,colShift,colStride) );
+        const F* ZCol = &ZBuffer[jLocal*ldim];
+        for( int iLocal=iLocalBeg; iLocal<iLocalEnd; ++iLocal )
+        {
+            const R zetaAbs = Abs(ZCol[iLocal]);
+            localTerms[0] += zetaAbs*zetaAbs;
+            if( colShift+iLocal*colStride == j )
+                localTerms[1] += 2*Log( RealPart(ZCol[iLocal]) );
+        }
+    }
+    R terms[2];
+    mpi::AllReduce( localTerms, terms, 2, mpi::SUM, Z.Grid().VCComm() );
+    return terms[0] - terms[1] - R(n);
+}
+
+} // namespace log_det_div
+
 template<typename F>
 inline typename Base<F>::type 
 LogDetDivergence( UpperOrLower uplo, const Matrix<F>& A, const Matrix<F>& B )
@@ -29,34 +134,15 @@ LogDetDivergence( UpperOrLower uplo, const Matrix<F>& A, const Matrix<F>& B )
         A.Height() != B.Height() )
         throw std::logic_error
         ("A and B must be square matrices of the same size");
-
     typedef typename Base<F>::type R;
-    const int n = A.Height();
 
-    Matrix<F> ACopy( A ), BCopy( B );
+    Matrix<F> ACopy, BCopy;
+    ACopy = A;
+    BCopy = B;
     Cholesky( uplo, ACopy );
     Cholesky( uplo, BCopy );
-
-    if( uplo == LOWER )
-    {
-        Trtrsm( LEFT, uplo, NORMAL, NON_UNIT, F(1), BCopy, ACopy );
-    }
-    else
-    {
-        MakeTriangular( uplo, ACopy );
-        Trsm( LEFT, uplo, NORMAL, NON_UNIT, F(1), BCopy, ACopy );
-    }
-
-    MakeTriangular( uplo, ACopy );
-    const R frobNorm = FrobeniusNorm( ACopy );
-
-    Matrix<F> d;
-    ACopy.GetDiagonal( d );
-    R logDet(0);
-    for( int i=0; i<n; ++i )
-        logDet += 2*Log( RealPart(d.Get(i,0)) );
-
-    const R logDetDiv = frobNorm*frobNorm - logDet - R(n);
+    log_det_div::FormZ( uplo, BCopy, ACopy );
+    const R logDetDiv = log_det_div::FromZ( uplo, ACopy );
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -77,44 +163,141 @@ LogDetDivergence
         A.Height() != B.Height() )
         throw std::logic_error
         ("A and B must be square matrices of the same size");
-
     typedef typename Base<F>::type R;
-    const int n = A.Height();
     const Grid& g = A.Grid();
 
-    DistMatrix<F> ACopy( A ), BCopy( B );
+    DistMatrix<F> ACopy( g ), BCopy( g );
+    ACopy = A;
+    BCopy = B;
     Cholesky( uplo, ACopy );
     Cholesky( uplo, BCopy );
+    log_det_div::FormZ( uplo, BCopy, ACopy );
+    const R logDetDiv = log_det_div::FromZ( uplo, ACopy );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return logDetDiv;
+}
 
-    if( uplo == LOWER )
+//
+// Versions which accept the precomputed Cholesky factor of B, stored in the
+// uplo triangle of CB, so that B may be factored once and reused across
+// many evaluations. If canOverwrite is true, A is overwritten with
+// intermediate results rather than copied.
+//
+
+template<typename F>
+inline typename Base<F>::type 
+FactoredLogDetDivergence
+( UpperOrLower uplo, const Matrix<F>& A, const Matrix<F>& CB )
+{
+#ifndef RELEASE
+    PushCallStack("FactoredLogDetDivergence");
+#endif
+    if( A.Height() != A.Width() || CB.Height() != CB.Width() ||
+        A.Height() != CB.Height() )
+        throw std::logic_error
+        ("A and CB must be square matrices of the same size");
+    typedef typename Base<F>::type R;
+
+    Matrix<F> ACopy;
+    ACopy = A;
+    Cholesky( uplo, ACopy );
+    log_det_div::FormZ( uplo, CB, ACopy );
+    const R logDetDiv = log_det_div::FromZ( uplo, ACopy );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return logDetDiv;
+}
+
+template<typename F>
+inline typename Base<F>::type 
+FactoredLogDetDivergence
+( UpperOrLower uplo, Matrix<F>& A, const Matrix<F>& CB,
+  bool canOverwrite=false )
+{
+#ifndef RELEASE
+    PushCallStack("FactoredLogDetDivergence");
+#endif
+    typedef typename Base<F>::type R;
+    R logDetDiv;
+    if( canOverwrite )
     {
-        Trtrsm( LEFT, uplo, NORMAL, NON_UNIT, F(1), BCopy, ACopy );
+        if( A.Height() != A.Width() || CB.Height() != CB.Width() ||
+            A.Height() != CB.Height() )
+            throw std::logic_error
+            ("A and CB must be square matrices of the same size");
+        Cholesky( uplo, A );
+        log_det_div::FormZ( uplo, CB, A );
+        logDetDiv = log_det_div::FromZ( uplo, A );
     }
     else
     {
-        MakeTriangular( uplo, ACopy );
-        Trsm( LEFT, uplo, NORMAL, NON_UNIT, F(1), BCopy, ACopy );
+        const Matrix<F>& AConst = A;
+        logDetDiv = FactoredLogDetDivergence( uplo, AConst, CB );
     }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return logDetDiv;
+}
 
-    MakeTriangular( uplo, ACopy );
-    const R frobNorm = FrobeniusNorm( ACopy );
+template<typename F>
+inline typename Base<F>::type 
+FactoredLogDetDivergence
+( UpperOrLower uplo, const DistMatrix<F>& A, const DistMatrix<F>& CB )
+{
+#ifndef RELEASE
+    PushCallStack("FactoredLogDetDivergence");
+#endif
+    if( A.Grid() != CB.Grid() )
+        throw std::logic_error("A and CB must use the same grid");
+    if( A.Height() != A.Width() || CB.Height() != CB.Width() ||
+        A.Height() != CB.Height() )
+        throw std::logic_error
+        ("A and CB must be square matrices of the same size");
+    typedef typename Base<F>::type R;
 
-    R logDet;
-    R localLogDet(0);
-    DistMatrix<F,MD,STAR> d(g);
-    ACopy.GetDiagonal( d );
-    if( d.Participating() )
+    DistMatrix<F> ACopy( A.Grid() );
+    ACopy = A;
+    Cholesky( uplo, ACopy );
+    log_det_div::FormZ( uplo, CB, ACopy );
+    const R logDetDiv = log_det_div::FromZ( uplo, ACopy );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return logDetDiv;
+}
+
+template<typename F>
+inline typename Base<F>::type 
+FactoredLogDetDivergence
+( UpperOrLower uplo, DistMatrix<F>& A, const DistMatrix<F>& CB,
+  bool canOverwrite=false )
+{
+#ifndef RELEASE
+    PushCallStack("FactoredLogDetDivergence");
+#endif
+    typedef typename Base<F>::type R;
+    R logDetDiv;
+    if( canOverwrite )
     {
-        const int nLocalDiag = d.LocalHeight();
-        for( int iLocal=0; iLocal<nLocalDiag; ++iLocal )
-        {
-            const R delta = RealPart(d.GetLocal(iLocal,0));
-            localLogDet += 2*Log(delta);
-        }
+        if( A.Grid() != CB.Grid() )
+            throw std::logic_error("A and CB must use the same grid");
+        if( A.Height() != A.Width() || CB.Height() != CB.Width() ||
+            A.Height() != CB.Height() )
+            throw std::logic_error
+            ("A and CB must be square matrices of the same size");
+        Cholesky( uplo, A );
+        log_det_div::FormZ( uplo, CB, A );
+        logDetDiv = log_det_div::FromZ( uplo, A );
+    }
+    else
+    {
+        const DistMatrix<F>& AConst = A;
+        logDetDiv = FactoredLogDetDivergence( uplo, AConst, CB );
     }
-    mpi::AllReduce( &localLogDet, &logDet, 1, mpi::SUM, g.VCComm() );
-
-    const R logDetDiv = frobNorm*frobNorm - logDet - R(n);
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -0,0 +1,370 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CONVEX_RPCA_HPP
+#define CONVEX_RPCA_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/LowRank.hpp"
+#include "elemental/convex/SingularValueSoftThreshold.hpp"
+#include "elemental/convex/SoftThreshold.hpp"
+#include "elemental/lapack-like/LowRank.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/Norm/Max.hpp"
+#include "elemental/lapack-like/Norm/Two.hpp"
+#include "elemental/lapack-like/Norm/Zero.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// Robust Principal Component Analysis: decompose M = L + S, where L is
+// low-rank and S is sparse, by solving
+//
+//   min || L ||_* + tau || S ||_1  subject to  M = L + S
+//
+// with either the Alternating Direction Method of Multipliers (ADMM) or the
+// inexact Augmented Lagrange Multiplier (ALM) method. Please see
+// <http://perception.csl.illinois.edu/matrix-rank/sample_code.html>
+// for references and documentation.
+//
+// All of the dense m x n temporaries are allocated once and reused across
+// iterations. When ctrl.lowRankSVT is set, L is kept in factored form
+// between iterations, so that it is never formed until exit, and each
+// singular value soft-thresholding is warm-started from the previous one.
+//
+
+namespace elem {
+namespace rpca {
+
+// A := sign(A), entrywise, with sign(0) = 0
+template<typename F>
+inline void
+Sign( DistMatrix<F>& A )
+{
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const F alpha = A.GetLocal( iLocal, jLocal );
+            if( alpha != F(0) )
+                A.SetLocal( iLocal, jLocal, alpha/Abs(alpha) );
+        }
+    }
+}
+
+// Y := alpha L + Y, where L is the factored estimate once it exists and the
+// dense initial guess beforehand
+template<typename F>
+inline void
+AxpyL
+( F alpha, const DistMatrix<F>& L, const LowRankDistMatrix<F>& LFact,
+  bool factored, DistMatrix<F>& Y )
+{
+    if( factored )
+        Axpy( alpha, LFact, Y );
+    else
+        Axpy( alpha, L, Y );
+}
+
+// || A - B ||_F for two factored matrices, via the factors of their
+// (rank ra+rb) difference
+template<typename F>
+inline typename Base<F>::type
+DifferenceNorm( const LowRankDistMatrix<F>& A, const LowRankDistMatrix<F>& B )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+    const int ra = A.Rank();
+    const int rb = B.Rank();
+    DistMatrix<F> U( g ), V( g ), X( g );
+    DistMatrix<R,VR,STAR> s( g ), x( g );
+    Zeros( m, ra+rb, U );
+    Zeros( n, ra+rb, V );
+    Zeros( ra+rb, 1, s );
+    View( X, U, 0, 0, m, ra );  X = A.LockedU();
+    View( X, U, 0, ra, m, rb ); X = B.LockedU();
+    View( X, V, 0, 0, n, ra );  X = A.LockedV();
+    View( X, V, 0, ra, n, rb ); X = B.LockedV();
+    View( x, s, 0, 0, ra, 1 );  x = A.LockedS();
+    View( x, s, ra, 0, rb, 1 ); x = B.LockedS(); Scale( R(-1), x );
+    LowRankDistMatrix<F> D( g );
+    D.Set( U, s, V );
+    return FrobeniusNorm( D );
+}
+
+// L := SVT_{threshold}(T), overwriting T in the dense case
+template<typename F>
+inline int
+SVT
+( DistMatrix<F>& T, typename Base<F>::type threshold,
+  DistMatrix<F>& L, LowRankDistMatrix<F>& LFact,
+  const RPCACtrl<typename Base<F>::type>& ctrl )
+{
+    if( ctrl.lowRankSVT )
+        return SingularValueSoftThreshold
+               ( T, threshold, LFact, ctrl.numPowerIts, ctrl.oversample );
+    const int rank = SingularValueSoftThreshold( T, threshold );
+    L = T;
+    return rank;
+}
+
+template<typename F>
+inline void
+ADMM
+( const DistMatrix<F>& M, DistMatrix<F>& L, DistMatrix<F>& S,
+  const RPCACtrl<typename Base<F>::type>& ctrl,
+  RPCAInfo<typename Base<F>::type>& info )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = M.Grid();
+    const int m = M.Height();
+    const int n = M.Width();
+    const R tau = ( ctrl.tau == R(0) ? R(1)/Sqrt(R(std::max(m,n))) : ctrl.tau );
+    const R beta = ( ctrl.beta == R(0) ? R(1) : ctrl.beta );
+    if( beta < R(0) )
+        throw std::logic_error("beta cannot be negative");
+    if( tau < R(0) )
+        throw std::logic_error("tau cannot be negative");
+    const R frobM = FrobeniusNorm( M );
+
+    DistMatrix<F> E( g ), T( g ), Y( g );
+    LowRankDistMatrix<F> LFact( g );
+    Zeros( m, n, Y );
+    bool factored = false;
+    while( true )
+    {
+        ++info.numIts;
+        ++info.numPrimalIts;
+        const double startTime = mpi::Time();
+
+        // S := ST_{tau/beta}(M - L + Y/beta)
+        S = M;
+        AxpyL( F(-1), L, LFact, factored, S );
+        Axpy( F(1)/beta, Y, S );
+        SoftThreshold( S, tau/beta );
+        info.numNonzeros = ZeroNorm( S );
+        const double shrinkTime = mpi::Time();
+
+        // L := SVT_{1/beta}(M - S + Y/beta)
+        T = M;
+        Axpy( F(-1), S, T );
+        Axpy( F(1)/beta, Y, T );
+        info.rank = SVT( T, R(1)/beta, L, LFact, ctrl );
+        factored = ctrl.lowRankSVT;
+        const double svtTime = mpi::Time();
+
+        // E := M - (L + S)
+        E = M;
+        AxpyL( F(-1), L, LFact, factored, E );
+        Axpy( F(-1), S, E );
+        const R frobE = FrobeniusNorm( E );
+        info.residuals.push_back( frobE/frobM );
+        if( ctrl.progress && g.Rank() == 0 )
+            std::cout << info.numIts << ": || E ||_F / || M ||_F = "
+                      << frobE/frobM << ", rank=" << info.rank
+                      << ", numNonzeros=" << info.numNonzeros << std::endl;
+        info.converged = ( frobE/frobM <= ctrl.tol );
+        const bool done = info.converged || info.numIts >= ctrl.maxIts;
+        if( !done )
+        {
+            // Y := Y + beta E
+            Axpy( beta, E, Y );
+        }
+        const double endTime = mpi::Time();
+        info.shrinkTimes.push_back( shrinkTime-startTime );
+        info.svtTimes.push_back( svtTime-shrinkTime );
+        info.updateTimes.push_back( endTime-svtTime );
+        if( done )
+            break;
+    }
+    if( factored )
+    {
+        Zeros( m, n, L );
+        Axpy( F(1), LFact, L );
+    }
+}
+
+template<typename F>
+inline void
+ALM
+( const DistMatrix<F>& M, DistMatrix<F>& L, DistMatrix<F>& S,
+  const RPCACtrl<typename Base<F>::type>& ctrl,
+  RPCAInfo<typename Base<F>::type>& info )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = M.Grid();
+    const int m = M.Height();
+    const int n = M.Width();
+    const R tau = ( ctrl.tau == R(0) ? R(1)/Sqrt(R(std::max(m,n))) : ctrl.tau );
+    if( tau < R(0) )
+        throw std::logic_error("tau cannot be negative");
+    if( ctrl.rho < R(1) )
+        throw std::logic_error("rho must be at least one");
+    const R frobM = FrobeniusNorm( M );
+
+    // Y := sign(M) / max( || sign(M) ||_2, || sign(M) ||_max / tau )
+    DistMatrix<F> E( g ), T( g ), Y( g ), LLast( g ), SLast( g );
+    Y = M;
+    rpca::Sign( Y );
+    const R twoNorm = TwoNorm( Y );
+    const R maxNorm = MaxNorm( Y );
+    const R dualNorm = std::max( twoNorm, maxNorm/tau );
+    Scale( F(1)/dualNorm, Y );
+
+    // If beta is unspecified, set it to 1 / 2 || sign(M) ||_2
+    R beta = ( ctrl.beta == R(0) ? R(1)/(2*twoNorm) : ctrl.beta );
+    if( beta < R(0) )
+        throw std::logic_error("beta cannot be negative");
+
+    LowRankDistMatrix<F> LFact( g ), LFactLast( g );
+    bool factored = false;
+    bool done = false;
+    while( !done )
+    {
+        ++info.numIts;
+        while( true )
+        {
+            ++info.numPrimalIts;
+            const double startTime = mpi::Time();
+            const bool wasFactored = factored;
+            if( !ctrl.lowRankSVT )
+                LLast = L;
+            else if( wasFactored )
+                LFactLast = LFact;
+            SLast = S;
+
+            // S := ST_{tau/beta}(M - L + Y/beta)
+            S = M;
+            AxpyL( F(-1), L, LFact, factored, S );
+            Axpy( F(1)/beta, Y, S );
+            SoftThreshold( S, tau/beta );
+            info.numNonzeros = ZeroNorm( S );
+            const double shrinkTime = mpi::Time();
+
+            // L := SVT_{1/beta}(M - S + Y/beta)
+            T = M;
+            Axpy( F(-1), S, T );
+            Axpy( F(1)/beta, Y, T );
+            info.rank = SVT( T, R(1)/beta, L, LFact, ctrl );
+            factored = ctrl.lowRankSVT;
+            const double svtTime = mpi::Time();
+
+            R frobLDiff;
+            if( !ctrl.lowRankSVT )
+            {
+                Axpy( F(-1), L, LLast );
+                frobLDiff = FrobeniusNorm( LLast );
+            }
+            else if( wasFactored )
+                frobLDiff = DifferenceNorm( LFact, LFactLast );
+            else
+            {
+                T = L;
+                Axpy( F(-1), LFact, T );
+                frobLDiff = FrobeniusNorm( T );
+            }
+            Axpy( F(-1), S, SLast );
+            const R frobSDiff = FrobeniusNorm( SLast );
+            const double endTime = mpi::Time();
+            info.shrinkTimes.push_back( shrinkTime-startTime );
+            info.svtTimes.push_back( svtTime-shrinkTime );
+            info.updateTimes.push_back( endTime-svtTime );
+
+            if( frobLDiff/frobM < ctrl.tol && frobSDiff/frobM < ctrl.tol )
+                break;
+            if( info.numPrimalIts >= ctrl.maxIts )
+            {
+                done = true;
+                break;
+            }
+        }
+
+        // E := M - (L + S)
+        const double startTime = mpi::Time();
+        E = M;
+        AxpyL( F(-1), L, LFact, factored, E );
+        Axpy( F(-1), S, E );
+        const R frobE = FrobeniusNorm( E );
+        info.residuals.push_back( frobE/frobM );
+        if( ctrl.progress && g.Rank() == 0 )
+            std::cout << info.numIts << ": || E ||_F / || M ||_F = "
+                      << frobE/frobM << ", rank=" << info.rank
+                      << ", numNonzeros=" << info.numNonzeros << std::endl;
+        info.converged = ( frobE/frobM <= ctrl.tol );
+        done = done || info.converged || info.numIts >= ctrl.maxIts;
+        if( !done )
+        {
+            // Y := Y + beta E
+            Axpy( beta, E, Y );
+            beta *= ctrl.rho;
+        }
+        info.updateTimes.back() += mpi::Time()-startTime;
+    }
+    if( factored )
+    {
+        Zeros( m, n, L );
+        Axpy( F(1), LFact, L );
+    }
+}
+
+} // namespace rpca
+
+//
+// Decompose M into L + S, where L is low-rank and S is sparse. Unless
+// ctrl.warmStart is set, L and S are initialized to zero.
+//
+template<typename F>
+inline RPCAInfo<typename Base<F>::type>
+RPCA
+( const DistMatrix<F>& M, DistMatrix<F>& L, DistMatrix<F>& S,
+  const RPCACtrl<typename Base<F>::type>& ctrl=
+        RPCACtrl<typename Base<F>::type>() )
+{
+#ifndef RELEASE
+    PushCallStack("RPCA");
+    if( M.Grid() != L.Grid() || M.Grid() != S.Grid() )
+        throw std::logic_error("M, L, and S must share the same grid");
+#endif
+    typedef typename Base<F>::type R;
+    if( ctrl.tol <= R(0) )
+        throw std::logic_error("tol must be positive");
+    const int m = M.Height();
+    const int n = M.Width();
+    if( !ctrl.warmStart )
+    {
+        Zeros( m, n, L );
+        Zeros( m, n, S );
+    }
+    else if( L.Height() != m || L.Width() != n ||
+             S.Height() != m || S.Width() != n )
+        throw std::logic_error("Warm-started L and S must be the size of M");
+
+    RPCAInfo<R> info;
+    info.converged = false;
+    info.numIts = 0;
+    info.numPrimalIts = 0;
+    info.rank = 0;
+    info.numNonzeros = 0;
+    if( ctrl.approach == RPCA_ADMM )
+        rpca::ADMM( M, L, S, ctrl, info );
+    else
+        rpca::ALM( M, L, S, ctrl, info );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return info;
+}
+
+} // namespace elem
+
+#endif // ifndef CONVEX_RPCA_HPP
@@ -11,8 +11,13 @@
 #define CONVEX_SINGULARVALUESOFTTHRESHOLD_HPP
 
 #include "elemental/blas-like/level1/DiagonalScale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Norm/Zero.hpp"
+#include "elemental/lapack-like/QR.hpp"
 #include "elemental/lapack-like/SVD.hpp"
 #include "elemental/convex/SoftThreshold.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
 
 namespace elem {
 
@@ -24,8 +29,9 @@ SingularValueSoftThreshold( Matrix<F>& A, typename Base<F>::type tau )
     PushCallStack("SingularValueSoftThreshold");
 #endif
     typedef typename Base<F>::type R;
-    Matrix<F> U( A );
+    Matrix<F> U;
     Matrix<R> s;
+    U = A;
     Matrix<F> V;
 
     // TODO: Exploit zeros in soft-thresholded singular values (with custom SVD)
@@ -49,8 +55,9 @@ SingularValueSoftThreshold( DistMatrix<F>& A, typename Base<F>::type tau )
     PushCallStack("SingularValueSoftThreshold");
 #endif
     typedef typename Base<F>::type R;
-    DistMatrix<F> U( A );
+    DistMatrix<F> U( A.Grid() );
     DistMatrix<R,VR,STAR> s( A.Grid() );
+    U = A;
     DistMatrix<F> V( A.Grid() );
 
     svd::Thresholded( U, s, V, tau );
@@ -65,6 +72,279 @@ SingularValueSoftThreshold( DistMatrix<F>& A, typename Base<F>::type tau )
     return rank;
 }
 
+//
+// Low-rank variants which only compute the singular triplets with singular
+// values above tau, and which return the thresholded factors, 
+//
+//   A := U diag(s) V^H,
+//
+// where s has already been soft-thresholded. The right singular subspace is
+// approximated with randomized subspace iteration, started from the columns
+// of V on entry (e.g., the V returned by the previous call within an
+// iterative method such as RPCA) along with 'oversample' random vectors. If
+// every computed singular value exceeds tau, the subspace is doubled until
+// either a singular value is below tau or the subspace spans all of A.
+// The cost is therefore proportional to the rank of the result rather than
+// to min(m,n).
+//
+
+namespace svt {
+
+// Fill the n x k matrix Omega with the (leading columns of the) warm-start
+// basis followed by random vectors
+template<typename F>
+inline void
+StartingBasis( const Matrix<F>& V, int n, int k, Matrix<F>& Omega )
+{
+    Uniform( n, k, Omega );
+    if( V.Height() == n )
+    {
+        const int kWarm = std::min( V.Width(), k );
+        Matrix<F> VL, OmegaL;
+        LockedView( VL, V, 0, 0, n, kWarm );
+        View( OmegaL, Omega, 0, 0, n, kWarm );
+        OmegaL = VL;
+    }
+}
+
+template<typename F>
+inline void
+StartingBasis( const DistMatrix<F>& V, int n, int k, DistMatrix<F>& Omega )
+{
+    const Grid& g = V.Grid();
+    Uniform( n, k, Omega );
+    if( V.Height() == n )
+    {
+        const int kWarm = std::min( V.Width(), k );
+        DistMatrix<F> VL( g ), OmegaL( g );
+        LockedView( VL, V, 0, 0, n, kWarm );
+        View( OmegaL, Omega, 0, 0, n, kWarm );
+        OmegaL = VL;
+    }
+}
+
+// Overwrite Q with an orthonormal basis for the range of A Omega, using the 
+// requested number of power iterations, and form B^H := A^H Q
+template<typename F>
+inline void
+RangeFinder
+( const Matrix<F>& A, const Matrix<F>& Omega, 
+  Matrix<F>& Q, Matrix<F>& BAdj, int numPowerIts )
+{
+    const int m = A.Height();
+    const int n = A.Width();
+    const int k = Omega.Width();
+    Zeros( m, k, Q );
+    Gemm( NORMAL, NORMAL, F(1), A, Omega, F(0), Q );
+    qr::Explicit( Q );
+    for( int it=0; it<numPowerIts; ++it )
+    {
+        Zeros( n, k, BAdj );
+        Gemm( ADJOINT, NORMAL, F(1), A, Q, F(0), BAdj );
+        qr::Explicit( BAdj );
+        Gemm( NORMAL, NORMAL, F(1), A, BAdj, F(0), Q );
+        qr::Explicit( Q );
+    }
+    Zeros( n, k, BAdj );
+    Gemm( ADJOINT, NORMAL, F(1), A, Q, F(0), BAdj );
+}
+
+template<typename F>
+inline void
+RangeFinder
+( const DistMatrix<F>& A, const DistMatrix<F>& Omega, 
+  DistMatrix<F>& Q, DistMatrix<F>& BAdj, int numPowerIts )
+{
+    const int m = A.Height();
+    const int n = A.Width();
+    const int k = Omega.Width();
+    Zeros( m, k, Q );
+    Gemm( NORMAL, NORMAL, F(1), A, Omega, F(0), Q );
+    qr::Explicit( Q );
+    for( int it=0; it<numPowerIts; ++it )
+    {
+        Zeros( n, k, BAdj );
+        Gemm( ADJOINT, NORMAL, F(1), A, Q, F(0), BAdj );
+        qr::Explicit( BAdj );
+        Gemm( NORMAL, NORMAL, F(1), A, BAdj, F(0), Q );
+        qr::Explicit( Q );
+    }
+    Zeros( n, k, BAdj );
+    Gemm( ADJOINT, NORMAL, F(1), A, Q, F(0), BAdj );
+}
+
+} // namespace svt
+
+template<typename F>
+inline int
+SingularValueSoftThreshold
+( Matrix<F>& A, typename Base<F>::type tau,
+  Matrix<F>& U, Matrix<typename Base<F>::type>& s, Matrix<F>& V,
+  int numPowerIts=1, int oversample=10 )
+{
+#ifndef RELEASE
+    PushCallStack("SingularValueSoftThreshold");
+    if( oversample < 1 )
+        throw std::logic_error("Oversampling must be positive");
+#endif
+    typedef typename Base<F>::type R;
+    const int m = A.Height();
+    const int n = A.Width();
+    const int minDim = std::min(m,n);
+    const int kWarm = ( V.Height() == n ? V.Width() : 0 );
+    int k = std::min( kWarm+oversample, minDim );
+
+    Matrix<F> Omega, Q, BAdj, Y;
+    int rank;
+    while( true )
+    {
+        // A ~= Q Q^H A = Q (X diag(s) Y^H)^H = (Q Y) diag(s) X^H
+        svt::StartingBasis( V, n, k, Omega );
+        svt::RangeFinder( A, Omega, Q, BAdj, numPowerIts );
+        SVD( BAdj, s, Y );
+        SoftThreshold( s, tau );
+        rank = ZeroNorm( s );
+        if( rank < k || k == minDim )
+            break;
+        // Every singular value was above the threshold: warm-start a larger
+        // subspace with the current estimate of the right singular vectors
+        V = BAdj;
+        k = std::min( 2*k, minDim );
+    }
+
+    // Keep the leading 'rank' triplets
+    Matrix<F> YL, XL;
+    Matrix<R> sT;
+    LockedView( YL, Y, 0, 0, k, rank );
+    LockedView( XL, BAdj, 0, 0, n, rank );
+    Zeros( m, rank, U );
+    Gemm( NORMAL, NORMAL, F(1), Q, YL, F(0), U );
+    V = XL;
+    LockedView( sT, s, 0, 0, rank, 1 );
+    Matrix<R> sCopy;
+    sCopy = sT;
+    s = sCopy;
+
+    // A := (U diag(s)) V^H, with an inner dimension of only 'rank'
+    Matrix<F> US;
+    US = U;
+    DiagonalScale( RIGHT, NORMAL, s, US );
+    Zeros( m, n, A );
+    if( rank > 0 )
+        Gemm( NORMAL, ADJOINT, F(1), US, V, F(0), A );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return rank;
+}
+
+namespace svt {
+
+// Compute the soft-thresholded factors without modifying A
+template<typename F>
+inline int
+LowRank
+( const DistMatrix<F>& A, typename Base<F>::type tau,
+  DistMatrix<F>& U, DistMatrix<typename Base<F>::type,VR,STAR>& s, 
+  DistMatrix<F>& V, int numPowerIts, int oversample )
+{
+    typedef typename Base<F>::type R;
+    if( oversample < 1 )
+        throw std::logic_error("Oversampling must be positive");
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+    const int minDim = std::min(m,n);
+    const int kWarm = ( V.Height() == n ? V.Width() : 0 );
+    int k = std::min( kWarm+oversample, minDim );
+
+    DistMatrix<F> Omega( g ), Q( g ), BAdj( g ), Y( g );
+    int rank;
+    while( true )
+    {
+        // A ~= Q Q^H A = Q (X diag(s) Y^H)^H = (Q Y) diag(s) X^H
+        StartingBasis( V, n, k, Omega );
+        RangeFinder( A, Omega, Q, BAdj, numPowerIts );
+        SVD( BAdj, s, Y );
+        SoftThreshold( s, tau );
+        rank = ZeroNorm( s );
+        if( rank < k || k == minDim )
+            break;
+        // Every singular value was above the threshold: warm-start a larger
+        // subspace with the current estimate of the right singular vectors
+        V = BAdj;
+        k = std::min( 2*k, minDim );
+    }
+
+    // Keep the leading 'rank' triplets
+    DistMatrix<F> YL( g ), XL( g );
+    DistMatrix<R,VR,STAR> sT( g ), sCopy( g );
+    LockedView( YL, Y, 0, 0, k, rank );
+    LockedView( XL, BAdj, 0, 0, n, rank );
+    Zeros( m, rank, U );
+    Gemm( NORMAL, NORMAL, F(1), Q, YL, F(0), U );
+    V.Empty();
+    V = XL;
+    LockedView( sT, s, 0, 0, rank, 1 );
+    sCopy = sT;
+    s.Empty();
+    s = sCopy;
+    return rank;
+}
+
+} // namespace svt
+
+template<typename F>
+inline int
+SingularValueSoftThreshold
+( DistMatrix<F>& A, typename Base<F>::type tau,
+  DistMatrix<F>& U, DistMatrix<typename Base<F>::type,VR,STAR>& s, 
+  DistMatrix<F>& V, int numPowerIts=1, int oversample=10 )
+{
+#ifndef RELEASE
+    PushCallStack("SingularValueSoftThreshold");
+#endif
+    const int rank = 
+        svt::LowRank( A, tau, U, s, V, numPowerIts, oversample );
+
+    // A := (U diag(s)) V^H, with an inner dimension of only 'rank'
+    DistMatrix<F> US( A.Grid() );
+    US = U;
+    DiagonalScale( RIGHT, NORMAL, s, US );
+    Zeros( A.Height(), A.Width(), A );
+    if( rank > 0 )
+        Gemm( NORMAL, ADJOINT, F(1), US, V, F(0), A );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return rank;
+}
+
+// Return the result in the factored form L, whose previous right factor is
+// used as the warm start, and leave A unmodified
+template<typename F>
+inline int
+SingularValueSoftThreshold
+( const DistMatrix<F>& A, typename Base<F>::type tau, 
+  LowRankDistMatrix<F>& L, int numPowerIts=1, int oversample=10 )
+{
+#ifndef RELEASE
+    PushCallStack("SingularValueSoftThreshold");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    DistMatrix<F> U( g ), V( g );
+    DistMatrix<R,VR,STAR> s( g );
+    V = L.LockedV();
+    const int rank = 
+        svt::LowRank( A, tau, U, s, V, numPowerIts, oversample );
+    L.Set( U, s, V );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return rank;
+}
+
 } // namespace elem
 
 #endif // ifndef CONVEX_SINGULARVALUESOFTTHRESHOLD_HPP
@@ -12,7 +12,52 @@
 
 namespace elem {
 
-// No reason to put anything here, yet
+namespace rpca_approach_wrapper {
+enum RPCAApproach
+{
+    RPCA_ADMM, // Alternating Direction Method of Multipliers
+    RPCA_ALM   // (inexact) Augmented Lagrange Multipliers
+};
+}
+using namespace rpca_approach_wrapper;
+
+// Control parameters for RPCA. A zero beta or tau is replaced with the 
+// standard estimate.
+template<typename R>
+struct RPCACtrl
+{
+    RPCAApproach approach;
+    R beta, tau, rho, tol;
+    int maxIts;
+    // Start from the L and S passed in rather than from zero
+    bool warmStart;
+    // Use the randomized, warm-started low-rank singular value 
+    // soft-thresholding and keep the low-rank estimate in factored form
+    bool lowRankSVT;
+    int numPowerIts, oversample;
+    // Print the residual after each iteration
+    bool progress;
+
+    RPCACtrl()
+    : approach(RPCA_ALM), beta(0), tau(0), rho(6), tol(1e-6), maxIts(1000),
+      warmStart(false), lowRankSVT(true), numPowerIts(1), oversample(10),
+      progress(false)
+    { }
+};
+
+// Convergence history of RPCA. ADMM performs one primal update of L and S 
+// per iteration, while ALM performs several before each dual update.
+template<typename R>
+struct RPCAInfo
+{
+    bool converged;
+    int numIts, numPrimalIts, rank, numNonzeros;
+    // || M - (L + S) ||_F / || M ||_F after each iteration
+    std::vector<R> residuals;
+    // Seconds spent by each primal update in the entrywise soft-thresholding
+    // of S, the singular value soft-thresholding of L, and everything else
+    std::vector<double> shrinkTimes, svtTimes, updateTimes;
+};
 
 } // namespace elem
 
@@ -12,6 +12,7 @@
 
 #include "elemental/convex/LogBarrier.hpp"
 #include "elemental/convex/LogDetDivergence.hpp"
+#include "elemental/convex/RPCA.hpp"
 #include "elemental/convex/SingularValueSoftThreshold.hpp"
 #include "elemental/convex/SoftThreshold.hpp"
 
@@ -18,6 +18,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
+#include <deque>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -109,6 +110,14 @@
 #include "elemental/core/random_impl.hpp"
 #include "elemental/core/axpy_interface_decl.hpp"
 #include "elemental/core/axpy_interface_impl.hpp"
+#include "elemental/core/ingest_interface_decl.hpp"
+#include "elemental/core/ingest_interface_impl.hpp"
+#include "elemental/core/low_rank_dist_matrix_decl.hpp"
+#include "elemental/core/low_rank_dist_matrix_impl.hpp"
+#include "elemental/core/checkpoint_decl.hpp"
+#include "elemental/core/mapped_matrix_decl.hpp"
+#include "elemental/core/task_graph_decl.hpp"
+#include "elemental/core/task_graph_impl.hpp"
 
 #include "elemental/core/ReduceComm.hpp"
 
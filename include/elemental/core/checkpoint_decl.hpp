@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_CHECKPOINT_DECL_HPP
+#define CORE_CHECKPOINT_DECL_HPP
+
+namespace elem {
+
+// A directory of named distributed matrices and real scalars which can be
+// used to restart long computations. Each matrix is stored as a binary shard
+// in the format of AutoDistMatrix::WriteBinary, so that it can be reloaded
+// with any distribution over a grid of any size or shape.
+//
+// The shards of a checkpoint are written asynchronously: Save copies the
+// local entries into a private buffer and starts a nonblocking write, so the
+// matrix may be modified immediately, and the manifest which makes the new
+// checkpoint visible is only written once every shard has drained (in Wait,
+// or in the next call to Begin). Until then, the previous checkpoint remains
+// valid. All of the routines are collective over the viewing communicator of
+// the grid, and so Wait must be called before destruction: the destructor
+// does not communicate and discards any checkpoint which is still pending.
+class Checkpoint
+{
+public:
+    Checkpoint( const std::string directory, const Grid& grid=DefaultGrid() );
+    ~Checkpoint();
+
+    // Saving
+    void Begin();
+    void Save( const std::string name, const AutoDistMatrix<int>& A );
+    void SetScalar( const std::string name, double value );
+    void End();
+    void Wait();
+    bool Pending() const;
+
+    // Restarting from the last committed checkpoint
+    bool Exists() const;
+    int Epoch() const;
+    bool Contains( const std::string name ) const;
+    void Load( const std::string name, AutoDistMatrix<int>& A ) const;
+    double Scalar( const std::string name ) const;
+
+private:
+    struct ShardWrite
+    {
+        mpi::File fh;
+        mpi::Datatype elemType, fileType;
+        mpi::Request request;
+        bool writing;
+        std::vector<byte> buffer;
+    };
+
+    std::string directory_;
+    mpi::Comm comm_;
+
+    // The last committed checkpoint
+    int epoch_;
+    std::vector<std::string> names_;
+    std::vector<std::pair<std::string,double> > scalars_;
+
+    // The checkpoint being written
+    bool begun_, ended_;
+    std::vector<std::string> newNames_;
+    std::vector<std::pair<std::string,double> > newScalars_;
+    std::vector<ShardWrite*> pending_;
+
+    std::string ManifestName() const;
+    std::string ShardName( const std::string name, int epoch ) const;
+    void ReadManifest();
+    void Commit();
+
+    // Disable copying due to the pending MPI requests and files
+    Checkpoint( const Checkpoint& );
+    const Checkpoint& operator=( const Checkpoint& );
+};
+
+} // namespace elem
+
+#endif // ifndef CORE_CHECKPOINT_DECL_HPP
@@ -20,6 +20,8 @@ public:
 	typedef AbstractDistMatrix<T,Int> Self;
 	typedef AutoDistMatrix<Int> Parent;
 	typedef AutoDistMatrix<Int> Auto;
+	typedef MatrixIterator<T,Int> Iterator;
+	typedef MatrixIterator<const T,Int> ConstIterator;
 	
 	ScalarTypes DataType() const;
     virtual Distribution RowDist() const = 0;
@@ -35,6 +37,13 @@ public:
           elem::Matrix<T,Int>& Matrix();
     const elem::Matrix<T,Int>& LockedMatrix() const;
 
+    // Iterate over the local entries, where Row() and Col() of the iterator
+    // return the global indices of the current entry
+    Iterator Begin();
+    Iterator End();
+    ConstIterator LockedBegin() const;
+    ConstIterator LockedEnd() const;
+
 	template <Distribution U,Distribution V> DistMatrix<T,U,V,Int>& Cast();
 	template <Distribution U,Distribution V> const DistMatrix<T,U,V,Int>& Cast() const;
 	
@@ -111,6 +120,11 @@ protected:
     
     friend class AutoDistMatrix<Int>;
     void CopyFrom_( const Auto& A ); // virtual implementation
+
+    // The root gathers the entries of one replica of each local matrix, one
+    // panel of rows at a time, rather than reducing a dense copy of A
+    void PrintBase( std::ostream& os, const std::string msg ) const;
+    void PrintSummaryBase( std::ostream& os, const std::string msg ) const;
     
     virtual const Self& operator=( const DistMatrix<T,MC,MR,Int>&     A ) = 0;
     virtual const Self& operator=( const DistMatrix<T,MC,STAR,Int>&   A ) = 0;
@@ -48,6 +48,47 @@ template<typename T,typename Int> inline
 const T* AbstractDistMatrix<T,Int>::LockedBuffer( Int iLocal, Int jLocal ) const
 { return matrix_.LockedBuffer(iLocal,jLocal); }
 
+template<typename T,typename Int> inline
+MatrixIterator<T,Int> AbstractDistMatrix<T,Int>::Begin()
+{
+    const Int localHeight = matrix_.Height();
+    return Iterator
+    ( matrix_.Buffer(), localHeight, matrix_.LDim(), 
+      0, localHeight==0 ? matrix_.Width() : 0,
+      this->ColShift(), this->ColStride(), 
+      this->RowShift(), this->RowStride() );
+}
+
+template<typename T,typename Int> inline
+MatrixIterator<T,Int> AbstractDistMatrix<T,Int>::End()
+{
+    return Iterator
+    ( matrix_.Buffer(), matrix_.Height(), matrix_.LDim(), 0, matrix_.Width(),
+      this->ColShift(), this->ColStride(), 
+      this->RowShift(), this->RowStride() );
+}
+
+template<typename T,typename Int> inline
+MatrixIterator<const T,Int> AbstractDistMatrix<T,Int>::LockedBegin() const
+{
+    const Int localHeight = matrix_.Height();
+    return ConstIterator
+    ( matrix_.LockedBuffer(), localHeight, matrix_.LDim(), 
+      0, localHeight==0 ? matrix_.Width() : 0,
+      this->ColShift(), this->ColStride(), 
+      this->RowShift(), this->RowStride() );
+}
+
+template<typename T,typename Int> inline
+MatrixIterator<const T,Int> AbstractDistMatrix<T,Int>::LockedEnd() const
+{
+    return ConstIterator
+    ( matrix_.LockedBuffer(), matrix_.Height(), matrix_.LDim(), 
+      0, matrix_.Width(),
+      this->ColShift(), this->ColStride(), 
+      this->RowShift(), this->RowStride() );
+}
+
 template<typename T,typename Int> inline
 void AbstractDistMatrix<T,Int>::Align( Int colAlignment, Int rowAlignment )
 { return PARENT(Align)( colAlignment, rowAlignment ); }
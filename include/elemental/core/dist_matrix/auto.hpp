@@ -24,6 +24,20 @@ struct DistData
     void PrintShort( std::ostream& os ) const;
 };
 
+// The header of the binary files written by AutoDistMatrix::WriteBinary
+struct DistMatrixFileHeader
+{
+    char magic[8];    // "ELEMMAT"
+    int version;      // currently 1
+    int dataType;     // ScalarTypes
+    int dataSize;     // bytes per entry
+    int colDist;      // Distribution of the writer
+    int rowDist;      // Distribution of the writer
+    int height;
+    int width;
+    int reserved[7];
+};
+
 template<typename Int> 
 class AutoDistMatrix
 {
@@ -111,6 +125,18 @@ public:
     void Write( const std::string filename, const std::string msg="" ) const;
     void PrintShort( std::ostream& os ) const;
 
+    // Print the Frobenius norm, the largest magnitude, the number of NaN and 
+    // infinite entries, and the four corners, using O(1) communication
+    void PrintSummary( const std::string msg="" ) const;
+    void PrintSummary( std::ostream& os, const std::string msg="" ) const;
+
+    // Collective binary I/O with MPI-IO. The file holds a small header 
+    // (see DistMatrixFileHeader) followed by the matrix in column-major 
+    // order, and each process reads or writes its local entries directly,
+    // so a file written with any distribution can be read with any other.
+    void WriteBinary( const std::string filename ) const;
+    void ReadBinary( const std::string filename );
+
     //
     // Alignments
     //
@@ -199,6 +225,31 @@ public:
     void SetLocalImagPart( Int iLocal, Int jLocal, const Scalar<Int>& alpha );
     void UpdateLocalImagPart( Int iLocal, Int jLocal, const Scalar<Int>& alpha );
 
+    //
+    // Bulk entry manipulation
+    //
+
+    // GetBlock is collective: every process in the grid receives the 
+    // height x width submatrix whose top-left entry is (i,j) in a column-major
+    // buffer with leading dimension ldim. SetBlock is local: each process 
+    // stores the entries of the block which it owns, so every process should 
+    // pass the same block. The typed versions check that T matches DataType().
+    void GetBlock
+    ( Int i, Int j, Int height, Int width, void* buffer, Int ldim ) const;
+    void SetBlock
+    ( Int i, Int j, Int height, Int width, const void* buffer, Int ldim );
+    template<typename T>
+    void GetBlock
+    ( Int i, Int j, Int height, Int width, T* buffer, Int ldim ) const;
+    template<typename T>
+    void SetBlock
+    ( Int i, Int j, Int height, Int width, const T* buffer, Int ldim );
+
+    // Call visitor(A), where A is this matrix cast to its 
+    // AbstractDistMatrix<T,Int> type, resolving the type once per call
+    template<class Visitor> void Visit( Visitor& visitor );
+    template<class Visitor> void Visit( Visitor& visitor ) const;
+
     //
     // Global entry manipulation
     //
@@ -269,7 +320,13 @@ protected:
     void SetColShift();
     void SetRowShift();
 
+    // Whether this process is the first of the replicas which store its local
+    // entries, so that sending only from such processes covers the matrix once
+    bool ReplicaRoot() const;
+
     virtual void PrintBase( std::ostream& os, const std::string msg ) const = 0;
+    virtual void PrintSummaryBase
+    ( std::ostream& os, const std::string msg ) const = 0;
 
 	template<typename T,typename Ord>
 	friend class AbstractDistMatrix;
@@ -277,6 +334,44 @@ protected:
     friend class DistMatrix;
 };
 
+namespace internal {
+
+// Collectively open a binary matrix file and set a file view which selects 
+// the local entries of A (see AutoDistMatrix::WriteBinary). Writing also 
+// stores the header, and reading resizes A from it. The return value states
+// whether this process should transfer its local entries (when writing, only 
+// one process in each set of replicas does so).
+template<typename Int>
+bool OpenBinaryForWrite
+( const AutoDistMatrix<Int>& A, const std::string filename, 
+  mpi::File& fh, mpi::Datatype& elemType, mpi::Datatype& fileType );
+template<typename Int>
+bool OpenBinaryForRead
+( AutoDistMatrix<Int>& A, const std::string filename, 
+  mpi::File& fh, mpi::Datatype& elemType, mpi::Datatype& fileType );
+
+// Collectively open an existing binary matrix file for reading and writing
+// blocks, check that its datatype matches that of A, and return its size.
+// Each block routine transfers A as the submatrix of the file whose top-left
+// entry is (i,j); since they reset the file view, a handle may not be reused
+// until its pending read completes.
+template<typename Int>
+void OpenBinaryBlocks
+( const AutoDistMatrix<Int>& A, const std::string filename, 
+  mpi::File& fh, Int& height, Int& width );
+template<typename Int>
+void IReadBinaryBlock
+( AutoDistMatrix<Int>& A, mpi::File fh, Int fileHeight, Int i, Int j,
+  mpi::Request& request );
+template<typename Int>
+void ReadBinaryBlock
+( AutoDistMatrix<Int>& A, mpi::File fh, Int fileHeight, Int i, Int j );
+template<typename Int>
+void WriteBinaryBlock
+( const AutoDistMatrix<Int>& A, mpi::File fh, Int fileHeight, Int i, Int j );
+
+} // namespace internal
+
 } // namespace elem
 
 #endif // ifndef CORE_DISTMATRIX_AUTO_HPP
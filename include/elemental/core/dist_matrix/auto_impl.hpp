@@ -128,6 +128,66 @@ template<typename Int> inline
 AutoDistMatrix<Int>& AutoDistMatrix<Int>::operator=( const Self& A )
 { CopyFrom( A ); return *this; }
 
+template <typename Int>
+template <typename T> inline
+void AutoDistMatrix<Int>::GetBlock
+( Int i, Int j, Int height, Int width, T* buffer, Int ldim ) const
+{ 
+    AssertDataTypes( DataType(), ScalarType<T>::Enum );
+    GetBlock( i, j, height, width, static_cast<void*>(buffer), ldim );
+}
+
+template <typename Int>
+template <typename T> inline
+void AutoDistMatrix<Int>::SetBlock
+( Int i, Int j, Int height, Int width, const T* buffer, Int ldim )
+{ 
+    AssertDataTypes( DataType(), ScalarType<T>::Enum );
+    SetBlock( i, j, height, width, static_cast<const void*>(buffer), ldim );
+}
+
+template <typename Int>
+template <class Visitor> inline
+void AutoDistMatrix<Int>::Visit( Visitor& visitor )
+{
+    switch( DataType() )
+    {
+    case INTEGRAL: visitor( Cast_<Int>() ); break;
+#ifndef DISABLE_FLOAT
+    case SINGLE:   visitor( Cast_<float>() ); break;
+#endif
+    case DOUBLE:   visitor( Cast_<double>() ); break;
+#ifndef DISABLE_COMPLEX
+#ifndef DISABLE_FLOAT
+    case SCOMPLEX: visitor( Cast_<scomplex>() ); break;
+#endif
+    case DCOMPLEX: visitor( Cast_<dcomplex>() ); break;
+#endif
+    default: throw std::logic_error("Cannot visit a matrix of UNKNOWN type");
+    }
+}
+
+template <typename Int>
+template <class Visitor> inline
+void AutoDistMatrix<Int>::Visit( Visitor& visitor ) const
+{
+    switch( DataType() )
+    {
+    case INTEGRAL: visitor( Cast_<Int>() ); break;
+#ifndef DISABLE_FLOAT
+    case SINGLE:   visitor( Cast_<float>() ); break;
+#endif
+    case DOUBLE:   visitor( Cast_<double>() ); break;
+#ifndef DISABLE_COMPLEX
+#ifndef DISABLE_FLOAT
+    case SCOMPLEX: visitor( Cast_<scomplex>() ); break;
+#endif
+    case DCOMPLEX: visitor( Cast_<dcomplex>() ); break;
+#endif
+    default: throw std::logic_error("Cannot visit a matrix of UNKNOWN type");
+    }
+}
+
 } // namespace elem
 
 #endif // ifndef CORE_DISTMATRIX_AUTO_HPP
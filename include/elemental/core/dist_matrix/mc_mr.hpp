@@ -228,8 +228,6 @@ public:
     ( const DistMatrix<typename Base<T>::type,STAR,MD,Int>& d, Int offset=0 );
 
 private:
-    void PrintBase( std::ostream& os, const std::string msg="" ) const;
-
     template<typename S,Distribution U,Distribution V,typename N>
     friend class DistMatrix;
 };
@@ -213,8 +213,6 @@ public:
     ( const DistMatrix<typename Base<T>::type,STAR,MD,Int>& d, Int offset=0 );
 
 private:
-    virtual void PrintBase( std::ostream& os, const std::string msg="" ) const;
-
     template<typename S,Distribution U,Distribution V,typename N>
     friend class DistMatrix;
 };
@@ -178,7 +178,6 @@ public:
 
 private:
     Int diagPath_;
-    virtual void PrintBase( std::ostream& os, const std::string msg="" ) const;
 
     template<typename S,Distribution U,Distribution V,typename N>
     friend class DistMatrix;
@@ -171,8 +171,6 @@ public:
     ( const DistMatrix<T,VR,STAR,Int>& A, bool conjugate=false );
 
 private:
-    virtual void PrintBase( std::ostream& os, const std::string msg="" ) const;
-
     template<typename S,Distribution U,Distribution V,typename N>
     friend class DistMatrix;
 };
@@ -162,8 +162,6 @@ public:
     void SumScatterUpdate( T alpha, const DistMatrix<T,STAR,STAR,Int>& A );
 
 private:
-    virtual void PrintBase( std::ostream& os, const std::string msg="" ) const;
-
     template<typename S,Distribution U,Distribution V,typename N>
     friend class DistMatrix;
 };
@@ -178,7 +178,6 @@ Grid::SetUpGrid()
         vectorColRank_ = mpi::UNDEFINED;
         vectorRowRank_ = mpi::UNDEFINED;
     }
-    mpi::Broadcast( &diagPathsAndRanks_[0], 2*size_, 0, viewingComm_ );
 
     // Set up the map from the VC group to the viewingGroup_ ranks.
     // Since the VC communicator preserves the ordering of the owningGroup_
@@ -190,6 +189,11 @@ Grid::SetUpGrid()
     mpi::GroupTranslateRanks
     ( owningGroup_, size_, &ranks[0], viewingGroup_, 
       &vectorColToViewingMap_[0] );
+
+    // The root must own part of the grid, which viewing rank 0 need not
+    mpi::Broadcast
+    ( &diagPathsAndRanks_[0], 2*size_, vectorColToViewingMap_[0],
+      viewingComm_ );
 #ifndef RELEASE
     PopCallStack();
 #endif
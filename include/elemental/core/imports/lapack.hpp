@@ -161,6 +161,29 @@ void HessenbergEig( int n, double* H, int ldh, dcomplex* w );
 void HessenbergEig( int n, scomplex* H, int ldh, scomplex* w );
 void HessenbergEig( int n, dcomplex* H, int ldh, dcomplex* w );
 
+//
+// Compute the eigenvalues (and, if Z is non-NULL, the eigenvectors) of a 
+// real symmetric tridiagonal matrix using the implicit QR algorithm
+//
+
+void TridiagQRAlg( int n, float* d, float* e, float* Z, int ldz );
+void TridiagQRAlg( int n, double* d, double* e, double* Z, int ldz );
+
+//
+// Compute the i'th smallest root of the secular equation
+//
+//   1 + rho sum_j z_j^2 / (d_j - lambda) = 0,
+//
+// where d is strictly increasing, rho > 0, and || z ||_2 = 1. On exit, 
+// delta_j = d_j - lambda (unless n <= 2, in which case delta holds the 
+// corresponding eigenvector of diag(d) + rho z z^T).
+//
+
+float SecularEigenvalue
+( int n, int i, const float* d, const float* z, float rho, float* delta );
+double SecularEigenvalue
+( int n, int i, const double* d, const double* z, double rho, double* delta );
+
 } // namespace lapack
 } // namespace elem
 
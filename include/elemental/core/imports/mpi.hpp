@@ -33,7 +33,9 @@ namespace mpi {
 typedef MPI_Comm Comm;
 typedef MPI_Datatype Datatype;
 typedef MPI_Errhandler ErrorHandler;
+typedef MPI_File File;
 typedef MPI_Group Group;
+typedef MPI_Offset Offset;
 typedef MPI_Op Op;
 typedef MPI_Request Request;
 typedef MPI_Status Status;
@@ -49,10 +51,15 @@ const int THREAD_MULTIPLE = MPI_THREAD_MULTIPLE;
 const int UNDEFINED = MPI_UNDEFINED;
 const Comm COMM_SELF = MPI_COMM_SELF;
 const Comm COMM_WORLD = MPI_COMM_WORLD;
+const Datatype BYTE = MPI_BYTE;
 const ErrorHandler ERRORS_RETURN = MPI_ERRORS_RETURN;
 const ErrorHandler ERRORS_ARE_FATAL = MPI_ERRORS_ARE_FATAL;
 const Group GROUP_EMPTY = MPI_GROUP_EMPTY;
 const Request REQUEST_NULL = MPI_REQUEST_NULL;
+const int MODE_RDONLY = MPI_MODE_RDONLY;
+const int MODE_WRONLY = MPI_MODE_WRONLY;
+const int MODE_RDWR = MPI_MODE_RDWR;
+const int MODE_CREATE = MPI_MODE_CREATE;
 const Op MAX = MPI_MAX;
 const Op MIN = MPI_MIN;
 const Op PROD = MPI_PROD;
@@ -111,6 +118,33 @@ void GroupTranslateRanks
 ( Group origGroup, int size, const int* origRanks, 
   Group newGroup,                  int* newRanks );
 
+// Derived datatypes (the strides of TypeHVector are in bytes)
+void TypeContiguous( int count, Datatype oldType, Datatype& newType );
+void TypeVector
+( int count, int blocklength, int stride, Datatype oldType, 
+  Datatype& newType );
+void TypeHVector
+( int count, int blocklength, Offset stride, Datatype oldType, 
+  Datatype& newType );
+void TypeCommit( Datatype& type );
+void TypeFree( Datatype& type );
+
+// Parallel I/O
+void FileOpen( Comm comm, const std::string filename, int mode, File& fh );
+void FileClose( File& fh );
+void FileSetSize( File fh, Offset size );
+void FileSync( File fh );
+void FileSetView
+( File fh, Offset displacement, Datatype elemType, Datatype fileType );
+void FileReadAt( File fh, Offset offset, void* buf, int count, Datatype type );
+void FileWriteAt
+( File fh, Offset offset, const void* buf, int count, Datatype type );
+void FileReadAll( File fh, void* buf, int count, Datatype type );
+void FileWriteAll( File fh, const void* buf, int count, Datatype type );
+void FileIRead( File fh, void* buf, int count, Datatype type, Request& request );
+void FileIWrite
+( File fh, const void* buf, int count, Datatype type, Request& request );
+
 // Utilities
 void Barrier( Comm comm );
 void Wait( Request& request );
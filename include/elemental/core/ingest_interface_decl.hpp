@@ -0,0 +1,67 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_INGESTINTERFACE_DECL_HPP
+#define CORE_INGESTINTERFACE_DECL_HPP
+
+namespace elem {
+
+// Fills a [VC,* ] or [MC,MR] matrix from blocks of rows which any process
+// may provide in any order, without ever forming the matrix in one place.
+// Ingest copies rows into local send buffers which hold at most bufferSize
+// bytes, and returns how many leading rows of the block fit; Exchange is
+// collective over the grid and routes the buffered rows to their owners with
+// AllToAll, in rounds which deliver roughly at most bufferSize bytes to each
+// process. Since Exchange returns whether any process passed moreLocal=true,
+// the processes can stream in differing numbers of rows with
+//
+//     int k = 0;
+//     do
+//     {
+//         k += ingest.Ingest( XRemaining, i+k );
+//         ...
+//     } while( ingest.Exchange( k < X.Height() ) );
+//
+// The matrix must already have its final size, and rows which are never
+// ingested are left untouched.
+template<typename T,typename Int=int>
+class IngestInterface
+{
+public:
+    IngestInterface( DistMatrix<T,VC,STAR,Int>& A, std::size_t bufferSize );
+    IngestInterface( DistMatrix<T,MC,MR,Int>& A, std::size_t bufferSize );
+
+    // Local: rows i through i+X.Height()-1 of A, or numRows rows of A
+    // stored contiguously in row-major order
+    Int Ingest( const Matrix<T,Int>& X, Int i );
+    Int Ingest( const T* rows, Int numRows, Int i );
+
+    // Collective: route the buffered rows and return whether any process
+    // has more to ingest
+    bool Exchange( bool moreLocal=false );
+
+    // Collective: each process reads its own contiguous slab of the rows of
+    // a binary file which stores A in row-major order after 'offset' bytes
+    void IngestFile( const std::string filename, mpi::Offset offset=0 );
+
+private:
+    AbstractDistMatrix<T,Int>* A_;
+    std::size_t bufferSize_, buffered_;
+    std::vector<std::vector<byte> > sendBuffers_;
+
+    void Setup();
+    std::size_t RowSize() const;
+    std::size_t RecordSize( Int gridCol ) const;
+    Int Stage( const T* buffer, Int numRows, Int rowStride, Int colStride,
+               Int i );
+};
+
+} // namespace elem
+
+#endif // ifndef CORE_INGESTINTERFACE_DECL_HPP
@@ -0,0 +1,270 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_INGESTINTERFACE_IMPL_HPP
+#define CORE_INGESTINTERFACE_IMPL_HPP
+
+namespace elem {
+
+template<typename T,typename Int>
+inline
+IngestInterface<T,Int>::IngestInterface
+( DistMatrix<T,VC,STAR,Int>& A, std::size_t bufferSize )
+: A_(&A), bufferSize_(bufferSize), buffered_(0)
+{ Setup(); }
+
+template<typename T,typename Int>
+inline
+IngestInterface<T,Int>::IngestInterface
+( DistMatrix<T,MC,MR,Int>& A, std::size_t bufferSize )
+: A_(&A), bufferSize_(bufferSize), buffered_(0)
+{ Setup(); }
+
+template<typename T,typename Int>
+inline void
+IngestInterface<T,Int>::Setup()
+{
+#ifndef RELEASE
+    PushCallStack("IngestInterface::Setup");
+    A_->AssertNotLocked();
+#endif
+    if( bufferSize_ < RowSize() )
+        throw std::logic_error("The buffer must be able to hold a row");
+    sendBuffers_.resize( A_->Grid().Size() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// The number of bytes buffered for each row: the row index is sent along
+// with each of the pieces of the row owned by different processes
+template<typename T,typename Int>
+inline std::size_t
+IngestInterface<T,Int>::RowSize() const
+{ return A_->Width()*sizeof(T) + A_->RowStride()*sizeof(Int); }
+
+template<typename T,typename Int>
+inline std::size_t
+IngestInterface<T,Int>::RecordSize( Int gridCol ) const
+{
+    const Int rowStride = A_->RowStride();
+    const Int rowShift = Shift( gridCol, A_->RowAlignment(), rowStride );
+    return sizeof(Int) + Length(A_->Width(),rowShift,rowStride)*sizeof(T);
+}
+
+// Buffer as many of the rows as fit, where entry (k,j) of the block is
+// stored in buffer[k*rowStride+j*colStride], and return how many did
+template<typename T,typename Int>
+inline Int
+IngestInterface<T,Int>::Stage
+( const T* buffer, Int numRows, Int rowStride, Int colStride, Int i )
+{
+#ifndef RELEASE
+    PushCallStack("IngestInterface::Stage");
+    if( i < 0 || i+numRows > A_->Height() )
+        throw std::logic_error("Rows are out of bounds");
+#endif
+    const Int width = A_->Width();
+    const Int colAlignment = A_->ColAlignment();
+    const Int rowAlignment = A_->RowAlignment();
+    const Int colStrideA = A_->ColStride();
+    const Int rowStrideA = A_->RowStride();
+    const std::size_t rowSize = RowSize();
+
+    Int k;
+    for( k=0; k<numRows; ++k )
+    {
+        if( buffered_+rowSize > bufferSize_ )
+            break;
+        const Int iGlobal = i+k;
+        const Int colOwner = (iGlobal+colAlignment) % colStrideA;
+        const T* row = &buffer[k*rowStride];
+        for( Int q=0; q<rowStrideA; ++q )
+        {
+            std::vector<byte>& sendBuffer = sendBuffers_[colOwner+q*colStrideA];
+            const Int rowShift = Shift( q, rowAlignment, rowStrideA );
+            const Int localWidth = Length( width, rowShift, rowStrideA );
+            std::size_t pos = sendBuffer.size();
+            sendBuffer.resize( pos+RecordSize(q) );
+            MemCopy( &sendBuffer[pos], (const byte*)&iGlobal, sizeof(Int) );
+            pos += sizeof(Int);
+            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+            {
+                const T* entry = &row[(rowShift+jLocal*rowStrideA)*colStride];
+                MemCopy( &sendBuffer[pos], (const byte*)entry, sizeof(T) );
+                pos += sizeof(T);
+            }
+        }
+        buffered_ += rowSize;
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return k;
+}
+
+template<typename T,typename Int>
+inline Int
+IngestInterface<T,Int>::Ingest( const Matrix<T,Int>& X, Int i )
+{
+#ifndef RELEASE
+    PushCallStack("IngestInterface::Ingest");
+    if( X.Width() != A_->Width() )
+        throw std::logic_error("Rows must be as wide as the matrix");
+#endif
+    const Int numRows =
+        ( X.Height() == 0 ? 0
+                          : Stage( X.LockedBuffer(), X.Height(), 1, X.LDim(),
+                                   i ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return numRows;
+}
+
+template<typename T,typename Int>
+inline Int
+IngestInterface<T,Int>::Ingest( const T* rows, Int numRows, Int i )
+{ return Stage( rows, numRows, A_->Width(), 1, i ); }
+
+template<typename T,typename Int>
+inline bool
+IngestInterface<T,Int>::Exchange( bool moreLocal )
+{
+#ifndef RELEASE
+    PushCallStack("IngestInterface::Exchange");
+#endif
+    const Grid& g = A_->Grid();
+    mpi::Comm comm = g.VCComm();
+    const int p = g.Size();
+    const Int colShift = A_->ColShift();
+    const Int colStride = A_->ColStride();
+    const Int localWidth = A_->LocalWidth();
+    const Int ldim = A_->LDim();
+    T* ABuffer = A_->Buffer();
+
+    // Send at most bufferSize/p bytes (but at least one row) to each process
+    // in each round
+    const std::size_t quota = bufferSize_ / p;
+    const std::size_t recvRecordSize = sizeof(Int) + localWidth*sizeof(T);
+    std::vector<std::size_t> offsets( p, 0 );
+    std::vector<int> sendCounts( p ), sendDispls( p ),
+                     recvCounts( p ), recvDispls( p );
+    std::vector<byte> sendBuffer, recvBuffer;
+    while( true )
+    {
+        int totalSend=0, remaining=0;
+        for( int q=0; q<p; ++q )
+        {
+            const std::size_t recordSize = RecordSize( q / colStride );
+            const std::size_t numRecords =
+                std::max( std::size_t(1), quota/recordSize );
+            const std::size_t left = sendBuffers_[q].size()-offsets[q];
+            sendCounts[q] = std::min( left, numRecords*recordSize );
+            sendDispls[q] = totalSend;
+            totalSend += sendCounts[q];
+            remaining = std::max( remaining, int(left>0) );
+        }
+        mpi::AllReduce( &remaining, 1, mpi::MAX, comm );
+        if( !remaining )
+            break;
+
+        sendBuffer.resize( std::max(totalSend,1) );
+        for( int q=0; q<p; ++q )
+            if( sendCounts[q] > 0 )
+                MemCopy
+                ( &sendBuffer[sendDispls[q]], &sendBuffers_[q][offsets[q]],
+                  sendCounts[q] );
+        mpi::AllToAll( &sendCounts[0], 1, &recvCounts[0], 1, comm );
+        int totalRecv=0;
+        for( int q=0; q<p; ++q )
+        {
+            recvDispls[q] = totalRecv;
+            totalRecv += recvCounts[q];
+        }
+        recvBuffer.resize( std::max(totalRecv,1) );
+        mpi::AllToAll
+        ( &sendBuffer[0], &sendCounts[0], &sendDispls[0],
+          &recvBuffer[0], &recvCounts[0], &recvDispls[0], comm );
+
+        // Unpack the rows into the local matrix
+        for( std::size_t pos=0; pos<std::size_t(totalRecv);
+             pos+=recvRecordSize )
+        {
+            Int i;
+            MemCopy( (byte*)&i, &recvBuffer[pos], sizeof(Int) );
+            const Int iLocal = (i-colShift) / colStride;
+            const byte* entries = &recvBuffer[pos+sizeof(Int)];
+            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+                MemCopy
+                ( (byte*)&ABuffer[iLocal+jLocal*ldim],
+                  &entries[jLocal*sizeof(T)], sizeof(T) );
+        }
+        for( int q=0; q<p; ++q )
+            offsets[q] += sendCounts[q];
+    }
+
+    // Release the buffers so that their capacity does not accumulate
+    for( int q=0; q<p; ++q )
+        std::vector<byte>().swap( sendBuffers_[q] );
+    buffered_ = 0;
+
+    int more = moreLocal;
+    mpi::AllReduce( &more, 1, mpi::MAX, comm );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return more != 0;
+}
+
+template<typename T,typename Int>
+inline void
+IngestInterface<T,Int>::IngestFile
+( const std::string filename, mpi::Offset offset )
+{
+#ifndef RELEASE
+    PushCallStack("IngestInterface::IngestFile");
+#endif
+    const Grid& g = A_->Grid();
+    const int p = g.Size();
+    const int rank = g.VCRank();
+    const Int height = A_->Height();
+    const Int width = A_->Width();
+    const Int rowSize = width*sizeof(T);
+
+    // Read this process's slab of rows in pieces which fit in the buffer
+    const Int firstRow = Int( (mpi::Offset(rank)*height) / p );
+    const Int lastRow = Int( (mpi::Offset(rank+1)*height) / p );
+    mpi::File fh;
+    mpi::FileOpen( g.VCComm(), filename, mpi::MODE_RDONLY, fh );
+    std::vector<T> rows;
+    Int i = firstRow;
+    do
+    {
+        const Int numRows =
+            std::min( lastRow-i, Int((bufferSize_-buffered_)/RowSize()) );
+        if( numRows > 0 )
+        {
+            rows.resize( numRows*width );
+            mpi::FileReadAt
+            ( fh, offset+mpi::Offset(i)*rowSize, &rows[0], numRows*rowSize,
+              mpi::BYTE );
+            Stage( &rows[0], numRows, width, 1, i );
+            i += numRows;
+        }
+    } while( Exchange( i < lastRow ) );
+    mpi::FileClose( fh );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
+
+#endif // ifndef CORE_INGESTINTERFACE_IMPL_HPP
@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_LOWRANKDISTMATRIX_DECL_HPP
+#define CORE_LOWRANKDISTMATRIX_DECL_HPP
+
+namespace elem {
+
+//
+// An m x n matrix stored in the factored form
+//
+//   A = U diag(s) V^H,
+//
+// where U is m x r, V is n x r, and s is a real vector of length r. This 
+// requires O((m+n)r) rather than O(mn) memory, and products with k vectors 
+// require O((m+n)rk) rather than O(mnk) work. The columns of U and V need 
+// not be orthonormal unless the matrix was recompressed (see Recompress).
+//
+template<typename F>
+class LowRankDistMatrix
+{
+public:
+    typedef typename Base<F>::type R;
+
+    LowRankDistMatrix( const elem::Grid& g=DefaultGrid() );
+    // A rank-zero matrix of the given size
+    LowRankDistMatrix
+    ( int height, int width, const elem::Grid& g=DefaultGrid() );
+    ~LowRankDistMatrix();
+
+    //
+    // Basic information
+    //
+
+    int Height() const;
+    int Width() const;
+    int Rank() const;
+    const elem::Grid& Grid() const;
+
+    //
+    // Access to the factors
+    //
+
+          DistMatrix<F,MC,MR>& U();
+    const DistMatrix<F,MC,MR>& LockedU() const;
+          DistMatrix<R,VR,STAR>& S();
+    const DistMatrix<R,VR,STAR>& LockedS() const;
+          DistMatrix<F,MC,MR>& V();
+    const DistMatrix<F,MC,MR>& LockedV() const;
+
+    //
+    // Modification
+    //
+
+    // Reset to a rank-zero matrix of the given size
+    void Empty();
+    void ResizeTo( int height, int width );
+
+    // Overwrite the factors with copies of U, s, and V
+    void Set
+    ( const DistMatrix<F,MC,MR>& U, 
+      const DistMatrix<R,VR,STAR>& s,
+      const DistMatrix<F,MC,MR>& V );
+
+    const LowRankDistMatrix<F>& 
+    operator=( const LowRankDistMatrix<F>& A );
+
+private:
+    int height_, width_;
+    DistMatrix<F,MC,MR> U_, V_;
+    DistMatrix<R,VR,STAR> s_;
+
+    // Copies should be made with operator=
+    LowRankDistMatrix( const LowRankDistMatrix<F>& A );
+};
+
+} // namespace elem
+
+#endif // ifndef CORE_LOWRANKDISTMATRIX_DECL_HPP
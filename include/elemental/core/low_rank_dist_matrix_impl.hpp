@@ -0,0 +1,153 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_LOWRANKDISTMATRIX_IMPL_HPP
+#define CORE_LOWRANKDISTMATRIX_IMPL_HPP
+
+namespace elem {
+
+template<typename F>
+inline
+LowRankDistMatrix<F>::LowRankDistMatrix( const elem::Grid& g )
+: height_(0), width_(0), U_(g), V_(g), s_(g)
+{ }
+
+template<typename F>
+inline
+LowRankDistMatrix<F>::LowRankDistMatrix
+( int height, int width, const elem::Grid& g )
+: height_(0), width_(0), U_(g), V_(g), s_(g)
+{ ResizeTo( height, width ); }
+
+template<typename F>
+inline
+LowRankDistMatrix<F>::~LowRankDistMatrix()
+{ }
+
+template<typename F>
+inline int
+LowRankDistMatrix<F>::Height() const
+{ return height_; }
+
+template<typename F>
+inline int
+LowRankDistMatrix<F>::Width() const
+{ return width_; }
+
+template<typename F>
+inline int
+LowRankDistMatrix<F>::Rank() const
+{ return s_.Height(); }
+
+template<typename F>
+inline const elem::Grid&
+LowRankDistMatrix<F>::Grid() const
+{ return U_.Grid(); }
+
+template<typename F>
+inline DistMatrix<F,MC,MR>&
+LowRankDistMatrix<F>::U()
+{ return U_; }
+
+template<typename F>
+inline const DistMatrix<F,MC,MR>&
+LowRankDistMatrix<F>::LockedU() const
+{ return U_; }
+
+template<typename F>
+inline DistMatrix<typename Base<F>::type,VR,STAR>&
+LowRankDistMatrix<F>::S()
+{ return s_; }
+
+template<typename F>
+inline const DistMatrix<typename Base<F>::type,VR,STAR>&
+LowRankDistMatrix<F>::LockedS() const
+{ return s_; }
+
+template<typename F>
+inline DistMatrix<F,MC,MR>&
+LowRankDistMatrix<F>::V()
+{ return V_; }
+
+template<typename F>
+inline const DistMatrix<F,MC,MR>&
+LowRankDistMatrix<F>::LockedV() const
+{ return V_; }
+
+template<typename F>
+inline void
+LowRankDistMatrix<F>::Empty()
+{ ResizeTo( 0, 0 ); }
+
+template<typename F>
+inline void
+LowRankDistMatrix<F>::ResizeTo( int height, int width )
+{
+#ifndef RELEASE
+    PushCallStack("LowRankDistMatrix::ResizeTo");
+    if( height < 0 || width < 0 )
+        throw std::logic_error("Height and width must be non-negative");
+#endif
+    height_ = height;
+    width_ = width;
+    U_.Empty();
+    V_.Empty();
+    s_.Empty();
+    U_.ResizeTo( height, 0 );
+    V_.ResizeTo( width, 0 );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+LowRankDistMatrix<F>::Set
+( const DistMatrix<F,MC,MR>& U, 
+  const DistMatrix<R,VR,STAR>& s,
+  const DistMatrix<F,MC,MR>& V )
+{
+#ifndef RELEASE
+    PushCallStack("LowRankDistMatrix::Set");
+    if( U.Width() != V.Width() || s.Height() != U.Width() || s.Width() != 1 )
+        throw std::logic_error("Nonconformal low-rank factors");
+    if( U.Grid() != Grid() || V.Grid() != Grid() || s.Grid() != Grid() )
+        throw std::logic_error("Factors must be distributed over same grid");
+#endif
+    height_ = U.Height();
+    width_ = V.Height();
+    U_.Empty();
+    V_.Empty();
+    s_.Empty();
+    U_ = U;
+    V_ = V;
+    s_ = s;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline const LowRankDistMatrix<F>&
+LowRankDistMatrix<F>::operator=( const LowRankDistMatrix<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("LowRankDistMatrix::operator=");
+#endif
+    if( &A != this )
+        Set( A.LockedU(), A.LockedS(), A.LockedV() );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return *this;
+}
+
+} // namespace elem
+
+#endif // ifndef CORE_LOWRANKDISTMATRIX_IMPL_HPP
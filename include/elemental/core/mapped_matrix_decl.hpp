@@ -0,0 +1,62 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_MAPPEDMATRIX_DECL_HPP
+#define CORE_MAPPEDMATRIX_DECL_HPP
+
+namespace elem {
+
+// A Matrix whose entries live in a memory-mapped file, so that sequential
+// routines may operate on matrices which exceed the available memory and
+// large operands may be loaded without reading them up front. The file uses
+// the format of AutoDistMatrix::WriteBinary (a 64-byte header followed by
+// the column-major entries), so a file written by WriteBinary may be mapped
+// directly, and vice versa. The local matrix of a DistMatrix may be backed
+// by a mapping by attaching the DistMatrix to the buffer of a MappedMatrix.
+//
+// Since the matrix is a view of the mapping, it cannot be resized beyond the 
+// dimensions of the file.
+template<typename T,typename Int=int>
+class MappedMatrix : public Matrix<T,Int>
+{
+public:
+    // Map an existing file
+    MappedMatrix( const std::string filename, bool readOnly=false );
+    // Create (or overwrite) the file for a height x width matrix and map it
+    MappedMatrix( const std::string filename, Int height, Int width );
+    ~MappedMatrix();
+
+    // Assignment copies the entries into the mapping
+    using Matrix<T,Int>::operator=;
+
+    // Hint the access pattern of the whole mapping to the kernel
+    void Advise( MappedAccess access );
+    // Request that the given range of columns be paged in ahead of its use
+    void Prefetch( Int j, Int width );
+    // Write back the given range of columns and allow its pages to be dropped
+    void Release( Int j, Int width );
+    // Write back all modified pages
+    void Flush();
+
+private:
+    void* map_;
+    std::size_t mapSize_;
+    bool readOnly_;
+
+    void Map( const std::string filename, bool create, Int height, Int width );
+    void ColumnRange( Int j, Int width, byte*& start, std::size_t& size ) const;
+
+    // Disable copying due to the ownership of the mapping
+    MappedMatrix( const MappedMatrix& );
+    const MappedMatrix& operator=( const MappedMatrix& );
+};
+
+} // namespace elem
+
+#endif // ifndef CORE_MAPPEDMATRIX_DECL_HPP
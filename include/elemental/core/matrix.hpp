@@ -12,6 +12,36 @@
 
 namespace elem {
 
+// Iterates over the entries of a column-major buffer in column-major order,
+// skipping the padding between columns. Row() and Col() map the local indices
+// of the current entry through shift + index*stride, so that iterating over 
+// the local entries of a distributed matrix yields their global indices.
+template<typename T,typename Int=int>
+class MatrixIterator
+{
+public:
+    MatrixIterator
+    ( T* buffer, Int height, Int ldim, Int iLocal, Int jLocal,
+      Int colShift=0, Int colStride=1, Int rowShift=0, Int rowStride=1 );
+
+    T& operator*() const;
+    T* operator->() const;
+    MatrixIterator& operator++();
+    MatrixIterator operator++( int );
+    bool operator==( const MatrixIterator& it ) const;
+    bool operator!=( const MatrixIterator& it ) const;
+
+    Int LocalRow() const;
+    Int LocalCol() const;
+    Int Row() const;
+    Int Col() const;
+
+private:
+    T* buffer_;
+    Int height_, ldim_, iLocal_, jLocal_;
+    Int colShift_, colStride_, rowShift_, rowStride_;
+};
+
 template <typename Int>
 class AutoMatrix
 {
@@ -97,6 +127,27 @@ public:
     void SetImagPart( Int i, Int j, const Scalar& s );
     void UpdateImagPart( Int i, Int j, const Scalar& s );
     
+    // Copy the height x width submatrix whose top-left entry is (i,j) to or 
+    // from a column-major buffer with leading dimension ldim. The untyped 
+    // versions assume that the buffer holds entries of DataType(), and the 
+    // typed versions check that T matches it once per call.
+    void GetBlock
+    ( Int i, Int j, Int height, Int width, void* buffer, Int ldim ) const;
+    void SetBlock
+    ( Int i, Int j, Int height, Int width, const void* buffer, Int ldim );
+    template<typename T>
+    void GetBlock
+    ( Int i, Int j, Int height, Int width, T* buffer, Int ldim ) const;
+    template<typename T>
+    void SetBlock
+    ( Int i, Int j, Int height, Int width, const T* buffer, Int ldim );
+
+    // Call visitor(A), where A is this matrix cast to its Matrix<T,Int> type,
+    // so that the type is resolved once per call rather than once per entry.
+    // The visitor must provide a templated operator() for each datatype.
+    template<class Visitor> void Visit( Visitor& visitor );
+    template<class Visitor> void Visit( Visitor& visitor ) const;
+    
     void GetDiagonal( Self& d, Int offset = 0 ) const;
     void SetDiagonal( const Self& d, Int offset = 0 );
     void UpdateDiagonal( const Self& d, Int offset = 0 );
@@ -201,6 +252,8 @@ public:
 	typedef Matrix<RT,Int> RSelf;
 	typedef AutoMatrix<Int> Parent;
 	typedef elem::Scalar<Int> Scalar;
+	typedef MatrixIterator<T,Int> Iterator;
+	typedef MatrixIterator<const T,Int> ConstIterator;
 	
     //
     // Constructors
@@ -232,6 +285,11 @@ public:
     const T* LockedBuffer() const;
     const T* LockedBuffer( Int i, Int j ) const;
 
+    Iterator Begin();
+    Iterator End();
+    ConstIterator LockedBegin() const;
+    ConstIterator LockedEnd() const;
+
     //
     // I/O
     //
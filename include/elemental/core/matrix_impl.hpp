@@ -20,6 +20,71 @@
 
 namespace elem {
 
+//
+// MatrixIterator
+//
+
+template<typename T,typename Int> inline
+MatrixIterator<T,Int>::MatrixIterator
+( T* buffer, Int height, Int ldim, Int iLocal, Int jLocal,
+  Int colShift, Int colStride, Int rowShift, Int rowStride )
+: buffer_(buffer), height_(height), ldim_(ldim), 
+  iLocal_(iLocal), jLocal_(jLocal),
+  colShift_(colShift), colStride_(colStride), 
+  rowShift_(rowShift), rowStride_(rowStride)
+{ }
+
+template<typename T,typename Int> inline
+T& MatrixIterator<T,Int>::operator*() const
+{ return buffer_[iLocal_+jLocal_*ldim_]; }
+
+template<typename T,typename Int> inline
+T* MatrixIterator<T,Int>::operator->() const
+{ return &buffer_[iLocal_+jLocal_*ldim_]; }
+
+template<typename T,typename Int> inline
+MatrixIterator<T,Int>& MatrixIterator<T,Int>::operator++()
+{
+    if( ++iLocal_ == height_ )
+    {
+        iLocal_ = 0;
+        ++jLocal_;
+    }
+    return *this;
+}
+
+template<typename T,typename Int> inline
+MatrixIterator<T,Int> MatrixIterator<T,Int>::operator++( int )
+{
+    MatrixIterator<T,Int> it( *this );
+    ++(*this);
+    return it;
+}
+
+template<typename T,typename Int> inline
+bool MatrixIterator<T,Int>::operator==( const MatrixIterator<T,Int>& it ) const
+{ return iLocal_ == it.iLocal_ && jLocal_ == it.jLocal_; }
+
+template<typename T,typename Int> inline
+bool MatrixIterator<T,Int>::operator!=( const MatrixIterator<T,Int>& it ) const
+{ return iLocal_ != it.iLocal_ || jLocal_ != it.jLocal_; }
+
+template<typename T,typename Int> inline
+Int MatrixIterator<T,Int>::LocalRow() const
+{ return iLocal_; }
+
+template<typename T,typename Int> inline
+Int MatrixIterator<T,Int>::LocalCol() const
+{ return jLocal_; }
+
+template<typename T,typename Int> inline
+Int MatrixIterator<T,Int>::Row() const
+{ return colShift_ + iLocal_*colStride_; }
+
+template<typename T,typename Int> inline
+Int MatrixIterator<T,Int>::Col() const
+{ return rowShift_ + jLocal_*rowStride_; }
+
 template <typename T,typename Int> inline
 ScalarTypes Matrix<T,Int>::DataType() const 
 { return ScalarType<T>::Enum; }
@@ -122,6 +187,35 @@ template <typename T,typename Int> inline
 const T* Matrix<T,Int>::LockedBuffer( Int i, Int j ) const
 { return static_cast<const T*>(RPARENT(LockedBuffer)(i,j)); }
 
+// An empty matrix begins where it ends, at the column past its last one
+template <typename T,typename Int> inline
+MatrixIterator<T,Int> Matrix<T,Int>::Begin()
+{ 
+    const Int height = Parent::Height();
+    return Iterator
+    ( Buffer(), height, Parent::LDim(), 0, height==0 ? Parent::Width() : 0 ); 
+}
+
+template <typename T,typename Int> inline
+MatrixIterator<T,Int> Matrix<T,Int>::End()
+{ return Iterator( Buffer(), Parent::Height(), Parent::LDim(), 0, Parent::Width() ); }
+
+template <typename T,typename Int> inline
+MatrixIterator<const T,Int> Matrix<T,Int>::LockedBegin() const
+{ 
+    const Int height = Parent::Height();
+    return ConstIterator
+    ( LockedBuffer(), height, Parent::LDim(), 0, 
+      height==0 ? Parent::Width() : 0 ); 
+}
+
+template <typename T,typename Int> inline
+MatrixIterator<const T,Int> Matrix<T,Int>::LockedEnd() const
+{ 
+    return ConstIterator
+    ( LockedBuffer(), Parent::Height(), Parent::LDim(), 0, Parent::Width() ); 
+}
+
 template <typename Int> inline
 void AutoMatrix<Int>::Attach_( ScalarTypes dtype, Int height, Int width, const void* buffer, Int ldim, bool lock )
 { Attach_( height, width, buffer, ldim, false ); }
@@ -215,6 +309,70 @@ template <typename T,typename Int> inline
 void Matrix<T,Int>::UpdateImagPart( Int i, Int j, typename Base<T>::type a )
 { RPARENT(UpdateImagPart)(i,j,a); }
 
+//
+// Bulk entry manipulation
+//
+
+template <typename Int>
+template <typename T> inline
+void AutoMatrix<Int>::GetBlock
+( Int i, Int j, Int height, Int width, T* buffer, Int ldim ) const
+{ 
+    AssertDataTypes( DataType(), ScalarType<T>::Enum );
+    GetBlock( i, j, height, width, static_cast<void*>(buffer), ldim );
+}
+
+template <typename Int>
+template <typename T> inline
+void AutoMatrix<Int>::SetBlock
+( Int i, Int j, Int height, Int width, const T* buffer, Int ldim )
+{ 
+    AssertDataTypes( DataType(), ScalarType<T>::Enum );
+    SetBlock( i, j, height, width, static_cast<const void*>(buffer), ldim );
+}
+
+template <typename Int>
+template <class Visitor> inline
+void AutoMatrix<Int>::Visit( Visitor& visitor )
+{
+    switch( DataType() )
+    {
+    case INTEGRAL: visitor( Cast_<Int>() ); break;
+#ifndef DISABLE_FLOAT
+    case SINGLE:   visitor( Cast_<float>() ); break;
+#endif
+    case DOUBLE:   visitor( Cast_<double>() ); break;
+#ifndef DISABLE_COMPLEX
+#ifndef DISABLE_FLOAT
+    case SCOMPLEX: visitor( Cast_<scomplex>() ); break;
+#endif
+    case DCOMPLEX: visitor( Cast_<dcomplex>() ); break;
+#endif
+    default: throw std::logic_error("Cannot visit a matrix of UNKNOWN type");
+    }
+}
+
+template <typename Int>
+template <class Visitor> inline
+void AutoMatrix<Int>::Visit( Visitor& visitor ) const
+{
+    switch( DataType() )
+    {
+    case INTEGRAL: visitor( Cast_<Int>() ); break;
+#ifndef DISABLE_FLOAT
+    case SINGLE:   visitor( Cast_<float>() ); break;
+#endif
+    case DOUBLE:   visitor( Cast_<double>() ); break;
+#ifndef DISABLE_COMPLEX
+#ifndef DISABLE_FLOAT
+    case SCOMPLEX: visitor( Cast_<scomplex>() ); break;
+#endif
+    case DCOMPLEX: visitor( Cast_<dcomplex>() ); break;
+#endif
+    default: throw std::logic_error("Cannot visit a matrix of UNKNOWN type");
+    }
+}
+
 //
 // Diagonal manipulation
 //
@@ -18,6 +18,18 @@ const double Pi = 3.141592653589793;
 // origin of the ring implied by the type T using the most natural metric.
 template<typename T> T SampleUnitBall();
 
+// Counter-based (Philox4x32-10) samples which only depend upon the global 
+// random seed, a stream index, and the pair (i,j). Distributed routines 
+// request a new stream for each call and sample entry (i,j) of the result
+// with these routines, so that the same seed produces the same matrix on any 
+// process grid. Since work on subgrids advances the stream counter on only a
+// subset of processes, NewRandomStream is collective over the owners of the
+// grid and returns the maximum of their counters.
+void SetRandomSeed( unsigned seed );
+unsigned RandomSeed();
+unsigned NewRandomStream( const Grid& g );
+template<typename T> T SampleUnitBall( unsigned stream, int i, int j );
+
 } // namespace elem
 
 #endif // ifndef CORE_RANDOM_DECL_HPP
@@ -67,6 +67,134 @@ SampleUnitBall<Complex<double> >()
     return Complex<double>(r*cos(angle),r*sin(angle));
 }
 
+namespace philox {
+
+// Return the high and low words of the 64-bit product of two 32-bit words 
+// using 16-bit halves, since C++98 does not guarantee a 64-bit integer type
+inline void
+MulHiLo( unsigned a, unsigned b, unsigned& hi, unsigned& lo )
+{
+    const unsigned aLo = a & 0xffffu, aHi = (a >> 16) & 0xffffu;
+    const unsigned bLo = b & 0xffffu, bHi = (b >> 16) & 0xffffu;
+    const unsigned p0 = aLo*bLo;
+    const unsigned p1 = aLo*bHi;
+    const unsigned p2 = aHi*bLo;
+    const unsigned p3 = aHi*bHi;
+    const unsigned mid = (p0 >> 16) + (p1 & 0xffffu) + (p2 & 0xffffu);
+    lo = ((p0 & 0xffffu) | (mid << 16)) & 0xffffffffu;
+    hi = (p3 + (p1 >> 16) + (p2 >> 16) + (mid >> 16)) & 0xffffffffu;
+}
+
+// Map a pair of 32-bit words to a double in [0,1) with 53 random bits
+inline double
+ToUniform( unsigned a, unsigned b )
+{ return ((a >> 5)*67108864. + (b >> 6))*(1./9007199254740992.); }
+
+} // namespace philox
+
+// Overwrite the four 32-bit words of counter with the Philox4x32-10 
+// bijection of the counter under the key (key0,key1). See 
+//
+//   J. K. Salmon, M. A. Moraes, R. O. Dror, and D. E. Shaw, 
+//   "Parallel random numbers: as easy as 1, 2, 3", SC '11.
+//
+inline void
+Philox( unsigned key0, unsigned key1, unsigned* counter )
+{
+    for( int round=0; round<10; ++round )
+    {
+        if( round > 0 )
+        {
+            key0 = (key0 + 0x9E3779B9u) & 0xffffffffu;
+            key1 = (key1 + 0xBB67AE85u) & 0xffffffffu;
+        }
+        unsigned hi0, lo0, hi1, lo1;
+        philox::MulHiLo( 0xD2511F53u, counter[0], hi0, lo0 );
+        philox::MulHiLo( 0xCD9E8D57u, counter[2], hi1, lo1 );
+        counter[0] = hi1 ^ counter[1] ^ key0;
+        counter[1] = lo1;
+        counter[2] = hi0 ^ counter[3] ^ key1;
+        counter[3] = lo0;
+    }
+}
+
+// Fill the four words of r from the (seed,stream) key and counter (i,j)
+inline void
+PhiloxWords( unsigned stream, int i, int j, unsigned* r )
+{
+    r[0] = unsigned(i);
+    r[1] = unsigned(j);
+    r[2] = 0;
+    r[3] = 0;
+    Philox( RandomSeed(), stream, r );
+}
+
+inline double 
+Uniform( unsigned stream, int i, int j )
+{
+    unsigned r[4];
+    PhiloxWords( stream, i, j, r );
+    return philox::ToUniform( r[0], r[1] );
+}
+
+template<>
+inline int
+SampleUnitBall<int>( unsigned stream, int i, int j )
+{
+    const double u = Uniform( stream, i, j );
+    if( u <= 1./3. )
+        return -1;
+    else if( u <= 2./3. )
+        return 0;
+    else
+        return +1;
+}
+
+template<>
+inline Complex<int>
+SampleUnitBall<Complex<int> >( unsigned stream, int i, int j )
+{
+    unsigned r[4];
+    PhiloxWords( stream, i, j, r );
+    const double u = philox::ToUniform( r[0], r[1] );
+    const double v = philox::ToUniform( r[2], r[3] );
+    return Complex<int>
+           ( u <= 1./3. ? -1 : (u <= 2./3. ? 0 : 1), 
+             v <= 1./3. ? -1 : (v <= 2./3. ? 0 : 1) );
+}
+
+template<>
+inline float
+SampleUnitBall<float>( unsigned stream, int i, int j )
+{ return 2*float(Uniform(stream,i,j))-1.0f; }
+
+template<>
+inline double
+SampleUnitBall<double>( unsigned stream, int i, int j )
+{ return 2*Uniform(stream,i,j)-1.0; }
+
+template<>
+inline Complex<float>
+SampleUnitBall<Complex<float> >( unsigned stream, int i, int j )
+{
+    unsigned r[4];
+    PhiloxWords( stream, i, j, r );
+    const float rad = philox::ToUniform( r[0], r[1] );
+    const float angle = 2*Pi*philox::ToUniform( r[2], r[3] );
+    return Complex<float>(rad*cos(angle),rad*sin(angle));
+}
+
+template<>
+inline Complex<double>
+SampleUnitBall<Complex<double> >( unsigned stream, int i, int j )
+{
+    unsigned r[4];
+    PhiloxWords( stream, i, j, r );
+    const double rad = philox::ToUniform( r[0], r[1] );
+    const double angle = 2*Pi*philox::ToUniform( r[2], r[3] );
+    return Complex<double>(rad*cos(angle),rad*sin(angle));
+}
+
 } // namespace elem
 
 #endif // ifndef CORE_RANDOM_IMPL_HPP
@@ -0,0 +1,121 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_TASKGRAPH_DECL_HPP
+#define CORE_TASKGRAPH_DECL_HPP
+
+namespace elem {
+
+// Defers library calls, each of which runs on a (sub)grid of the graph's grid,
+// until Wait, which runs them in an order which respects the read/write
+// dependencies declared on the matrices (or views) that they touch. Tasks 
+// which declare the same matrix depend upon each other even if it is empty or
+// resized in between, and distinct matrices are compared by the local memory
+// that they span when Wait is called. Each
+// process only runs the tasks whose grid it belongs to, so that independent
+// tasks on disjoint subgrids execute concurrently, e.g.,
+//
+//     TaskGraph graph;
+//     for( int k=0; k<numSolves; ++k )
+//         graph.Enqueue( CholeskySolve( A[k], B[k] ), *subgrids[k] )
+//              .Writes( A[k] ).Writes( B[k] );
+//     graph.Enqueue( Sum( B, C ) ).Reads( B[0] ).Writes( C );
+//     graph.Wait();
+//
+// where a functor is any copyable class with a 'void operator()()'. Every
+// process of the graph's grid must enqueue the same tasks in the same order,
+// and the subgrids must be viewed by the viewing communicator of that grid.
+//
+// Since a task is only run by the processes which own its grid, it may only
+// communicate among them: e.g., a redistribution from (or to) a matrix on
+// another grid involves processes which never run the task, and so it must
+// happen before Enqueue or after Wait rather than inside the task.
+class TaskGraph
+{
+public:
+    class Task
+    {
+    public:
+        // Declare that the task reads/writes a matrix, which must remain 
+        // alive until Wait returns
+        Task& Reads( const AutoDistMatrix<int>& A );
+        Task& Reads( const AutoMatrix<int>& A );
+        Task& Writes( AutoDistMatrix<int>& A );
+        Task& Writes( AutoMatrix<int>& A );
+
+        virtual ~Task();
+
+    protected:
+        Task( const elem::Grid& grid, int priority );
+
+    private:
+        // Exactly one of the two matrix pointers is nonzero
+        struct Access
+        {
+            const AutoDistMatrix<int>* distMatrix;
+            const AutoMatrix<int>* matrix;
+            bool write;
+        };
+
+        const elem::Grid* grid_;
+        int priority_;
+        std::vector<Access> accesses_;
+
+        virtual void Run() = 0;
+        void AddAccess
+        ( const AutoDistMatrix<int>* distMatrix, const AutoMatrix<int>* matrix,
+          bool write );
+        bool ConflictsWith( const Task& task ) const;
+
+        friend class TaskGraph;
+    };
+
+    TaskGraph( const elem::Grid& grid=DefaultGrid() );
+    ~TaskGraph();
+
+    // Local: queue a call to functor() on the given grid (by default, the
+    // graph's grid). Among the tasks whose dependencies have been met, those
+    // with higher priority are run first, then those which were queued first.
+    template<class Functor>
+    Task& Enqueue( const Functor& functor, int priority=0 );
+    template<class Functor>
+    Task& Enqueue
+    ( const Functor& functor, const elem::Grid& grid, int priority=0 );
+
+    // Collective: run all of the queued tasks
+    void Wait();
+
+    int NumPending() const;
+
+private:
+    template<class Functor>
+    class FunctorTask : public Task
+    {
+    public:
+        FunctorTask
+        ( const Functor& functor, const elem::Grid& grid, int priority );
+    private:
+        Functor functor_;
+        virtual void Run();
+    };
+
+    const elem::Grid* grid_;
+    std::vector<Task*> tasks_;
+
+    std::vector<int> Schedule() const;
+    void Clear();
+
+    // Disable copying since the graph owns its tasks
+    TaskGraph( const TaskGraph& );
+    const TaskGraph& operator=( const TaskGraph& );
+};
+
+} // namespace elem
+
+#endif // ifndef CORE_TASKGRAPH_DECL_HPP
@@ -0,0 +1,50 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_TASKGRAPH_IMPL_HPP
+#define CORE_TASKGRAPH_IMPL_HPP
+
+namespace elem {
+
+template<class Functor>
+inline
+TaskGraph::FunctorTask<Functor>::FunctorTask
+( const Functor& functor, const elem::Grid& grid, int priority )
+: Task(grid,priority), functor_(functor)
+{ }
+
+template<class Functor>
+inline void
+TaskGraph::FunctorTask<Functor>::Run()
+{ functor_(); }
+
+template<class Functor>
+inline TaskGraph::Task&
+TaskGraph::Enqueue( const Functor& functor, int priority )
+{ return Enqueue( functor, *grid_, priority ); }
+
+template<class Functor>
+inline TaskGraph::Task&
+TaskGraph::Enqueue
+( const Functor& functor, const elem::Grid& grid, int priority )
+{
+#ifndef RELEASE
+    PushCallStack("TaskGraph::Enqueue");
+#endif
+    Task* task = new FunctorTask<Functor>( functor, grid, priority );
+    tasks_.push_back( task );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return *task;
+}
+
+} // namespace elem
+
+#endif // ifndef CORE_TASKGRAPH_IMPL_HPP
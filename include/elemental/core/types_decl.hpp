@@ -144,6 +144,16 @@ enum GridOrder
 }
 using namespace grid_order_wrapper;
 
+namespace mapped_access_wrapper {
+enum MappedAccess
+{
+    MAPPED_NORMAL,     // no special treatment
+    MAPPED_SEQUENTIAL, // aggressive read-ahead, e.g., for panel sweeps
+    MAPPED_RANDOM      // no read-ahead
+};
+}
+using namespace mapped_access_wrapper;
+
 namespace left_or_right_wrapper {
 enum LeftOrRight
 {
@@ -31,7 +31,9 @@ namespace data_type_wrapper {
 		static const bool isValid = true; \
 		static const bool isComplex = ISCPLX; \
 		static const bool canBeComplex = CCPLX; \
-	};
+	}; \
+	template <typename Int> \
+	struct ScalarType<TYPE,Int> : public ScalarTypeBase<TYPE,ENUM,Int> {};
 	
 SCALARSETUP(Int,Int,INTEGRAL,false,false)
 #ifndef DISABLE_FLOAT
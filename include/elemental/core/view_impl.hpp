@@ -68,7 +68,7 @@ void View( ADM& A, ADM& B )
 { View_( A, B, false ); }
 
 template<typename T,Distribution U,Distribution V,typename Int>
-inline void View( DM& A, const DM& B )
+inline void View( DM& A, DM& B )
 { RUNDERSCORE(View_)( A, B, false ); }
 
 template <typename Int>
@@ -0,0 +1,438 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_BATCHED_HPP
+#define LAPACK_BATCHED_HPP
+
+#include "elemental/lapack-like/HermitianEig.hpp"
+#include "elemental/lapack-like/HPDSolve.hpp"
+#include "elemental/lapack-like/SVD.hpp"
+
+//
+// Drivers for many independent mid-size problems whose matrices are all
+// distributed over the same grid. The owners of the grid are partitioned
+// into equally-sized subgrids, each problem is assigned to a subgrid, its
+// inputs are copied there, the problems are solved with a TaskGraph so that
+// the subgrids work concurrently, and the results are copied back into the
+// original matrices (and distributions).
+//
+// The subgrids hold roughly (n/minLocalSize)^2 processes, where n^3 is the
+// average cost of a problem, so that each process keeps a local matrix of
+// dimension around minLocalSize; when there are fewer problems than
+// subgrids, the subgrids are enlarged instead. Problems are assigned to
+// subgrids largest first, each to the least loaded subgrid.
+//
+
+namespace elem {
+namespace batched {
+
+// The subgrids of a batch and the assignment of problems to them
+class Plan
+{
+public:
+    Plan( const Grid& g, const std::vector<double>& costs, int minLocalSize );
+    ~Plan();
+
+    int NumSubgrids() const { return subgrids_.size(); }
+    const Grid& Subgrid( int k ) const { return *subgrids_[assignment_[k]]; }
+
+private:
+    std::vector<mpi::Group> groups_;
+    std::vector<Grid*> subgrids_;
+    std::vector<int> assignment_;
+
+    Plan( const Plan& );
+    const Plan& operator=( const Plan& );
+};
+
+inline
+Plan::Plan( const Grid& g, const std::vector<double>& costs, int minLocalSize )
+{
+#ifndef RELEASE
+    PushCallStack("batched::Plan::Plan");
+    if( minLocalSize < 1 )
+        throw std::logic_error("minLocalSize must be positive");
+#endif
+    const int numProblems = costs.size();
+    const int p = g.Size();
+
+    double meanCost = 0;
+    for( int k=0; k<numProblems; ++k )
+        meanCost += costs[k] / numProblems;
+    const double nEff = std::pow( meanCost, 1./3 );
+    const int target =
+        std::max( 1, std::min( p, int(nEff*nEff/minLocalSize/minLocalSize) ) );
+    const int numSubgrids = std::max( 1, std::min( numProblems, p/target ) );
+    const int subgridSize = p / numSubgrids;
+
+    // Any leftover owners sit out
+    std::vector<int> ranks( subgridSize );
+    for( int s=0; s<numSubgrids; ++s )
+    {
+        for( int q=0; q<subgridSize; ++q )
+            ranks[q] = s*subgridSize + q;
+        mpi::Group group;
+        mpi::GroupIncl( g.OwningGroup(), subgridSize, &ranks[0], group );
+        groups_.push_back( group );
+        subgrids_.push_back( new Grid( g.ViewingComm(), group ) );
+    }
+
+    // Longest-processing-time-first assignment
+    std::vector<std::pair<double,int> > order( numProblems );
+    for( int k=0; k<numProblems; ++k )
+        order[k] = std::make_pair( -costs[k], k );
+    std::sort( order.begin(), order.end() );
+    std::vector<double> loads( numSubgrids, 0 );
+    assignment_.resize( numProblems );
+    for( int l=0; l<numProblems; ++l )
+    {
+        const int k = order[l].second;
+        const int s =
+            std::min_element( loads.begin(), loads.end() ) - loads.begin();
+        assignment_[k] = s;
+        loads[s] += costs[k];
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+inline
+Plan::~Plan()
+{
+    for( std::size_t s=0; s<subgrids_.size(); ++s )
+    {
+        delete subgrids_[s];
+        if( !mpi::Finalized() )
+            mpi::GroupFree( groups_[s] );
+    }
+}
+
+// The cross-grid redistributions only support [MC,MR] and [* ,* ] matrices,
+// so the (short) vectors of results are routed through [* ,* ] copies
+template<typename R>
+inline void
+CopyVector( const DistMatrix<R,VR,STAR>& x, DistMatrix<R,VR,STAR>& y )
+{
+#ifndef RELEASE
+    PushCallStack("batched::CopyVector");
+#endif
+    DistMatrix<R,STAR,STAR> x_STAR_STAR( x.Grid() ), y_STAR_STAR( y.Grid() );
+    x_STAR_STAR = x;
+    y_STAR_STAR = x_STAR_STAR;
+    y = y_STAR_STAR;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Since only the members of a subgrid run its problems, the other processes
+// learn the sizes of the results from them
+inline void
+AgreeOnSizes( std::vector<int>& sizes, mpi::Comm comm )
+{ mpi::AllReduce( &sizes[0], sizes.size(), mpi::MAX, comm ); }
+
+template<typename F>
+struct HPDSolveTask
+{
+    UpperOrLower uplo;
+    Orientation orientation;
+    DistMatrix<F>* A;
+    DistMatrix<F>* B;
+
+    HPDSolveTask
+    ( UpperOrLower uplo_, Orientation orientation_,
+      DistMatrix<F>& A_, DistMatrix<F>& B_ )
+    : uplo(uplo_), orientation(orientation_), A(&A_), B(&B_)
+    { }
+
+    void operator()() { HPDSolve( uplo, orientation, *A, *B ); }
+};
+
+template<typename F>
+struct HermitianEigTask
+{
+    typedef typename Base<F>::type R;
+
+    UpperOrLower uplo;
+    DistMatrix<F>* A;
+    DistMatrix<R,VR,STAR>* w;
+    DistMatrix<F>* Z;
+
+    HermitianEigTask
+    ( UpperOrLower uplo_, DistMatrix<F>& A_, DistMatrix<R,VR,STAR>& w_,
+      DistMatrix<F>& Z_ )
+    : uplo(uplo_), A(&A_), w(&w_), Z(&Z_)
+    { }
+
+    void operator()() { HermitianEig( uplo, *A, *w, *Z ); }
+};
+
+template<typename F>
+struct SVDTask
+{
+    typedef typename Base<F>::type R;
+
+    DistMatrix<F>* A;
+    DistMatrix<R,VR,STAR>* s;
+    DistMatrix<F>* V;
+
+    SVDTask( DistMatrix<F>& A_, DistMatrix<R,VR,STAR>& s_, DistMatrix<F>& V_ )
+    : A(&A_), s(&s_), V(&V_)
+    { }
+
+    void operator()() { SVD( *A, *s, *V ); }
+};
+
+} // namespace batched
+
+//
+// Overwrite each B[k] with inv(A[k]) B[k] (or the (conjugate-)transposed
+// variant), where each A[k] is HPD, and A[k] with its Cholesky factor
+//
+
+template<typename F>
+inline void
+BatchedHPDSolve
+( UpperOrLower uplo, Orientation orientation,
+  const std::vector<DistMatrix<F>*>& A, const std::vector<DistMatrix<F>*>& B,
+  int minLocalSize=1000 )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedHPDSolve");
+    if( A.size() != B.size() )
+        throw std::logic_error("Must have as many right-hand sides as matrices");
+#endif
+    const int numProblems = A.size();
+    if( numProblems == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+    const Grid& g = A[0]->Grid();
+    std::vector<double> costs( numProblems );
+    for( int k=0; k<numProblems; ++k )
+    {
+#ifndef RELEASE
+        if( A[k]->Grid() != g || B[k]->Grid() != g )
+            throw std::logic_error("All matrices must share a grid");
+        if( A[k]->Height() != A[k]->Width() )
+            throw std::logic_error("A must be square");
+        if( A[k]->Height() != B[k]->Height() )
+            throw std::logic_error("A and B must be the same height");
+#endif
+        const double n = A[k]->Height();
+        costs[k] = n*n*(n+B[k]->Width());
+    }
+    batched::Plan plan( g, costs, minLocalSize );
+
+    std::vector<DistMatrix<F>*> ASub( numProblems ), BSub( numProblems );
+    TaskGraph graph( g );
+    for( int k=0; k<numProblems; ++k )
+    {
+        const Grid& subgrid = plan.Subgrid( k );
+        ASub[k] = new DistMatrix<F>( subgrid );
+        BSub[k] = new DistMatrix<F>( subgrid );
+        *ASub[k] = *A[k];
+        *BSub[k] = *B[k];
+        graph.Enqueue
+        ( batched::HPDSolveTask<F>( uplo, orientation, *ASub[k], *BSub[k] ),
+          subgrid ).Writes( *ASub[k] ).Writes( *BSub[k] );
+    }
+    graph.Wait();
+
+    for( int k=0; k<numProblems; ++k )
+    {
+        *A[k] = *ASub[k];
+        *B[k] = *BSub[k];
+        delete ASub[k];
+        delete BSub[k];
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// Compute the eigenvalues w[k] and eigenvectors Z[k] of each Hermitian A[k],
+// which is left unchanged. As for HermitianEig, F must be double or
+// Complex<double>.
+//
+
+template<typename F>
+inline void
+BatchedHermitianEig
+( UpperOrLower uplo, const std::vector<DistMatrix<F>*>& A,
+  const std::vector<DistMatrix<typename Base<F>::type,VR,STAR>*>& w,
+  const std::vector<DistMatrix<F>*>& Z, int minLocalSize=1000 )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedHermitianEig");
+    if( A.size() != w.size() || A.size() != Z.size() )
+        throw std::logic_error("Must have as many outputs as matrices");
+#endif
+    typedef typename Base<F>::type R;
+    const int numProblems = A.size();
+    if( numProblems == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+    const Grid& g = A[0]->Grid();
+    std::vector<double> costs( numProblems );
+    for( int k=0; k<numProblems; ++k )
+    {
+#ifndef RELEASE
+        if( A[k]->Grid() != g || w[k]->Grid() != g || Z[k]->Grid() != g )
+            throw std::logic_error("All matrices must share a grid");
+        if( A[k]->Height() != A[k]->Width() )
+            throw std::logic_error("A must be square");
+#endif
+        const double n = A[k]->Height();
+        costs[k] = n*n*n;
+    }
+    batched::Plan plan( g, costs, minLocalSize );
+
+    std::vector<DistMatrix<F>*> ASub( numProblems ), ZSub( numProblems );
+    std::vector<DistMatrix<R,VR,STAR>*> wSub( numProblems );
+    TaskGraph graph( g );
+    for( int k=0; k<numProblems; ++k )
+    {
+        const Grid& subgrid = plan.Subgrid( k );
+        ASub[k] = new DistMatrix<F>( subgrid );
+        wSub[k] = new DistMatrix<R,VR,STAR>( subgrid );
+        ZSub[k] = new DistMatrix<F>( subgrid );
+        *ASub[k] = *A[k];
+        graph.Enqueue
+        ( batched::HermitianEigTask<F>( uplo, *ASub[k], *wSub[k], *ZSub[k] ),
+          subgrid )
+        .Writes( *ASub[k] ).Writes( *wSub[k] ).Writes( *ZSub[k] );
+    }
+    graph.Wait();
+
+    std::vector<int> sizes( 3*numProblems, 0 );
+    for( int k=0; k<numProblems; ++k )
+    {
+        if( plan.Subgrid( k ).InGrid() )
+        {
+            sizes[3*k+0] = wSub[k]->Height();
+            sizes[3*k+1] = ZSub[k]->Height();
+            sizes[3*k+2] = ZSub[k]->Width();
+        }
+    }
+    batched::AgreeOnSizes( sizes, g.ViewingComm() );
+    for( int k=0; k<numProblems; ++k )
+    {
+        wSub[k]->ResizeTo( sizes[3*k+0], 1 );
+        ZSub[k]->ResizeTo( sizes[3*k+1], sizes[3*k+2] );
+        batched::CopyVector( *wSub[k], *w[k] );
+        *Z[k] = *ZSub[k];
+        delete ASub[k];
+        delete wSub[k];
+        delete ZSub[k];
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// Compute the SVD of each A[k], overwriting A[k] with its left singular
+// vectors, and returning the singular values in s[k] and the right singular
+// vectors in V[k]
+//
+
+template<typename F>
+inline void
+BatchedSVD
+( const std::vector<DistMatrix<F>*>& A,
+  const std::vector<DistMatrix<typename Base<F>::type,VR,STAR>*>& s,
+  const std::vector<DistMatrix<F>*>& V, int minLocalSize=1000 )
+{
+#ifndef RELEASE
+    PushCallStack("BatchedSVD");
+    if( A.size() != s.size() || A.size() != V.size() )
+        throw std::logic_error("Must have as many outputs as matrices");
+#endif
+    typedef typename Base<F>::type R;
+    const int numProblems = A.size();
+    if( numProblems == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+    const Grid& g = A[0]->Grid();
+    std::vector<double> costs( numProblems );
+    for( int k=0; k<numProblems; ++k )
+    {
+#ifndef RELEASE
+        if( A[k]->Grid() != g || s[k]->Grid() != g || V[k]->Grid() != g )
+            throw std::logic_error("All matrices must share a grid");
+#endif
+        const double m = A[k]->Height();
+        const double n = A[k]->Width();
+        costs[k] = m*n*std::min(m,n);
+    }
+    batched::Plan plan( g, costs, minLocalSize );
+
+    std::vector<DistMatrix<F>*> ASub( numProblems ), VSub( numProblems );
+    std::vector<DistMatrix<R,VR,STAR>*> sSub( numProblems );
+    TaskGraph graph( g );
+    for( int k=0; k<numProblems; ++k )
+    {
+        const Grid& subgrid = plan.Subgrid( k );
+        ASub[k] = new DistMatrix<F>( subgrid );
+        sSub[k] = new DistMatrix<R,VR,STAR>( subgrid );
+        VSub[k] = new DistMatrix<F>( subgrid );
+        *ASub[k] = *A[k];
+        graph.Enqueue
+        ( batched::SVDTask<F>( *ASub[k], *sSub[k], *VSub[k] ), subgrid )
+        .Writes( *ASub[k] ).Writes( *sSub[k] ).Writes( *VSub[k] );
+    }
+    graph.Wait();
+
+    std::vector<int> sizes( 5*numProblems, 0 );
+    for( int k=0; k<numProblems; ++k )
+    {
+        if( plan.Subgrid( k ).InGrid() )
+        {
+            sizes[5*k+0] = ASub[k]->Height();
+            sizes[5*k+1] = ASub[k]->Width();
+            sizes[5*k+2] = sSub[k]->Height();
+            sizes[5*k+3] = VSub[k]->Height();
+            sizes[5*k+4] = VSub[k]->Width();
+        }
+    }
+    batched::AgreeOnSizes( sizes, g.ViewingComm() );
+    for( int k=0; k<numProblems; ++k )
+    {
+        ASub[k]->ResizeTo( sizes[5*k+0], sizes[5*k+1] );
+        sSub[k]->ResizeTo( sizes[5*k+2], 1 );
+        VSub[k]->ResizeTo( sizes[5*k+3], sizes[5*k+4] );
+        *A[k] = *ASub[k];
+        batched::CopyVector( *sSub[k], *s[k] );
+        *V[k] = *VSub[k];
+        delete ASub[k];
+        delete sSub[k];
+        delete VSub[k];
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_BATCHED_HPP
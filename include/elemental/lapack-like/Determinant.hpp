@@ -52,7 +52,8 @@ SafeHPDDeterminant( UpperOrLower uplo, const Matrix<F>& A )
 #ifndef RELEASE
     PushCallStack("SafeHPDDeterminant");
 #endif
-    Matrix<F> B( A );
+    Matrix<F> B;
+    B = A;
     SafeProduct<F> det = hpd_determinant::Cholesky( uplo, B ); 
 #ifndef RELEASE
     PopCallStack();
@@ -67,7 +68,8 @@ SafeHPDDeterminant( UpperOrLower uplo, const DistMatrix<F>& A )
 #ifndef RELEASE
     PushCallStack("SafeHPDDeterminant");
 #endif
-    DistMatrix<F> B( A );
+    DistMatrix<F> B( A.Grid() );
+    B = A;
     SafeProduct<F> det = hpd_determinant::Cholesky( uplo, B ); 
 #ifndef RELEASE
     PopCallStack();
@@ -0,0 +1,267 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_EXP_HPP
+#define LAPACK_EXP_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/GaussianElimination.hpp"
+#include "elemental/lapack-like/Norm/One.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// The matrix exponential via scaling and squaring with a diagonal Pade
+// approximant of degree m in {3,5,7,9,13}, chosen from the one-norm of A
+// as in
+//
+//   N. J. Higham, "The scaling and squaring method for the matrix
+//   exponential revisited", SIAM J. Matrix Anal. Appl., 26(4), 2005.
+//
+// The approximant r_m(A) = (V-U)^{-1} (V+U), where U and V are the odd and
+// even parts of the numerator, only requires matrix-matrix multiplications
+// and a single linear solve.
+//
+
+namespace elem {
+
+namespace exp_pade {
+
+// Return the degree of the Pade approximant and the number of squarings
+template<typename R>
+inline void
+Degree( R oneNorm, int& m, int& s )
+{
+    const R theta3 = 1.495585217958292e-2;
+    const R theta5 = 2.539398330063230e-1;
+    const R theta7 = 9.504178996162932e-1;
+    const R theta9 = 2.097847961257068e0;
+    const R theta13 = 5.371920351148152e0;
+    s = 0;
+    if( oneNorm <= theta3 )
+        m = 3;
+    else if( oneNorm <= theta5 )
+        m = 5;
+    else if( oneNorm <= theta7 )
+        m = 7;
+    else if( oneNorm <= theta9 )
+        m = 9;
+    else
+    {
+        m = 13;
+        s = std::max( 0, int(std::ceil(std::log(oneNorm/theta13)/std::log(2.))) );
+    }
+}
+
+// The coefficients b_0, ..., b_m of the numerator of the degree m approximant
+inline const double*
+Coefficients( int m )
+{
+    static const double b3[] = { 120., 60., 12., 1. };
+    static const double b5[] = { 30240., 15120., 3360., 420., 30., 1. };
+    static const double b7[] =
+    { 17297280., 8648640., 1995840., 277200., 25200., 1512., 56., 1. };
+    static const double b9[] =
+    { 17643225600., 8821612800., 2075673600., 302702400., 30270240.,
+      2162160., 110880., 3960., 90., 1. };
+    static const double b13[] =
+    { 64764752532480000., 32382376266240000., 7771770303897600.,
+      1187353796428800., 129060195264000., 10559470521600.,
+      670442572800., 33522128640., 1323241920., 40840800., 960960.,
+      16380., 182., 1. };
+    switch( m )
+    {
+    case 3: return b3;
+    case 5: return b5;
+    case 7: return b7;
+    case 9: return b9;
+    default: return b13;
+    }
+}
+
+} // namespace exp_pade
+
+template<typename F>
+inline void
+Exp( Matrix<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("Exp");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    typedef typename Base<F>::type R;
+    const int n = A.Height();
+
+    int m, s;
+    exp_pade::Degree( OneNorm(A), m, s );
+    const double* b = exp_pade::Coefficients( m );
+    if( s > 0 )
+        Scale( R(1)/Pow(R(2),R(s)), A );
+
+    Matrix<F> A2, U, V, T;
+    Zeros( n, n, A2 );
+    Gemm( NORMAL, NORMAL, F(1), A, A, F(0), A2 );
+    Identity( n, n, U );
+    Identity( n, n, V );
+    Scale( F(b[1]), U );
+    Scale( F(b[0]), V );
+    if( m < 13 )
+    {
+        // U := A sum_k b_{2k+1} A^{2k} and V := sum_k b_{2k} A^{2k}
+        Matrix<F> P, PLast;
+        P = A2;
+        for( int k=1; 2*k<m; ++k )
+        {
+            if( k > 1 )
+            {
+                PLast = P;
+                Gemm( NORMAL, NORMAL, F(1), PLast, A2, F(0), P );
+            }
+            Axpy( F(b[2*k+1]), P, U );
+            Axpy( F(b[2*k]), P, V );
+        }
+    }
+    else
+    {
+        // U := A [A6 (b13 A6 + b11 A4 + b9 A2) + b7 A6 + b5 A4 + b3 A2 + b1 I]
+        // V := A6 (b12 A6 + b10 A4 + b8 A2) + b6 A6 + b4 A4 + b2 A2 + b0 I
+        Matrix<F> A4, A6;
+        Zeros( n, n, A4 );
+        Zeros( n, n, A6 );
+        Gemm( NORMAL, NORMAL, F(1), A2, A2, F(0), A4 );
+        Gemm( NORMAL, NORMAL, F(1), A4, A2, F(0), A6 );
+        Axpy( F(b[3]), A2, U );
+        Axpy( F(b[5]), A4, U );
+        Axpy( F(b[7]), A6, U );
+        Axpy( F(b[2]), A2, V );
+        Axpy( F(b[4]), A4, V );
+        Axpy( F(b[6]), A6, V );
+        Zeros( n, n, T );
+        Axpy( F(b[9]), A2, T );
+        Axpy( F(b[11]), A4, T );
+        Axpy( F(b[13]), A6, T );
+        Gemm( NORMAL, NORMAL, F(1), A6, T, F(1), U );
+        Zeros( n, n, T );
+        Axpy( F(b[8]), A2, T );
+        Axpy( F(b[10]), A4, T );
+        Axpy( F(b[12]), A6, T );
+        Gemm( NORMAL, NORMAL, F(1), A6, T, F(1), V );
+    }
+    T = U;
+    Gemm( NORMAL, NORMAL, F(1), A, T, F(0), U );
+
+    // Solve (V - U) X = (V + U), and then square X s times
+    T = V;
+    Axpy( F(-1), U, T );
+    Axpy( F(1), V, U );
+    GaussianElimination( T, U );
+    A = U;
+    for( int j=0; j<s; ++j )
+    {
+        T = A;
+        Gemm( NORMAL, NORMAL, F(1), T, T, F(0), A );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+Exp( DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("Exp");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+
+    int m, s;
+    exp_pade::Degree( OneNorm(A), m, s );
+    const double* b = exp_pade::Coefficients( m );
+    if( s > 0 )
+        Scale( R(1)/Pow(R(2),R(s)), A );
+
+    DistMatrix<F> A2( g ), U( g ), V( g ), T( g );
+    Zeros( n, n, A2 );
+    Gemm( NORMAL, NORMAL, F(1), A, A, F(0), A2 );
+    Identity( n, n, U );
+    Identity( n, n, V );
+    Scale( F(b[1]), U );
+    Scale( F(b[0]), V );
+    if( m < 13 )
+    {
+        // U := A sum_k b_{2k+1} A^{2k} and V := sum_k b_{2k} A^{2k}
+        DistMatrix<F> P( g ), PLast( g );
+        P = A2;
+        for( int k=1; 2*k<m; ++k )
+        {
+            if( k > 1 )
+            {
+                PLast = P;
+                Gemm( NORMAL, NORMAL, F(1), PLast, A2, F(0), P );
+            }
+            Axpy( F(b[2*k+1]), P, U );
+            Axpy( F(b[2*k]), P, V );
+        }
+    }
+    else
+    {
+        // U := A [A6 (b13 A6 + b11 A4 + b9 A2) + b7 A6 + b5 A4 + b3 A2 + b1 I]
+        // V := A6 (b12 A6 + b10 A4 + b8 A2) + b6 A6 + b4 A4 + b2 A2 + b0 I
+        DistMatrix<F> A4( g ), A6( g );
+        Zeros( n, n, A4 );
+        Zeros( n, n, A6 );
+        Gemm( NORMAL, NORMAL, F(1), A2, A2, F(0), A4 );
+        Gemm( NORMAL, NORMAL, F(1), A4, A2, F(0), A6 );
+        Axpy( F(b[3]), A2, U );
+        Axpy( F(b[5]), A4, U );
+        Axpy( F(b[7]), A6, U );
+        Axpy( F(b[2]), A2, V );
+        Axpy( F(b[4]), A4, V );
+        Axpy( F(b[6]), A6, V );
+        Zeros( n, n, T );
+        Axpy( F(b[9]), A2, T );
+        Axpy( F(b[11]), A4, T );
+        Axpy( F(b[13]), A6, T );
+        Gemm( NORMAL, NORMAL, F(1), A6, T, F(1), U );
+        Zeros( n, n, T );
+        Axpy( F(b[8]), A2, T );
+        Axpy( F(b[10]), A4, T );
+        Axpy( F(b[12]), A6, T );
+        Gemm( NORMAL, NORMAL, F(1), A6, T, F(1), V );
+    }
+    T = U;
+    Gemm( NORMAL, NORMAL, F(1), A, T, F(0), U );
+
+    // Solve (V - U) X = (V + U), and then square X s times
+    T = V;
+    Axpy( F(-1), U, T );
+    Axpy( F(1), V, U );
+    GaussianElimination( T, U );
+    A = U;
+    for( int j=0; j<s; ++j )
+    {
+        T = A;
+        Gemm( NORMAL, NORMAL, F(1), T, T, F(0), A );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_EXP_HPP
@@ -10,8 +10,6 @@
 #ifndef LAPACK_HPSDCHOLESKY_HPP
 #define LAPACK_HPSDCHOLESKY_HPP
 
-#ifdef HAVE_PMRRR
-
 #include "elemental/blas-like/level1/MakeHermitian.hpp"
 #include "elemental/blas-like/level1/MakeTriangular.hpp"
 #include "elemental/lapack-like/HPSDSquareRoot.hpp"
@@ -80,6 +78,4 @@ HPSDCholesky( UpperOrLower uplo, DistMatrix<Complex<R> >& A )
 
 } // namespace elem
 
-#endif // ifdef HAVE_PMRRR
-
 #endif // ifndef LAPACK_HPSDCHOLESKY_HPP
@@ -10,8 +10,6 @@
 #ifndef LAPACK_HPSDSQUAREROOT_HPP
 #define LAPACK_HPSDSQUAREROOT_HPP
 
-#ifdef HAVE_PMRRR
-
 #include "elemental/lapack-like/HermitianFunction.hpp"
 #include "elemental/lapack-like/Norm/Max.hpp"
 
@@ -79,6 +77,4 @@ HPSDSquareRoot( UpperOrLower uplo, DistMatrix<F>& A )
 
 } // namespace elem
 
-#endif // ifdef HAVE_PMRRR
-
 #endif // ifndef LAPACK_HPSDSQUAREROOT_HPP
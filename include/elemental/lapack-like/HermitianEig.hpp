@@ -13,5 +13,6 @@
 // NOTE: HermitianEig declarations are in lapack-like_decl.hpp
 
 #include "elemental/lapack-like/HermitianEig/Sort.hpp"
+#include "elemental/lapack-like/HermitianEig/SDC.hpp"
 
 #endif // ifndef LAPACK_HERMITIANEIG_HPP
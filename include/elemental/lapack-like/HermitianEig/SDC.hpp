@@ -0,0 +1,492 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_HERMITIANEIG_SDC_HPP
+#define LAPACK_HERMITIANEIG_SDC_HPP
+
+#include <algorithm>
+
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/HermitianEig/Sort.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/Polar/QDWH.hpp"
+#include "elemental/lapack-like/QR.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// Spectral divide and conquer based upon the QDWH polar decomposition, as
+// described in
+//
+//   Y. Nakatsukasa and N. J. Higham, "Stable and efficient spectral divide
+//   and conquer algorithms for the symmetric eigenvalue decomposition and
+//   the SVD", SIAM J. Sci. Comput., 35(3), 2013.
+//
+// The polar factor U of A - sigma I is Hermitian with eigenvalues +-1, so
+// (U+I)/2 is the orthogonal projector onto the invariant subspace of A
+// associated with the eigenvalues greater than sigma. A basis for its range
+// is found with subspace iteration, and the two decoupled diagonal blocks of
+// the rotated matrix are recursively solved, in parallel, on disjoint
+// subgrids. Every step is built from QR, Cholesky and Gemm.
+//
+
+namespace elem {
+namespace hermitian_eig {
+
+// The tridiagonalization-based solvers behind HermitianEig's full-spectrum
+// drivers, which are defined in src/lapack-like/HermitianEig.cpp
+void TridiagEig
+( UpperOrLower uplo, DistMatrix<double>& A,
+  DistMatrix<double,VR,STAR>& w, DistMatrix<double>& paddedZ );
+void TridiagEig
+( UpperOrLower uplo, DistMatrix<double>& A,
+  DistMatrix<double,VR,STAR>& w );
+void TridiagEig
+( UpperOrLower uplo, DistMatrix<Complex<double> >& A,
+  DistMatrix<double,VR,STAR>& w, DistMatrix<Complex<double> >& paddedZ );
+void TridiagEig
+( UpperOrLower uplo, DistMatrix<Complex<double> >& A,
+  DistMatrix<double,VR,STAR>& w );
+
+namespace sdc {
+
+template<typename F>
+inline bool
+BaseCase( const DistMatrix<F>& A )
+{
+    return A.Grid().Size() == 1 ||
+           A.Height() <= GetHermitianEigSDCCutoff();
+}
+
+// Solve a subproblem through tridiagonalization, regardless of the current
+// choice of HermitianEigApproach
+template<typename F>
+inline void
+TridiagEig
+( DistMatrix<F>& A, DistMatrix<typename Base<F>::type,STAR,STAR>& w,
+  DistMatrix<F>& Z, bool computeVectors )
+{
+    typedef typename Base<F>::type R;
+    DistMatrix<R,VR,STAR> w_VR_STAR( A.Grid() );
+    if( computeVectors )
+    {
+        hermitian_eig::TridiagEig( LOWER, A, w_VR_STAR, Z );
+        hermitian_eig::Sort( w_VR_STAR, Z );
+    }
+    else
+    {
+        hermitian_eig::TridiagEig( LOWER, A, w_VR_STAR );
+        hermitian_eig::Sort( w_VR_STAR );
+    }
+    w = w_VR_STAR;
+}
+
+// Return the real part of the diagonal of A on every process
+template<typename F>
+inline void
+GatherDiagonal( const DistMatrix<F>& A, std::vector<typename Base<F>::type>& d )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    d.assign( n, R(0) );
+    for( int jLocal=0; jLocal<A.LocalWidth(); ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        if( (j-colShift) % colStride == 0 )
+        {
+            const int iLocal = (j-colShift) / colStride;
+            d[j] = RealPart( A.GetLocal(iLocal,jLocal) );
+        }
+    }
+    if( n > 0 )
+        mpi::AllReduce( &d[0], n, mpi::SUM, g.VCComm() );
+}
+
+template<typename F>
+inline void
+ShiftDiagonal( DistMatrix<F>& A, F alpha )
+{
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    for( int jLocal=0; jLocal<A.LocalWidth(); ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        if( (j-colShift) % colStride == 0 )
+        {
+            const int iLocal = (j-colShift) / colStride;
+            A.SetLocal( iLocal, jLocal, A.GetLocal(iLocal,jLocal)+alpha );
+        }
+    }
+}
+
+//
+// Attempt to find a unitary Q such that Q^H A Q is block diagonal, with the
+// k eigenvalues greater than the splitting point in the leading block.
+// Returns false if no useful split was found.
+//
+template<typename F>
+inline bool
+Split( const DistMatrix<F>& A, DistMatrix<F>& Q, int& k )
+{
+#ifndef RELEASE
+    PushCallStack("hermitian_eig::sdc::Split");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const R eps = lapack::MachineEpsilon<R>();
+    const R frobA = FrobeniusNorm( A );
+
+    // Split at the median of the diagonal, perturbing it if all of the
+    // eigenvalues happen to fall on one side
+    std::vector<R> d;
+    GatherDiagonal( A, d );
+    std::nth_element( d.begin(), d.begin()+n/2, d.end() );
+    const R median = d[n/2];
+    const R minDiag = *std::min_element( d.begin(), d.end() );
+    const R maxDiag = *std::max_element( d.begin(), d.end() );
+
+    DistMatrix<F> P( g ), X( g ), Y( g ), QL( g );
+    const int maxAttempts = 3;
+    for( int attempt=0; attempt<maxAttempts; ++attempt )
+    {
+        const R sigma = median + attempt*(maxDiag-minDiag)/(4*maxAttempts) +
+                        attempt*Sqrt(eps)*frobA;
+
+        // Form the spectral projector (U+I)/2, where U is the polar factor
+        // of A - sigma I
+        P = A;
+        ShiftDiagonal( P, F(-sigma) );
+        const R upperBound = FrobeniusNorm( P );
+        if( upperBound == R(0) )
+            break;
+        hermitian_polar::QDWH( LOWER, P, eps, upperBound );
+        ShiftDiagonal( P, F(1) );
+        Scale( F(R(1)/R(2)), P );
+
+        // Its trace is the dimension of the invariant subspace
+        GatherDiagonal( P, d );
+        R trace = 0;
+        for( int i=0; i<n; ++i )
+            trace += d[i];
+        k = int(trace+R(1)/R(2));
+        if( k <= 0 || k >= n )
+            continue;
+
+        // Two steps of subspace iteration yield a basis for the range of P
+        Uniform( n, k, X );
+        for( int it=0; it<2; ++it )
+        {
+            Zeros( n, k, Y );
+            Gemm( NORMAL, NORMAL, F(1), P, X, F(0), Y );
+            X = Y;
+            qr::Explicit( X );
+        }
+
+        // Complete the basis to a unitary matrix while preserving the span
+        // of its first k columns
+        Uniform( n, n, Q );
+        View( QL, Q, 0, 0, n, k );
+        QL = X;
+        qr::Explicit( Q );
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return true;
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return false;
+}
+
+template<typename F>
+inline void
+Recurse
+( DistMatrix<F>& A, DistMatrix<typename Base<F>::type,STAR,STAR>& w,
+  DistMatrix<F>& Z, bool computeVectors );
+
+// Solve the two decoupled subproblems on disjoint subgrids, with process
+// counts roughly proportional to their cubed dimensions
+template<typename F>
+inline void
+RecurseOnSubgrids
+( const DistMatrix<F>& A1, const DistMatrix<F>& A2,
+  DistMatrix<typename Base<F>::type,STAR,STAR>& w1,
+  DistMatrix<typename Base<F>::type,STAR,STAR>& w2,
+  DistMatrix<F>& Z1, DistMatrix<F>& Z2, bool computeVectors )
+{
+#ifndef RELEASE
+    PushCallStack("hermitian_eig::sdc::RecurseOnSubgrids");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A1.Grid();
+    const int p = g.Size();
+    const int n1 = A1.Height();
+    const int n2 = A2.Height();
+    const double work1 = double(n1)*n1*n1;
+    const double work2 = double(n2)*n2*n2;
+    const int p1 =
+        std::max( 1, std::min( p-1, int(p*work1/(work1+work2)+0.5) ) );
+    const int p2 = p - p1;
+    const bool inFirst = ( g.VCRank() < p1 );
+
+    std::vector<int> ranks1( p1 ), ranks2( p2 );
+    for( int q=0; q<p1; ++q )
+        ranks1[q] = q;
+    for( int q=0; q<p2; ++q )
+        ranks2[q] = p1 + q;
+    mpi::Group owningGroup = g.OwningGroup();
+    mpi::Group group1, group2;
+    mpi::GroupIncl( owningGroup, p1, &ranks1[0], group1 );
+    mpi::GroupIncl( owningGroup, p2, &ranks2[0], group2 );
+    const int height1 = Grid::FindFactor( p1 );
+    const int height2 = Grid::FindFactor( p2 );
+
+    {
+        // Move each subproblem onto its subgrid (of the current viewers)
+        const Grid grid1( g.ViewingComm(), group1, height1, p1/height1 );
+        const Grid grid2( g.ViewingComm(), group2, height2, p2/height2 );
+        DistMatrix<F> A1Sub( grid1 ), A2Sub( grid2 ),
+                      Z1Sub( grid1 ), Z2Sub( grid2 );
+        A1Sub = A1;
+        A2Sub = A2;
+
+        // The recursion must only involve the processes of each subgrid, so
+        // we alias the subgrid's data with a grid built directly from its
+        // owners. Since both grids have the same shape and process ordering,
+        // the local data is identical.
+        mpi::Comm subComm;
+        mpi::CommSplit( g.VCComm(), inFirst ? 0 : 1, g.VCRank(), subComm );
+        {
+            const int subHeight = ( inFirst ? height1 : height2 );
+            const int subWidth = ( inFirst ? p1/height1 : p2/height2 );
+            const Grid subGrid( subComm, subHeight, subWidth );
+            DistMatrix<F>& AView = ( inFirst ? A1Sub : A2Sub );
+            DistMatrix<F>& ZView = ( inFirst ? Z1Sub : Z2Sub );
+            DistMatrix<F> ASub( AView.Height(), AView.Width(), subGrid ),
+                          ZSub( subGrid );
+            DistMatrix<R,STAR,STAR> wSub( subGrid );
+            ASub.Matrix() = AView.LockedMatrix();
+            AView.Empty();
+
+            Recurse( ASub, wSub, ZSub, computeVectors );
+
+            DistMatrix<R,STAR,STAR>& wOut = ( inFirst ? w1 : w2 );
+            wOut.ResizeTo( wSub.Height(), 1 );
+            MemCopy( wOut.Buffer(), wSub.LockedBuffer(), wSub.Height() );
+            if( computeVectors )
+            {
+                ZView.ResizeTo( ZSub.Height(), ZSub.Width() );
+                ZView.Matrix() = ZSub.LockedMatrix();
+            }
+        }
+        mpi::CommFree( subComm );
+
+        // Share the eigenvalues from the root of each subgrid and then
+        // return the eigenvectors to the original grid
+        w1.ResizeTo( n1, 1 );
+        w2.ResizeTo( n2, 1 );
+        if( n1 > 0 )
+            mpi::Broadcast( w1.Buffer(), n1, 0, g.VCComm() );
+        if( n2 > 0 )
+            mpi::Broadcast( w2.Buffer(), n2, p1, g.VCComm() );
+        if( computeVectors )
+        {
+            Z1Sub.ResizeTo( n1, n1 );
+            Z2Sub.ResizeTo( n2, n2 );
+            Z1 = Z1Sub;
+            Z2 = Z2Sub;
+        }
+    }
+    mpi::GroupFree( group1 );
+    mpi::GroupFree( group2 );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// A must be explicitly Hermitian on entry, and the eigenvalues are returned
+// in ascending order
+template<typename F>
+inline void
+Recurse
+( DistMatrix<F>& A, DistMatrix<typename Base<F>::type,STAR,STAR>& w,
+  DistMatrix<F>& Z, bool computeVectors )
+{
+#ifndef RELEASE
+    PushCallStack("hermitian_eig::sdc::Recurse");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const R eps = lapack::MachineEpsilon<R>();
+
+    int k = 0;
+    DistMatrix<F> Q( g );
+    const bool rotated = !BaseCase( A ) && Split( A, Q, k );
+    bool split = rotated;
+    if( rotated )
+    {
+        // Rotate A into block diagonal form and ensure that it decoupled
+        const R frobA = FrobeniusNorm( A );
+        DistMatrix<F> T( g );
+        Zeros( n, n, T );
+        Gemm( ADJOINT, NORMAL, F(1), Q, A, F(0), T );
+        Gemm( NORMAL, NORMAL, F(1), T, Q, F(0), A );
+        DistMatrix<F> E( g );
+        LockedView( E, A, k, 0, n-k, k );
+        split = ( FrobeniusNorm( E ) <= n*eps*frobA );
+    }
+    if( !split )
+    {
+        // A rejected split has already rotated A into Q^H A Q, which has the
+        // same eigenvalues but eigenvectors that must be rotated back by Q
+        if( rotated && computeVectors )
+        {
+            DistMatrix<F> ZRot( g );
+            TridiagEig( A, w, ZRot, computeVectors );
+            Zeros( n, n, Z );
+            Gemm( NORMAL, NORMAL, F(1), Q, ZRot, F(0), Z );
+        }
+        else
+            TridiagEig( A, w, Z, computeVectors );
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    // The leading block holds the eigenvalues greater than the split point
+    DistMatrix<F> A1View( g ), A2View( g ), A1( g ), A2( g ), Z1( g ), Z2( g );
+    DistMatrix<R,STAR,STAR> w1( g ), w2( g );
+    View( A1View, A, 0, 0, k, k );
+    View( A2View, A, k, k, n-k, n-k );
+    if( g.Size() == 1 )
+    {
+        A1 = A1View;
+        A2 = A2View;
+        A.Empty();
+        Recurse( A1, w1, Z1, computeVectors );
+        Recurse( A2, w2, Z2, computeVectors );
+    }
+    else
+    {
+        RecurseOnSubgrids( A1View, A2View, w1, w2, Z1, Z2, computeVectors );
+        A.Empty();
+    }
+
+    // Merge the eigenvalues in ascending order
+    w.ResizeTo( n, 1 );
+    MemCopy( w.Buffer(), w2.LockedBuffer(), n-k );
+    MemCopy( w.Buffer(n-k,0), w1.LockedBuffer(), k );
+
+    if( computeVectors )
+    {
+        DistMatrix<F> Q1( g ), Q2( g ), ZL( g ), ZR( g );
+        LockedView( Q1, Q, 0, 0, n, k );
+        LockedView( Q2, Q, 0, k, n, n-k );
+        Zeros( n, n, Z );
+        View( ZL, Z, 0, 0, n, n-k );
+        View( ZR, Z, 0, n-k, n, k );
+        Gemm( NORMAL, NORMAL, F(1), Q2, Z2, F(0), ZL );
+        Gemm( NORMAL, NORMAL, F(1), Q1, Z1, F(0), ZR );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace sdc
+
+// Whether HermitianEig should compute the full spectrum of A with SDC
+template<typename F>
+inline bool
+UseSDC( const DistMatrix<F>& A )
+{
+    return GetHermitianEigApproach() == HERMITIAN_EIG_SDC &&
+           !sdc::BaseCase( A );
+}
+
+//
+// Compute the full set of eigenpairs of the Hermitian matrix A, which is
+// overwritten, with the eigenvalues sorted in ascending order. Subproblems
+// of dimension at most GetHermitianEigSDCCutoff(), or which are assigned to
+// a single process, are solved through tridiagonalization.
+//
+template<typename F>
+inline void
+SDC
+( UpperOrLower uplo, DistMatrix<F>& A,
+  DistMatrix<typename Base<F>::type,VR,STAR>& w, DistMatrix<F>& Z )
+{
+#ifndef RELEASE
+    PushCallStack("hermitian_eig::SDC");
+#endif
+    typedef typename Base<F>::type R;
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    MakeHermitian( uplo, A );
+
+    DistMatrix<R,STAR,STAR> w_STAR_STAR( g );
+    if( Z.Viewing() )
+    {
+        // Fill the leading n x n portion of a (possibly padded) view
+        DistMatrix<F> ZSub( g ), ZTemp( g );
+        sdc::Recurse( A, w_STAR_STAR, ZTemp, true );
+        View( ZSub, Z, 0, 0, n, n );
+        ZSub = ZTemp;
+    }
+    else
+        sdc::Recurse( A, w_STAR_STAR, Z, true );
+    w = w_STAR_STAR;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+SDC
+( UpperOrLower uplo, DistMatrix<F>& A,
+  DistMatrix<typename Base<F>::type,VR,STAR>& w )
+{
+#ifndef RELEASE
+    PushCallStack("hermitian_eig::SDC");
+#endif
+    typedef typename Base<F>::type R;
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    const Grid& g = A.Grid();
+    MakeHermitian( uplo, A );
+
+    DistMatrix<R,STAR,STAR> w_STAR_STAR( g );
+    DistMatrix<F> Z( g );
+    sdc::Recurse( A, w_STAR_STAR, Z, false );
+    w = w_STAR_STAR;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace hermitian_eig
+} // namespace elem
+
+#endif // ifndef LAPACK_HERMITIANEIG_SDC_HPP
@@ -13,6 +13,7 @@
 #include "elemental/blas-like/level1/DiagonalScale.hpp"
 #include "elemental/blas-like/level1/MakeTrapezoidal.hpp"
 #include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/HermitianFunction/Chebyshev.hpp"
 
 namespace elem {
 
@@ -286,8 +287,6 @@ ReformNormalMatrix
 
 } // namespace hermitian_eig
 
-#ifdef HAVE_PMRRR
-
 //
 // Modify the eigenvalues of A with the real-valued function f, which will 
 // therefore result in a Hermitian matrix, which we store in-place.
@@ -369,8 +368,6 @@ ComplexHermitianFunction
 #endif
 }
 
-#endif // ifdef HAVE_PMRRR
-
 } // namespace elem
 
 #endif // ifndef LAPACK_HERMITIANFUNCTION_HPP
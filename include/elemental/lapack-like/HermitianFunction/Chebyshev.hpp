@@ -0,0 +1,450 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_HERMITIANFUNCTION_CHEBYSHEV_HPP
+#define LAPACK_HERMITIANFUNCTION_CHEBYSHEV_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// Evaluate f(A) for a Hermitian matrix A and a smooth real function f as
+// p(A), where p is the truncated Chebyshev expansion of f over an interval
+// [a,b] containing the spectrum of A. The interval is formed from the
+// Gershgorin discs of A, and the degree is the smallest for which the
+// neglected coefficients are less than tol times the largest one.
+//
+// Rather than the three-term recurrence, which requires d matrix-matrix
+// products for a polynomial of degree d, we use a Paterson-Stockmeyer-style
+// evaluation: with s = ceil(sqrt(d+1)) and Y = T_s(B), the product identity
+// T_j T_{qs} = (T_{qs+j} + T_{|qs-j|})/2 allows us to rewrite
+//
+//     p(B) = sum_q M_q T_q(Y),   M_q = sum_{j<s} a_{q,j} T_j(B),
+//
+// which, after forming T_0(B),...,T_s(B), only requires one product per
+// step of the Clenshaw recurrence in Y, or roughly 2 sqrt(d) products in
+// total.
+//
+
+namespace elem {
+namespace hermitian_function {
+namespace chebyshev {
+
+//
+// Return an interval [lower,upper] which is guaranteed to contain the
+// spectrum of the Hermitian matrix A: the union of its Gershgorin discs,
+// intersected with [-||A||_F,||A||_F]. Estimates from a few steps of Lanczos
+// would be tighter, but a Ritz value and its residual only bound the distance
+// to *some* eigenvalue, and the Chebyshev expansion diverges outside of the
+// interval.
+//
+
+template<typename R>
+inline void
+GershgorinBounds
+( const std::vector<R>& centers, const std::vector<R>& radii, R frobNorm,
+  R& lower, R& upper )
+{
+    const int n = centers.size();
+    lower = upper = 0;
+    for( int i=0; i<n; ++i )
+    {
+        if( i == 0 || centers[i]-radii[i] < lower )
+            lower = centers[i]-radii[i];
+        if( i == 0 || centers[i]+radii[i] > upper )
+            upper = centers[i]+radii[i];
+    }
+    lower = std::max( lower, -frobNorm );
+    upper = std::min( upper, frobNorm );
+}
+
+template<typename F>
+inline void
+SpectralBounds
+( UpperOrLower uplo, const Matrix<F>& A,
+  typename Base<F>::type& lower, typename Base<F>::type& upper )
+{
+    typedef typename Base<F>::type R;
+    const int n = A.Height();
+    std::vector<R> centers( n ), radii( n, R(0) );
+    for( int j=0; j<n; ++j )
+    {
+        centers[j] = RealPart( A.Get(j,j) );
+        const int iStart = ( uplo==LOWER ? j+1 : 0 );
+        const int iEnd = ( uplo==LOWER ? n : j );
+        for( int i=iStart; i<iEnd; ++i )
+        {
+            const R alpha = Abs( A.Get(i,j) );
+            radii[i] += alpha;
+            radii[j] += alpha;
+        }
+    }
+    GershgorinBounds
+    ( centers, radii, HermitianFrobeniusNorm( uplo, A ), lower, upper );
+}
+
+template<typename F>
+inline void
+SpectralBounds
+( UpperOrLower uplo, const DistMatrix<F>& A,
+  typename Base<F>::type& lower, typename Base<F>::type& upper )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int r = g.Height();
+    const int c = g.Width();
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+
+    // Each entry is owned by a single process, so the local contributions
+    // can simply be summed
+    std::vector<R> centers( n, R(0) ), radii( n, R(0) );
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*c;
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const int i = colShift + iLocal*r;
+            if( i == j )
+                centers[j] = RealPart( A.GetLocal(iLocal,jLocal) );
+            else if( (uplo==LOWER && i>j) || (uplo==UPPER && i<j) )
+            {
+                const R alpha = Abs( A.GetLocal(iLocal,jLocal) );
+                radii[i] += alpha;
+                radii[j] += alpha;
+            }
+        }
+    }
+    if( n > 0 )
+    {
+        mpi::AllReduce( &centers[0], n, mpi::SUM, g.Comm() );
+        mpi::AllReduce( &radii[0], n, mpi::SUM, g.Comm() );
+    }
+    GershgorinBounds
+    ( centers, radii, HermitianFrobeniusNorm( uplo, A ), lower, upper );
+}
+
+//
+// Return the Chebyshev coefficients of f over [lower,upper], computed from
+// its interpolants in N = 16, 32, ... Chebyshev points of the first kind
+// until the coefficients in the last quarter are negligible, and truncated
+// after the last coefficient of magnitude greater than tol max_j |c_j| (or
+// the level of rounding errors, if it is larger)
+//
+template<typename R,class RealFunctor>
+inline void
+Coefficients
+( const RealFunctor& f, R lower, R upper, R tol, int maxDegree,
+  std::vector<R>& c )
+{
+    const R pi = 4*std::atan( R(1) );
+    const R eps = lapack::MachineEpsilon<R>();
+    const R center = (lower+upper)/2;
+    const R radius = (upper-lower)/2;
+    std::vector<R> fValues;
+    for( int N=std::min(16,maxDegree+1); true; N=std::min(2*N,maxDegree+1) )
+    {
+        fValues.resize( N );
+        for( int k=0; k<N; ++k )
+            fValues[k] = f( center + radius*Cos(pi*(k+R(1)/R(2))/N) );
+        c.resize( N );
+        R maxCoeff = 0;
+        for( int j=0; j<N; ++j )
+        {
+            R sum = 0;
+            for( int k=0; k<N; ++k )
+                sum += fValues[k]*Cos(pi*j*(k+R(1)/R(2))/N);
+            c[j] = ( j==0 ? sum/N : 2*sum/N );
+            maxCoeff = std::max( maxCoeff, Abs(c[j]) );
+        }
+
+        // The coefficients cannot be resolved below roughly N eps
+        const R threshold = std::max( tol, N*eps )*maxCoeff;
+        int degree = N-1;
+        while( degree > 0 && Abs(c[degree]) <= threshold )
+            --degree;
+        if( degree < (3*N)/4 || N == 1 )
+        {
+            c.resize( degree+1 );
+            return;
+        }
+        if( N == maxDegree+1 )
+            throw std::runtime_error
+            ("Chebyshev expansion did not converge; increase maxDegree");
+    }
+}
+
+//
+// Return the coefficients a_{q,j}, stored in a[q*s+j], such that
+// sum_m c_m T_m = sum_{q,j} a_{q,j} T_j T_{qs}, with 0 <= j < s
+//
+template<typename R>
+inline void
+BlockCoefficients( const std::vector<R>& c, int s, std::vector<R>& a )
+{
+    const int d = c.size()-1;
+    const int r = d / s;
+    std::vector<R> cCopy( c );
+    a.resize( (r+1)*s, R(0) );
+    for( int m=d; m>=0; --m )
+    {
+        const int q = m / s;
+        const int j = m % s;
+        if( q == 0 || j == 0 )
+            a[q*s+j] = cCopy[m];
+        else
+        {
+            a[q*s+j] = 2*cCopy[m];
+            cCopy[q*s-j] -= cCopy[m];
+        }
+    }
+}
+
+//
+// Pad the spectral interval by one percent and return the block 
+// size s and the coefficients a_{q,j} of the degree d expansion of f over it.
+// Returns false (and leaves a empty) if the interval is a single point at 
+// zero, i.e., if A is zero.
+//
+template<typename R,class RealFunctor>
+inline bool
+Expansion
+( const RealFunctor& f, R& lower, R& upper, R tol, int maxDegree,
+  int& degree, int& s, std::vector<R>& a )
+{
+    const R pad = std::max( (upper-lower)/100, Abs(upper)/100 );
+    if( pad == R(0) )
+        return false;
+    lower -= pad;
+    upper += pad;
+
+    std::vector<R> c;
+    Coefficients( f, lower, upper, tol, maxDegree, c );
+    degree = c.size()-1;
+    s = std::max( 1, int(std::ceil(Sqrt(R(degree+1)))) );
+    BlockCoefficients( c, s, a );
+    return true;
+}
+
+} // namespace chebyshev
+} // namespace hermitian_function
+
+//
+// Overwrite the Hermitian matrix A (only the uplo triangle is accessed) with
+// f(A), using a Chebyshev approximation of f over an interval containing the
+// spectrum of A. The result is stored in both triangles, and the degree of
+// the polynomial is returned. If tol is zero, 10 eps is used.
+//
+// T_0(B), ..., T_s(B) are stored side by side in a single matrix, and
+// accessed through views.
+//
+template<typename F,class RealFunctor>
+inline int
+ChebyshevHermitianFunction
+( UpperOrLower uplo, Matrix<F>& A, const RealFunctor& f,
+  typename Base<F>::type tol=0, int maxDegree=1000 )
+{
+#ifndef RELEASE
+    PushCallStack("ChebyshevHermitianFunction");
+    if( tol < 0 )
+        throw std::logic_error("tol cannot be negative");
+    if( maxDegree < 1 )
+        throw std::logic_error("maxDegree must be positive");
+#endif
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    typedef typename Base<F>::type R;
+    const int n = A.Height();
+    if( tol == R(0) )
+        tol = 10*lapack::MachineEpsilon<R>();
+
+    R lower, upper;
+    hermitian_function::chebyshev::SpectralBounds( uplo, A, lower, upper );
+    int degree, s;
+    std::vector<R> a;
+    if( !hermitian_function::chebyshev::Expansion
+         ( f, lower, upper, tol, maxDegree, degree, s, a ) )
+    {
+        // A is zero
+        Identity( n, n, A );
+        Scale( f(R(0)), A );
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return 0;
+    }
+    const int r = degree / s;
+
+    // B := (2 A - (lower+upper) I) / (upper-lower)
+    Matrix<F> B;
+    MakeHermitian( uplo, A );
+    B = A;
+    Scale( 2/(upper-lower), B );
+    Identity( n, n, A );
+    Axpy( -(lower+upper)/(upper-lower), A, B );
+
+    // Form T_0(B), ..., T_{s-1}(B) and Y := T_s(B)
+    Matrix<F> TBlocks, Tj, TjMinus1, TjMinus2, Y;
+    Zeros( n, (s+1)*n, TBlocks );
+    View( Tj, TBlocks, 0, 0, n, n );
+    MakeIdentity( Tj );
+    View( Tj, TBlocks, 0, n, n, n );
+    Tj = B;
+    for( int j=2; j<=s; ++j )
+    {
+        View( Tj, TBlocks, 0, j*n, n, n );
+        LockedView( TjMinus1, TBlocks, 0, (j-1)*n, n, n );
+        LockedView( TjMinus2, TBlocks, 0, (j-2)*n, n, n );
+        Tj = TjMinus2;
+        Gemm( NORMAL, NORMAL, F(2), B, TjMinus1, F(-1), Tj );
+    }
+    LockedView( Y, TBlocks, 0, s*n, n, n );
+
+    // Run the Clenshaw recurrence in Y with the coefficients M_q
+    Matrix<F> M, b1, b2, bNew;
+    Zeros( n, n, b1 );
+    Zeros( n, n, b2 );
+    for( int q=r; q>=0; --q )
+    {
+        Zeros( n, n, M );
+        for( int j=0; j<s; ++j )
+        {
+            if( a[q*s+j] != R(0) )
+            {
+                LockedView( Tj, TBlocks, 0, j*n, n, n );
+                Axpy( F(a[q*s+j]), Tj, M );
+            }
+        }
+
+        // b_q := M_q + 2 Y b_{q+1} - b_{q+2}, except that the final step is
+        // p(B) = M_0 + Y b_1 - b_2
+        bNew = M;
+        Axpy( F(-1), b2, bNew );
+        if( q < r )
+            Gemm( NORMAL, NORMAL, F(q>0?2:1), Y, b1, F(1), bNew );
+        b2 = b1;
+        b1 = bNew;
+    }
+    A = b1;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return degree;
+}
+
+template<typename F,class RealFunctor>
+inline int
+ChebyshevHermitianFunction
+( UpperOrLower uplo, DistMatrix<F>& A, const RealFunctor& f,
+  typename Base<F>::type tol=0, int maxDegree=1000 )
+{
+#ifndef RELEASE
+    PushCallStack("ChebyshevHermitianFunction");
+    if( tol < 0 )
+        throw std::logic_error("tol cannot be negative");
+    if( maxDegree < 1 )
+        throw std::logic_error("maxDegree must be positive");
+#endif
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    if( tol == R(0) )
+        tol = 10*lapack::MachineEpsilon<R>();
+
+    R lower, upper;
+    hermitian_function::chebyshev::SpectralBounds( uplo, A, lower, upper );
+    int degree, s;
+    std::vector<R> a;
+    if( !hermitian_function::chebyshev::Expansion
+         ( f, lower, upper, tol, maxDegree, degree, s, a ) )
+    {
+        // A is zero
+        Identity( n, n, A );
+        Scale( f(R(0)), A );
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return 0;
+    }
+    const int r = degree / s;
+
+    // B := (2 A - (lower+upper) I) / (upper-lower)
+    DistMatrix<F> B( g );
+    MakeHermitian( uplo, A );
+    B = A;
+    Scale( 2/(upper-lower), B );
+    Identity( n, n, A );
+    Axpy( -(lower+upper)/(upper-lower), A, B );
+
+    // Form T_0(B), ..., T_{s-1}(B) and Y := T_s(B). Each block starts at a
+    // multiple of the process grid width so that all of the views share the
+    // alignment of TBlocks (and of the other temporaries).
+    const int c = g.Width();
+    const int stride = ((n+c-1)/c)*c;
+    DistMatrix<F> TBlocks( g ), Tj( g ), TjMinus1( g ), TjMinus2( g ), Y( g );
+    Zeros( n, (s+1)*stride, TBlocks );
+    View( Tj, TBlocks, 0, 0, n, n );
+    MakeIdentity( Tj );
+    View( Tj, TBlocks, 0, stride, n, n );
+    Tj = B;
+    for( int j=2; j<=s; ++j )
+    {
+        View( Tj, TBlocks, 0, j*stride, n, n );
+        LockedView( TjMinus1, TBlocks, 0, (j-1)*stride, n, n );
+        LockedView( TjMinus2, TBlocks, 0, (j-2)*stride, n, n );
+        Tj = TjMinus2;
+        Gemm( NORMAL, NORMAL, F(2), B, TjMinus1, F(-1), Tj );
+    }
+    LockedView( Y, TBlocks, 0, s*stride, n, n );
+
+    // Run the Clenshaw recurrence in Y with the coefficients M_q
+    DistMatrix<F> M( g ), b1( g ), b2( g ), bNew( g );
+    Zeros( n, n, b1 );
+    Zeros( n, n, b2 );
+    for( int q=r; q>=0; --q )
+    {
+        Zeros( n, n, M );
+        for( int j=0; j<s; ++j )
+        {
+            if( a[q*s+j] != R(0) )
+            {
+                LockedView( Tj, TBlocks, 0, j*stride, n, n );
+                Axpy( F(a[q*s+j]), Tj, M );
+            }
+        }
+
+        // b_q := M_q + 2 Y b_{q+1} - b_{q+2}, except that the final step is
+        // p(B) = M_0 + Y b_1 - b_2
+        bNew = M;
+        Axpy( F(-1), b2, bNew );
+        if( q < r )
+            Gemm( NORMAL, NORMAL, F(q>0?2:1), Y, b1, F(1), bNew );
+        b2 = b1;
+        b1 = bNew;
+    }
+    A = b1;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return degree;
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_HERMITIANFUNCTION_CHEBYSHEV_HPP
@@ -10,8 +10,6 @@
 #ifndef LAPACK_HERMITIANGENDEFINITEEIG_HPP
 #define LAPACK_HERMITIANGENDEFINITEEIG_HPP
 
-#ifdef HAVE_PMRRR
-
 #include "elemental/blas-like/level3/Trmm.hpp"
 #include "elemental/blas-like/level3/Trsm.hpp"
 #include "elemental/lapack-like/Cholesky.hpp"
@@ -446,6 +444,4 @@ HermitianGenDefiniteEig
 
 } // namespace elem
 
-#endif // ifdef HAVE_PMRRR
-
 #endif // ifndef LAPACK_HERMITIANGENDEFINITEEIG_HPP
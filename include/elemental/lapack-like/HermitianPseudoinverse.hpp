@@ -10,8 +10,6 @@
 #ifndef LAPACK_HERMITIANPSEUDOINVERSE_HPP
 #define LAPACK_HERMITIANPSEUDOINVERSE_HPP
 
-#ifdef HAVE_PMRRR
-
 #include "elemental/lapack-like/HermitianFunction.hpp"
 #include "elemental/lapack-like/Norm/Max.hpp"
 
@@ -63,6 +61,4 @@ HermitianPseudoinverse
 
 } // namespace elem
 
-#endif // ifdef HAVE_PMRRR
-
 #endif // ifndef LAPACK_HERMITIANPSEUDOINVERSE_HPP
@@ -0,0 +1,203 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_LOWRANK_HPP
+#define LAPACK_LOWRANK_HPP
+
+#include "elemental/blas-like/level1/DiagonalScale.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/QR.hpp"
+#include "elemental/lapack-like/SVD.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+namespace elem {
+namespace low_rank {
+
+//
+// Given A = U diag(s) V^H, compute the thin QR factorizations U = Q_U R_U
+// and V = Q_V R_V, so that A = Q_U C Q_V^H with the small core matrix
+// C = R_U diag(s) R_V^H. Since Q_U and Q_V have orthonormal columns, the
+// unitarily-invariant properties of A are those of C.
+//
+template<typename F>
+inline void
+Core
+( const LowRankDistMatrix<F>& A,
+  DistMatrix<F>& QU, DistMatrix<F>& QV, DistMatrix<F>& C )
+{
+    const Grid& g = A.Grid();
+    const int r = A.Rank();
+    const int kU = std::min( A.Height(), r );
+    const int kV = std::min( A.Width(), r );
+
+    DistMatrix<F> RU( g ), RV( g ), QUFull( g ), QVFull( g );
+    QUFull = A.LockedU();
+    QVFull = A.LockedV();
+    qr::Explicit( QUFull, RU );
+    qr::Explicit( QVFull, RV );
+    DistMatrix<F> QUL( g ), QVL( g );
+    LockedView( QUL, QUFull, 0, 0, A.Height(), kU );
+    LockedView( QVL, QVFull, 0, 0, A.Width(), kV );
+    QU.Empty();
+    QV.Empty();
+    QU = QUL;
+    QV = QVL;
+
+    DiagonalScale( RIGHT, NORMAL, A.LockedS(), RU );
+    Zeros( kU, kV, C );
+    Gemm( NORMAL, ADJOINT, F(1), RU, RV, F(0), C );
+}
+
+// Overwrite R with the upper-triangular factor of the thin QR factorization
+// of A without forming the orthogonal factor
+template<typename Real>
+inline void
+TriangularFactor( const DistMatrix<Real>& A, DistMatrix<Real>& R )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<Real> B( g ), BT( g ), BB( g );
+    B = A;
+    QR( B );
+    PartitionDown
+    ( B, BT,
+         BB, std::min(B.Height(),B.Width()) );
+    R = BT;
+    MakeTriangular( UPPER, R );
+}
+
+template<typename Real>
+inline void
+TriangularFactor
+( const DistMatrix<Complex<Real> >& A, DistMatrix<Complex<Real> >& R )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<Complex<Real> > B( g ), BT( g ), BB( g );
+    DistMatrix<Complex<Real>,MD,STAR> t( g );
+    B = A;
+    QR( B, t );
+    PartitionDown
+    ( B, BT,
+         BB, std::min(B.Height(),B.Width()) );
+    R = BT;
+    MakeTriangular( UPPER, R );
+}
+
+// Only form the core matrix C, which suffices for the unitarily-invariant
+// properties of A (e.g., its Frobenius norm)
+template<typename F>
+inline void
+Core( const LowRankDistMatrix<F>& A, DistMatrix<F>& C )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<F> RU( g ), RV( g );
+    TriangularFactor( A.LockedU(), RU );
+    TriangularFactor( A.LockedV(), RV );
+    DiagonalScale( RIGHT, NORMAL, A.LockedS(), RU );
+    Zeros( RU.Height(), RV.Height(), C );
+    Gemm( NORMAL, ADJOINT, F(1), RU, RV, F(0), C );
+}
+
+} // namespace low_rank
+
+//
+// The Frobenius norm of a low-rank matrix, computed from its factors in
+// O((m+n)r^2) work
+//
+template<typename F>
+inline typename Base<F>::type
+FrobeniusNorm( const LowRankDistMatrix<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("FrobeniusNorm");
+#endif
+    typedef typename Base<F>::type R;
+    R norm = 0;
+    if( A.Rank() > 0 )
+    {
+        const Grid& g = A.Grid();
+        DistMatrix<F> C( g );
+        low_rank::Core( A, C );
+        norm = FrobeniusNorm( C );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return norm;
+}
+
+//
+// Overwrite the factors of A with its truncated SVD, where only the singular
+// values greater than tol are kept. If tol is zero, it is set to
+// max(m,n) eps sigma_max. On exit, U and V have orthonormal columns and s
+// is sorted in descending order. Returns the new rank.
+//
+template<typename F>
+inline int
+Recompress( LowRankDistMatrix<F>& A, typename Base<F>::type tol=0 )
+{
+#ifndef RELEASE
+    PushCallStack("Recompress");
+    if( tol < 0 )
+        throw std::logic_error("negative threshold does not make sense");
+#endif
+    typedef typename Base<F>::type R;
+    if( A.Rank() == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return 0;
+    }
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+
+    // A = Q_U C Q_V^H = (Q_U W_L) Sigma (Q_V W_R)^H
+    DistMatrix<F> QU( g ), QV( g ), C( g ), WR( g );
+    DistMatrix<R,VR,STAR> sigma( g );
+    low_rank::Core( A, QU, QV, C );
+    SVD( C, sigma, WR );
+
+    DistMatrix<R,STAR,STAR> sigma_STAR_STAR( g );
+    sigma_STAR_STAR = sigma;
+    const int k = sigma.Height();
+    if( tol == R(0) )
+    {
+        const R eps = lapack::MachineEpsilon<R>();
+        tol = std::max(m,n)*eps*( k > 0 ? sigma_STAR_STAR.GetLocal(0,0) : 0 );
+    }
+    int rank = 0;
+    while( rank < k && sigma_STAR_STAR.GetLocal(rank,0) > tol )
+        ++rank;
+
+    DistMatrix<F> WLL( g ), WRL( g ), U( g ), V( g );
+    DistMatrix<R,VR,STAR> sT( g ), s( g );
+    LockedView( WLL, C, 0, 0, C.Height(), rank );
+    LockedView( WRL, WR, 0, 0, WR.Height(), rank );
+    LockedView( sT, sigma, 0, 0, rank, 1 );
+    Zeros( m, rank, U );
+    Zeros( n, rank, V );
+    if( rank > 0 )
+    {
+        Gemm( NORMAL, NORMAL, F(1), QU, WLL, F(0), U );
+        Gemm( NORMAL, NORMAL, F(1), QV, WRL, F(0), V );
+    }
+    s = sT;
+    A.Set( U, s, V );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return rank;
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_LOWRANK_HPP
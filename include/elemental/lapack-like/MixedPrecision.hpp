@@ -0,0 +1,525 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_MIXEDPRECISION_HPP
+#define LAPACK_MIXEDPRECISION_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Conjugate.hpp"
+#include "elemental/blas-like/level1/Dot.hpp"
+#include "elemental/blas-like/level1/Nrm2.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Hemm.hpp"
+#include "elemental/blas-like/level3/Trsm.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/LU.hpp"
+#include "elemental/lapack-like/QR.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// Mixed-precision iterative refinement: the O(n^3) factorization is computed
+// in single precision, where it is roughly twice as fast and needs half of
+// the memory, and the O(n^2) residuals and updates are computed in double
+// precision so that the solution is accurate to (backward-stable) double
+// precision for matrices that are not too ill-conditioned relative to the
+// single-precision unit roundoff.
+//
+// If classical refinement stalls, i.e., the corrections fail to decrease by
+// at least a factor of two, then we switch to GMRES-based refinement
+// (GMRES-IR), which uses the single-precision factorization as a
+// preconditioner and remains convergent for condition numbers up to about
+// the reciprocal of the single-precision unit roundoff.
+//
+
+namespace elem {
+namespace mixed_precision {
+
+template<typename F>
+struct LowerPrecision { };
+template<>
+struct LowerPrecision<double> { typedef float type; };
+template<>
+struct LowerPrecision<Complex<double> > { typedef Complex<float> type; };
+
+// Entrywise conversion between precisions, which requires no communication.
+// Only the alignments of A are copied, since A and B hold different types.
+template<typename S,typename T>
+inline void
+Convert( const DistMatrix<S>& A, DistMatrix<T>& B )
+{
+#ifndef RELEASE
+    PushCallStack("mixed_precision::Convert");
+#endif
+    if( A.Grid() != B.Grid() )
+        throw std::logic_error("A and B must share a grid");
+    if( B.Viewing() )
+    {
+        if( B.Height() != A.Height() || B.Width() != A.Width() )
+            throw std::logic_error("Cannot resize a view");
+        if( B.ColAlignment() != A.ColAlignment() ||
+            B.RowAlignment() != A.RowAlignment() )
+            throw std::logic_error("Views must have matching alignments");
+    }
+    else
+    {
+        B.Empty();
+        B.Align( A.ColAlignment(), A.RowAlignment() );
+        B.ResizeTo( A.Height(), A.Width() );
+    }
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    const S* ABuffer = A.LockedBuffer();
+    const int ALDim = A.LDim();
+    T* BBuffer = B.Buffer();
+    const int BLDim = B.LDim();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            BBuffer[iLocal+jLocal*BLDim] = T(ABuffer[iLocal+jLocal*ALDim]);
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// Each operator provides
+//
+//   Apply(X,Y):  Y := Y - op(A) X,  in full precision,
+//   Solve(Y):    Y := op(M)^{-1} Y, using the low-precision factorization,
+//   Norm():      an estimate of || op(A) ||_F.
+//
+
+template<typename F>
+class HPDOperator
+{
+public:
+    typedef typename Base<F>::type R;
+    typedef typename LowerPrecision<F>::type FLow;
+
+    HPDOperator
+    ( UpperOrLower uplo, Orientation orientation, const DistMatrix<F>& A )
+    : uplo_(uplo), orientation_(orientation), A_(A), ALow_(A.Grid())
+    {
+        Convert( A, ALow_ );
+        Cholesky( uplo, ALow_ );
+        norm_ = HermitianFrobeniusNorm( uplo, A );
+    }
+
+    void Apply( const DistMatrix<F>& X, DistMatrix<F>& Y ) const
+    {
+        if( orientation_ == TRANSPOSE )
+        {
+            // A^T X = conj(A conj(X)) since A is Hermitian
+            DistMatrix<F> XConj( X.Grid() );
+            Conjugate( X, XConj );
+            Conjugate( Y );
+            Hemm( LEFT, uplo_, F(-1), A_, XConj, F(1), Y );
+            Conjugate( Y );
+        }
+        else
+            Hemm( LEFT, uplo_, F(-1), A_, X, F(1), Y );
+    }
+
+    void Solve( DistMatrix<F>& Y ) const
+    {
+        DistMatrix<FLow> YLow( Y.Grid() );
+        Convert( Y, YLow );
+        cholesky::SolveAfter( uplo_, orientation_, ALow_, YLow );
+        Convert( YLow, Y );
+    }
+
+    R Norm() const { return norm_; }
+
+private:
+    UpperOrLower uplo_;
+    Orientation orientation_;
+    const DistMatrix<F>& A_;
+    DistMatrix<FLow> ALow_;
+    R norm_;
+};
+
+template<typename F>
+class LUOperator
+{
+public:
+    typedef typename Base<F>::type R;
+    typedef typename LowerPrecision<F>::type FLow;
+
+    LUOperator( const DistMatrix<F>& A )
+    : A_(A), ALow_(A.Grid()), p_(A.Grid())
+    {
+        Convert( A, ALow_ );
+        LU( ALow_, p_ );
+        norm_ = FrobeniusNorm( A );
+    }
+
+    void Apply( const DistMatrix<F>& X, DistMatrix<F>& Y ) const
+    { Gemm( NORMAL, NORMAL, F(-1), A_, X, F(1), Y ); }
+
+    void Solve( DistMatrix<F>& Y ) const
+    {
+        DistMatrix<FLow> YLow( Y.Grid() );
+        Convert( Y, YLow );
+        lu::SolveAfter( NORMAL, ALow_, p_, YLow );
+        Convert( YLow, Y );
+    }
+
+    R Norm() const { return norm_; }
+
+private:
+    const DistMatrix<F>& A_;
+    DistMatrix<FLow> ALow_;
+    DistMatrix<int,VC,STAR> p_;
+    R norm_;
+};
+
+template<typename Real>
+inline void
+LowPrecisionQR( DistMatrix<Real>& A )
+{ QR( A ); }
+
+template<typename Real>
+inline void
+LowPrecisionQR( DistMatrix<Complex<Real> >& A )
+{
+    DistMatrix<Complex<Real>,MD,STAR> t( A.Grid() );
+    QR( A, t );
+}
+
+// The semi-normal equations, A^H A X = A^H B, preconditioned by R^H R, where
+// R is the triangular factor from a low-precision QR factorization of A.
+// Only R is kept, so that A^H A is never formed.
+template<typename F>
+class LeastSquaresOperator
+{
+public:
+    typedef typename Base<F>::type R;
+    typedef typename LowerPrecision<F>::type FLow;
+
+    LeastSquaresOperator( const DistMatrix<F>& A )
+    : A_(A), QRLow_(A.Grid())
+    {
+        const int n = A.Width();
+        Convert( A, QRLow_ );
+        LowPrecisionQR( QRLow_ );
+        LockedView( RLow_, QRLow_, 0, 0, n, n );
+        const R frobA = FrobeniusNorm( A );
+        norm_ = frobA*frobA;
+    }
+
+    void Apply( const DistMatrix<F>& X, DistMatrix<F>& Y ) const
+    {
+        DistMatrix<F> Z( X.Grid() );
+        Zeros( A_.Height(), X.Width(), Z );
+        Gemm( NORMAL, NORMAL, F(1), A_, X, F(0), Z );
+        Gemm( ADJOINT, NORMAL, F(-1), A_, Z, F(1), Y );
+    }
+
+    void Solve( DistMatrix<F>& Y ) const
+    {
+        DistMatrix<FLow> YLow( Y.Grid() );
+        Convert( Y, YLow );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, FLow(1), RLow_, YLow );
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, FLow(1), RLow_, YLow );
+        Convert( YLow, Y );
+    }
+
+    R Norm() const { return norm_; }
+
+private:
+    const DistMatrix<F>& A_;
+    DistMatrix<FLow> QRLow_, RLow_;
+    R norm_;
+};
+
+// Test for a (normwise) backward error of O(n eps) in full precision
+template<typename Op,typename F>
+inline bool
+Converged
+( const Op& op, const DistMatrix<F>& B, const DistMatrix<F>& X,
+  const DistMatrix<F>& Residual )
+{
+    typedef typename Base<F>::type R;
+    const R eps = lapack::MachineEpsilon<R>();
+    const R tol = Sqrt(R(X.Height()))*eps;
+    const R residNorm = FrobeniusNorm( Residual );
+    return residNorm <=
+           tol*(op.Norm()*FrobeniusNorm(X)+FrobeniusNorm(B));
+}
+
+// Left-preconditioned restarted GMRES(k) on op(M)^{-1} op(A) x =
+// op(M)^{-1} b, one column at a time, starting from the current X. As in
+// GMRES-IR, convergence is still judged by the unpreconditioned residual.
+// The Krylov basis is stored in [VC,* ] so that all of its columns share an
+// alignment (those of a column of an [MC,MR] matrix need not).
+template<typename Op,typename F>
+inline int
+GMRES
+( const Op& op, const DistMatrix<F>& B, DistMatrix<F>& X,
+  int maxRestarts, int krylovSize )
+{
+#ifndef RELEASE
+    PushCallStack("mixed_precision::GMRES");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = B.Grid();
+    const int n = X.Height();
+    const int numRhs = B.Width();
+    const R eps = lapack::MachineEpsilon<R>();
+    const int k = std::min( krylovSize, n );
+
+    int maxNumIts = 0;
+    DistMatrix<F> b( g ), x( g ), r( g ), w( g ), v( g );
+    DistMatrix<F,VC,STAR> V( g ), vl( g ), w_VC_STAR( g ), dx_VC_STAR( g );
+    Matrix<F> H, y;
+    std::vector<R> cs;
+    std::vector<F> sn, rhs;
+    for( int j=0; j<numRhs; ++j )
+    {
+        LockedView( b, B, 0, j, n, 1 );
+        View( x, X, 0, j, n, 1 );
+        int numIts = 0;
+        while( true )
+        {
+            r = b;
+            op.Apply( x, r );
+            if( Converged( op, b, x, r ) )
+                break;
+            if( numIts == maxRestarts )
+                throw std::runtime_error("GMRES-IR did not converge");
+            ++numIts;
+
+            op.Solve( r );
+            const R beta = Nrm2( r );
+            Zeros( n, k+1, V );
+            View( vl, V, 0, 0, n, 1 );
+            vl = r;
+            Scale( F(1)/beta, vl );
+
+            Zeros( k+1, k, H );
+            cs.assign( k, R(0) );
+            sn.assign( k, F(0) );
+            rhs.assign( k+1, F(0) );
+            rhs[0] = beta;
+            int numSteps = 0;
+            for( int i=0; i<k; ++i )
+            {
+                // w := M^{-1} A v_i, orthogonalized against V via modified
+                // Gram-Schmidt
+                View( vl, V, 0, i, n, 1 );
+                v.Empty();
+                v = vl;
+                w.Empty();
+                w.AlignWith( v );
+                Zeros( n, 1, w );
+                op.Apply( v, w );
+                Scale( F(-1), w );
+                op.Solve( w );
+                w_VC_STAR.AlignWith( V );
+                w_VC_STAR = w;
+                for( int l=0; l<=i; ++l )
+                {
+                    View( vl, V, 0, l, n, 1 );
+                    const F eta = Dot( vl, w_VC_STAR );
+                    H.Set( l, i, eta );
+                    Axpy( -eta, vl, w_VC_STAR );
+                }
+                const R wNorm = FrobeniusNorm( w_VC_STAR );
+                H.Set( i+1, i, wNorm );
+                ++numSteps;
+
+                // Apply the previous rotations to the new column of H and
+                // then annihilate its subdiagonal entry
+                for( int l=0; l<i; ++l )
+                {
+                    const F eta0 = H.Get(l,i);
+                    const F eta1 = H.Get(l+1,i);
+                    H.Set( l, i, cs[l]*eta0 + sn[l]*eta1 );
+                    H.Set( l+1, i, -Conj(sn[l])*eta0 + cs[l]*eta1 );
+                }
+                F rho;
+                lapack::ComputeGivens
+                ( H.Get(i,i), H.Get(i+1,i), &cs[i], &sn[i], &rho );
+                H.Set( i, i, rho );
+                H.Set( i+1, i, 0 );
+                rhs[i+1] = -Conj(sn[i])*rhs[i];
+                rhs[i] = cs[i]*rhs[i];
+
+                if( wNorm == R(0) || Abs(rhs[i+1]) <= eps*beta )
+                    break;
+                View( vl, V, 0, i+1, n, 1 );
+                vl = w_VC_STAR;
+                Scale( F(1)/wNorm, vl );
+            }
+
+            // Solve the (redundant) upper-triangular system and update x
+            Zeros( numSteps, 1, y );
+            for( int i=numSteps-1; i>=0; --i )
+            {
+                F eta = rhs[i];
+                for( int l=i+1; l<numSteps; ++l )
+                    eta -= H.Get(i,l)*y.Get(l,0);
+                y.Set( i, 0, eta/H.Get(i,i) );
+            }
+            dx_VC_STAR.AlignWith( V );
+            Zeros( n, 1, dx_VC_STAR );
+            for( int i=0; i<numSteps; ++i )
+            {
+                View( vl, V, 0, i, n, 1 );
+                Axpy( y.Get(i,0), vl, dx_VC_STAR );
+            }
+            w.Empty();
+            w.AlignWith( x );
+            w = dx_VC_STAR;
+            Axpy( F(1), w, x );
+        }
+        maxNumIts = std::max( maxNumIts, numIts );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return maxNumIts;
+}
+
+template<typename Op,typename F>
+inline int
+Refine
+( const Op& op, const DistMatrix<F>& B, DistMatrix<F>& X,
+  int maxIts, int krylovSize )
+{
+#ifndef RELEASE
+    PushCallStack("mixed_precision::Refine");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = B.Grid();
+
+    // Form the initial guess from the low-precision factorization
+    X = B;
+    op.Solve( X );
+
+    int numIts = 0;
+    R lastCorrectionNorm = 0;
+    DistMatrix<F> Residual( g );
+    while( true )
+    {
+        Residual = B;
+        op.Apply( X, Residual );
+        if( Converged( op, B, X, Residual ) )
+            break;
+        if( numIts == maxIts )
+            throw std::runtime_error
+            ("Mixed-precision refinement did not converge");
+        ++numIts;
+
+        op.Solve( Residual );
+        const R correctionNorm = FrobeniusNorm( Residual );
+        if( numIts > 1 && correctionNorm > lastCorrectionNorm/2 )
+        {
+            numIts += GMRES( op, B, X, maxIts-numIts+1, krylovSize );
+            break;
+        }
+        Axpy( F(1), Residual, X );
+        lastCorrectionNorm = correctionNorm;
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return numIts;
+}
+
+//
+// Solve op(A) X = B, where A is Hermitian positive-definite and only the
+// triangle specified by uplo is accessed. Unlike HPDSolve, A is left intact,
+// since it is required for forming the residuals.
+//
+template<typename F>
+inline int
+HPDSolve
+( UpperOrLower uplo, Orientation orientation,
+  const DistMatrix<F>& A, DistMatrix<F>& B,
+  int maxIts=50, int krylovSize=30 )
+{
+#ifndef RELEASE
+    PushCallStack("mixed_precision::HPDSolve");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B must be the same height");
+#endif
+    HPDOperator<F> op( uplo, orientation, A );
+    DistMatrix<F> X( A.Grid() );
+    const int numIts = Refine( op, B, X, maxIts, krylovSize );
+    B = X;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return numIts;
+}
+
+//
+// Solve A X = B using a single-precision LU factorization with partial
+// pivoting, leaving A intact
+//
+template<typename F>
+inline int
+GaussianElimination
+( const DistMatrix<F>& A, DistMatrix<F>& B,
+  int maxIts=50, int krylovSize=30 )
+{
+#ifndef RELEASE
+    PushCallStack("mixed_precision::GaussianElimination");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B must be the same height");
+#endif
+    LUOperator<F> op( A );
+    DistMatrix<F> X( A.Grid() );
+    const int numIts = Refine( op, B, X, maxIts, krylovSize );
+    B = X;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return numIts;
+}
+
+//
+// Solve the full-rank, overdetermined least-squares problem min ||A X - B||_F
+// via refinement of the semi-normal equations, leaving A intact
+//
+template<typename F>
+inline int
+LeastSquares
+( const DistMatrix<F>& A, const DistMatrix<F>& B, DistMatrix<F>& X,
+  int maxIts=50, int krylovSize=30 )
+{
+#ifndef RELEASE
+    PushCallStack("mixed_precision::LeastSquares");
+#endif
+    if( A.Height() < A.Width() )
+        throw std::logic_error("Only overdetermined problems are supported");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B do not conform");
+
+    LeastSquaresOperator<F> op( A );
+    DistMatrix<F> AHB( A.Grid() );
+    Zeros( A.Width(), B.Width(), AHB );
+    Gemm( ADJOINT, NORMAL, F(1), A, B, F(0), AHB );
+    const int numIts = Refine( op, AHB, X, maxIts, krylovSize );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return numIts;
+}
+
+} // namespace mixed_precision
+} // namespace elem
+
+#endif // ifndef LAPACK_MIXEDPRECISION_HPP
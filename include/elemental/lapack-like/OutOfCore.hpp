@@ -0,0 +1,417 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_OUTOFCORE_HPP
+#define LAPACK_OUTOFCORE_HPP
+
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Herk.hpp"
+#include "elemental/blas-like/level3/Trsm.hpp"
+#include "elemental/lapack-like/ApplyRowPivots.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/ComposePivots.hpp"
+#include "elemental/lapack-like/LU.hpp"
+
+//
+// Left-looking factorizations of matrices which are too large to be held in
+// memory and are instead stored in the binary format of
+// AutoDistMatrix::WriteBinary. The file is overwritten in place, one column
+// panel at a time: each panel is read, updated with every previously
+// factored panel, factored in memory, and written back.
+//
+// The numResident most recently factored panels are kept in memory, and the
+// older ones are streamed back in from the file through two file handles, so
+// that the read of the next panel overlaps the update with the current one.
+// At most numResident+3 panels are held in memory at once.
+//
+
+namespace elem {
+namespace out_of_core {
+
+// Make the writes through the first handle visible to reads through both
+inline void
+SyncFiles( mpi::File* fh, mpi::Comm comm )
+{
+    mpi::FileSync( fh[0] );
+    mpi::Barrier( comm );
+    mpi::FileSync( fh[0] );
+    mpi::FileSync( fh[1] );
+}
+
+// Start reading the height x width block of the file with top-left entry
+// (i,j) into A
+template<typename F>
+inline void
+StartRead
+( DistMatrix<F>& A, mpi::File fh, int n, int i, int j,
+  int height, int width, mpi::Request& request )
+{
+    A.ResizeTo( height, width );
+    internal::IReadBinaryBlock( A, fh, n, i, j, request );
+}
+
+// Apply the pivots of rows [begin,end), stored as global row indices, to A,
+// whose first row is global row 'offset'. As in the right-looking LU, the
+// pivots are composed into a single permutation which only moves the rows
+// [begin,end) and their images.
+template<typename F>
+inline void
+ApplyPivots
+( DistMatrix<F>& A, const std::vector<int>& pivots,
+  int begin, int end, int offset )
+{
+    if( end <= begin )
+        return;
+    DistMatrix<F> AB( A.Grid() );
+    const int height = A.Height()-(begin-offset);
+    View( AB, A, begin-offset, 0, height, A.Width() );
+
+    Matrix<int> p( height, 1 );
+    for( int i=0; i<height; ++i )
+        p.Set( i, 0, ( i < end-begin ? pivots[begin+i]-begin : i ) );
+    std::vector<int> image, preimage;
+    ComposePivots( p, image, preimage );
+    image.resize( end-begin );
+    preimage.resize( end-begin );
+    ApplyRowPivots( AB, image, preimage );
+}
+
+// P := P - L L(0:nb-1,:)^H, where L holds the rows of a factored panel
+// which start at the first row of the panel P
+template<typename F>
+inline void
+LowerUpdate( DistMatrix<F>& P, const DistMatrix<F>& L )
+{
+    const Grid& g = P.Grid();
+    const int nb = P.Width();
+    DistMatrix<F> P1(g), P2(g), L1(g), L2(g);
+    View( P1, P, 0, 0, nb, nb );
+    View( P2, P, nb, 0, P.Height()-nb, nb );
+    LockedView( L1, L, 0, 0, nb, L.Width() );
+    LockedView( L2, L, nb, 0, L.Height()-nb, L.Width() );
+    Herk( LOWER, NORMAL, F(-1), L1, F(1), P1 );
+    if( P.Height() > nb )
+        Gemm( NORMAL, ADJOINT, F(-1), L2, L1, F(1), P2 );
+}
+
+// Solve against the factored panel U, whose diagonal block is in rows
+// [jb,jb+b), and update the corresponding rows of P
+template<typename F>
+inline void
+UpperUpdate( DistMatrix<F>& P, const DistMatrix<F>& U, int jb )
+{
+    const Grid& g = P.Grid();
+    const int b = U.Width();
+    DistMatrix<F> PT(g), P1(g), UT(g), U11(g);
+    View( PT, P, 0, 0, jb, P.Width() );
+    View( P1, P, jb, 0, b, P.Width() );
+    LockedView( UT, U, 0, 0, jb, b );
+    LockedView( U11, U, jb, 0, b, b );
+    if( jb > 0 )
+        Gemm( ADJOINT, NORMAL, F(-1), UT, PT, F(1), P1 );
+    Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), U11, P1 );
+}
+
+// Apply the factored panel L, whose unit diagonal block is in its first b
+// rows and which starts at row jb of P
+template<typename F>
+inline void
+LUUpdate( DistMatrix<F>& P, const DistMatrix<F>& L, int jb )
+{
+    const Grid& g = P.Grid();
+    const int b = L.Width();
+    const int n = P.Height();
+    DistMatrix<F> P1(g), P2(g), L11(g), L21(g);
+    View( P1, P, jb, 0, b, P.Width() );
+    View( P2, P, jb+b, 0, n-jb-b, P.Width() );
+    LockedView( L11, L, 0, 0, b, b );
+    LockedView( L21, L, b, 0, n-jb-b, b );
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), L11, P1 );
+    if( n-jb-b > 0 )
+        Gemm( NORMAL, NORMAL, F(-1), L21, P1, F(1), P2 );
+}
+
+} // namespace out_of_core
+
+//
+// Overwrite the Hermitian positive-definite matrix stored in 'filename'
+// with its Cholesky factor. Only the uplo triangle is accessed.
+//
+template<typename F>
+inline void
+OutOfCoreCholesky
+( UpperOrLower uplo, const std::string filename, int panelWidth,
+  int numResident=2, const Grid& g=DefaultGrid() )
+{
+#ifndef RELEASE
+    PushCallStack("OutOfCoreCholesky");
+    if( panelWidth < 1 )
+        throw std::logic_error("panelWidth must be positive");
+    if( numResident < 0 )
+        throw std::logic_error("numResident cannot be negative");
+#endif
+    using namespace out_of_core;
+    const int b = panelWidth;
+    mpi::Comm comm = g.ViewingComm();
+    DistMatrix<F> buffer0(g), buffer1(g);
+    DistMatrix<F>* buffers[2] = { &buffer0, &buffer1 };
+    mpi::Request requests[2];
+
+    int n, width;
+    mpi::File fh[2];
+    internal::OpenBinaryBlocks( buffer0, filename, fh[0], n, width );
+    internal::OpenBinaryBlocks( buffer0, filename, fh[1], n, width );
+    if( n != width )
+    {
+        mpi::FileClose( fh[0] );
+        mpi::FileClose( fh[1] );
+        throw std::logic_error("Hermitian matrices must be square");
+    }
+
+    std::deque<DistMatrix<F>*> resident;
+    for( int kb=0; kb<n; kb+=b )
+    {
+        const int k = kb / b;
+        const int nb = std::min(b,n-kb);
+        DistMatrix<F>* P;
+        if( numResident > 0 && (int)resident.size() == numResident )
+        {
+            P = resident.front();
+            resident.pop_front();
+        }
+        else
+            P = new DistMatrix<F>( g );
+        const int numStreamed = k - resident.size();
+
+        if( uplo == LOWER )
+        {
+            // Read A(kb:n-1,kb:kb+nb-1) and stream in the rows of the
+            // non-resident panels which start at kb
+            StartRead( *P, fh[0], n, kb, kb, n-kb, nb, requests[0] );
+            mpi::Wait( requests[0] );
+            if( numStreamed > 0 )
+                StartRead
+                ( *buffers[0], fh[0], n, kb, 0, n-kb, b, requests[0] );
+            for( int j=0; j<numStreamed; ++j )
+            {
+                if( j+1 < numStreamed )
+                    StartRead
+                    ( *buffers[(j+1)%2], fh[(j+1)%2], n, kb, (j+1)*b,
+                      n-kb, b, requests[(j+1)%2] );
+                mpi::Wait( requests[j%2] );
+                LowerUpdate( *P, *buffers[j%2] );
+            }
+            for( int j=numStreamed; j<k; ++j )
+            {
+                DistMatrix<F> L(g);
+                const int jb = j*b;
+                LockedView
+                ( L, *resident[j-numStreamed], kb-jb, 0, n-kb, b );
+                LowerUpdate( *P, L );
+            }
+
+            DistMatrix<F> P11(g), P21(g);
+            View( P11, *P, 0, 0, nb, nb );
+            View( P21, *P, nb, 0, n-kb-nb, nb );
+            elem::Cholesky( LOWER, P11 );
+            if( n-kb > nb )
+                Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), P11, P21 );
+            internal::WriteBinaryBlock( *P, fh[0], n, kb, kb );
+        }
+        else
+        {
+            // Read A(0:kb+nb-1,kb:kb+nb-1) and stream in the non-resident
+            // panels
+            StartRead( *P, fh[0], n, 0, kb, kb+nb, nb, requests[0] );
+            mpi::Wait( requests[0] );
+            if( numStreamed > 0 )
+                StartRead( *buffers[0], fh[0], n, 0, 0, b, b, requests[0] );
+            for( int j=0; j<numStreamed; ++j )
+            {
+                if( j+1 < numStreamed )
+                    StartRead
+                    ( *buffers[(j+1)%2], fh[(j+1)%2], n, 0, (j+1)*b,
+                      (j+2)*b, b, requests[(j+1)%2] );
+                mpi::Wait( requests[j%2] );
+                UpperUpdate( *P, *buffers[j%2], j*b );
+            }
+            for( int j=numStreamed; j<k; ++j )
+                UpperUpdate( *P, *resident[j-numStreamed], j*b );
+
+            DistMatrix<F> PT(g), P11(g);
+            View( PT, *P, 0, 0, kb, nb );
+            View( P11, *P, kb, 0, nb, nb );
+            if( kb > 0 )
+                Herk( UPPER, ADJOINT, F(-1), PT, F(1), P11 );
+            elem::Cholesky( UPPER, P11 );
+            internal::WriteBinaryBlock( *P, fh[0], n, 0, kb );
+        }
+        SyncFiles( fh, comm );
+
+        if( numResident > 0 )
+            resident.push_back( P );
+        else
+            delete P;
+    }
+    for( std::size_t j=0; j<resident.size(); ++j )
+        delete resident[j];
+    mpi::FileClose( fh[0] );
+    mpi::FileClose( fh[1] );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// Overwrite the square matrix stored in 'filename' with its LU factorization
+// with partial pivoting, as in LU( A, p ), using the process grid g (which p
+// must also be distributed over). Since the row interchanges chosen for a 
+// panel also apply to the previous panels, the stored panels are only
+// pivoted lazily, as they are streamed back in, and are brought up to date
+// in a final pass over the file.
+//
+template<typename F>
+inline void
+OutOfCoreLU
+( const std::string filename, DistMatrix<int,VC,STAR>& p, int panelWidth,
+  int numResident=2, const Grid& g=DefaultGrid() )
+{
+#ifndef RELEASE
+    PushCallStack("OutOfCoreLU");
+    if( panelWidth < 1 )
+        throw std::logic_error("panelWidth must be positive");
+    if( numResident < 0 )
+        throw std::logic_error("numResident cannot be negative");
+#endif
+    if( p.Grid() != g )
+        throw std::logic_error("p must be distributed over g");
+    using namespace out_of_core;
+    const int b = panelWidth;
+    mpi::Comm comm = g.ViewingComm();
+    DistMatrix<F> buffer0(g), buffer1(g);
+    DistMatrix<F>* buffers[2] = { &buffer0, &buffer1 };
+    mpi::Request requests[2];
+
+    int n, width;
+    mpi::File fh[2];
+    internal::OpenBinaryBlocks( buffer0, filename, fh[0], n, width );
+    internal::OpenBinaryBlocks( buffer0, filename, fh[1], n, width );
+    if( n != width )
+    {
+        mpi::FileClose( fh[0] );
+        mpi::FileClose( fh[1] );
+        throw std::logic_error("Out-of-core LU requires a square matrix");
+    }
+
+    // Every process stores the global pivot indices
+    std::vector<int> pivots( n );
+    DistMatrix<int,VC,STAR> pPanel(g);
+    DistMatrix<int,STAR,STAR> pPanel_STAR_STAR(g);
+
+    // The resident panels are stored in full and kept fully pivoted
+    std::deque<DistMatrix<F>*> resident;
+    for( int kb=0; kb<n; kb+=b )
+    {
+        const int k = kb / b;
+        const int nb = std::min(b,n-kb);
+        DistMatrix<F>* P;
+        if( numResident > 0 && (int)resident.size() == numResident )
+        {
+            P = resident.front();
+            resident.pop_front();
+        }
+        else
+            P = new DistMatrix<F>( g );
+        const int numStreamed = k - resident.size();
+
+        // Read the entire panel and apply all of the previous pivots
+        StartRead( *P, fh[0], n, 0, kb, n, nb, requests[0] );
+        mpi::Wait( requests[0] );
+        ApplyPivots( *P, pivots, 0, kb, 0 );
+
+        // Stream in the rows of the non-resident panels which start at their
+        // diagonal blocks and bring them up to date with the later pivots
+        if( numStreamed > 0 )
+            StartRead( *buffers[0], fh[0], n, 0, 0, n, b, requests[0] );
+        for( int j=0; j<numStreamed; ++j )
+        {
+            const int jb = j*b;
+            if( j+1 < numStreamed )
+                StartRead
+                ( *buffers[(j+1)%2], fh[(j+1)%2], n, jb+b, jb+b,
+                  n-jb-b, b, requests[(j+1)%2] );
+            mpi::Wait( requests[j%2] );
+            ApplyPivots( *buffers[j%2], pivots, jb+b, kb, jb );
+            LUUpdate( *P, *buffers[j%2], jb );
+        }
+        for( int j=numStreamed; j<k; ++j )
+        {
+            DistMatrix<F> L(g);
+            const int jb = j*b;
+            LockedView( L, *resident[j-numStreamed], jb, 0, n-jb, b );
+            LUUpdate( *P, L, jb );
+        }
+
+        // Factor the bottom of the panel and pivot the resident panels
+        DistMatrix<F> PB(g);
+        View( PB, *P, kb, 0, n-kb, nb );
+        pPanel.ResizeTo( nb, 1 );
+        LU( PB, pPanel );
+        pPanel_STAR_STAR = pPanel;
+        for( int i=0; i<nb; ++i )
+            pivots[kb+i] = pPanel_STAR_STAR.GetLocal(i,0) + kb;
+        for( std::size_t j=0; j<resident.size(); ++j )
+            ApplyPivots( *resident[j], pivots, kb, kb+nb, 0 );
+
+        internal::WriteBinaryBlock( *P, fh[0], n, 0, kb );
+        SyncFiles( fh, comm );
+        if( numResident > 0 )
+            resident.push_back( P );
+        else
+            delete P;
+    }
+
+    // Apply the remaining pivots to the stored panels, writing the resident
+    // panels directly
+    const int numPanels = (n+b-1) / b;
+    const int numStreamed = numPanels - resident.size();
+    for( int j=0; j<numStreamed; ++j )
+    {
+        const int jb = j*b;
+        if( jb+b >= n )
+            break;
+        DistMatrix<F> L(g);
+        StartRead( L, fh[0], n, jb+b, jb, n-jb-b, b, requests[0] );
+        mpi::Wait( requests[0] );
+        ApplyPivots( L, pivots, jb+b, n, jb+b );
+        internal::WriteBinaryBlock( L, fh[0], n, jb+b, jb );
+    }
+    for( std::size_t j=0; j<resident.size(); ++j )
+    {
+        const int jb = (numStreamed+j)*b;
+        internal::WriteBinaryBlock( *resident[j], fh[0], n, 0, jb );
+        delete resident[j];
+    }
+    mpi::FileClose( fh[0] );
+    mpi::FileClose( fh[1] );
+
+    p.ResizeTo( n, 1 );
+    const int colShift = p.ColShift();
+    const int colStride = p.ColStride();
+    const int localHeight = p.LocalHeight();
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        p.SetLocal( iLocal, 0, pivots[colShift+iLocal*colStride] );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_OUTOFCORE_HPP
@@ -12,6 +12,7 @@
 
 #include "elemental/lapack-like/Polar/SVD.hpp"
 #include "elemental/lapack-like/Polar/Halley.hpp"
+#include "elemental/lapack-like/Polar/NewtonSchulz.hpp"
 #include "elemental/lapack-like/Polar/QDWH.hpp"
 
 namespace elem {
@@ -0,0 +1,284 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_POLAR_NEWTONSCHULZ_HPP
+#define LAPACK_POLAR_NEWTONSCHULZ_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level1/Nrm2.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level2/Hemv.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Herk.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/Norm/TwoUpperBound.hpp"
+#include "elemental/lapack-like/Polar/QDWH.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// The Newton-Schulz iteration for the polar factor,
+//
+//     X_{k+1} = X_k (3 I - X_k^H X_k) / 2,
+//
+// only requires matrix-matrix multiplication, and therefore runs at a much
+// higher rate than the QR and Cholesky-based steps of QDWH on large grids.
+// However, it only converges for singular values in (0,sqrt(3)), and small
+// singular values are only amplified by a factor of 3/2 per step, so it is
+// only worthwhile for well-conditioned matrices. See
+//
+//   N. J. Higham, "Functions of Matrices: Theory and Computation",
+//   SIAM, 2008, Section 8.3.
+//
+// The Gram matrix G = A^H A is formed once and a few steps of the power
+// method are used to estimate both ||G||_2, which determines the scaling
+// X_0 = A/sqrt(||G||_2), and delta = ||I - X_0^H X_0||_2, which determines
+// the smallest singular value of X_0, sqrt(1-delta). If the number of steps
+// predicted from these estimates exceeds maxIts, or the iteration has not
+// converged after maxIts steps, we fall back to QDWH from the current iterate.
+//
+
+namespace elem {
+
+namespace newton_schulz {
+
+// The number of steps required to drive 1 - sigma^2 below tol, starting from
+// the smallest singular value sigmaMin
+template<typename R>
+inline int
+PredictedIts( R sigmaMin, R tol )
+{
+    int numIts = 0;
+    R sigma = sigmaMin;
+    while( 1-sigma*sigma > tol && numIts <= 100 )
+    {
+        sigma = sigma*(3-sigma*sigma)/2;
+        ++numIts;
+    }
+    return numIts;
+}
+
+// Estimate the two-norm of the Hermitian matrix whose lower triangle is
+// stored in H using a few steps of the power method
+template<typename F>
+inline typename Base<F>::type
+HermitianTwoNormEstimate( const Matrix<F>& H, int numPowerIts=10 )
+{
+    typedef typename Base<F>::type R;
+    const int n = H.Height();
+    Matrix<F> x, y;
+    Uniform( n, 1, x );
+    Zeros( n, 1, y );
+    R estimate = 0;
+    for( int k=0; k<numPowerIts; ++k )
+    {
+        const R xNorm = Nrm2( x );
+        if( xNorm == R(0) )
+            break;
+        Scale( 1/xNorm, x );
+        Hemv( LOWER, F(1), H, x, F(0), y );
+        estimate = Nrm2( y );
+        x = y;
+    }
+    return estimate;
+}
+
+template<typename F>
+inline typename Base<F>::type
+HermitianTwoNormEstimate( const DistMatrix<F>& H, int numPowerIts=10 )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = H.Grid();
+    const int n = H.Height();
+    DistMatrix<F> x( g ), y( g );
+    Uniform( n, 1, x );
+    Zeros( n, 1, y );
+    R estimate = 0;
+    for( int k=0; k<numPowerIts; ++k )
+    {
+        const R xNorm = Nrm2( x );
+        if( xNorm == R(0) )
+            break;
+        Scale( 1/xNorm, x );
+        Hemv( LOWER, F(1), H, x, F(0), y );
+        estimate = Nrm2( y );
+        x = y;
+    }
+    return estimate;
+}
+
+} // namespace newton_schulz
+
+namespace polar {
+
+template<typename F>
+inline int
+NewtonSchulz( Matrix<F>& A, int maxIts=10 )
+{
+#ifndef RELEASE
+    PushCallStack("polar::NewtonSchulz");
+#endif
+    typedef typename Base<F>::type R;
+    const int height = A.Height();
+    const int width = A.Width();
+    if( height < width )
+        throw std::logic_error("Height cannot be less than width");
+
+    const R epsilon = lapack::MachineEpsilon<R>();
+    const R tol = 5*epsilon;
+    const R sqrtTol = Sqrt( tol );
+
+    // Scale A so that its largest singular value is (approximately) one
+    Matrix<F> G;
+    Zeros( width, width, G );
+    Herk( LOWER, ADJOINT, F(1), A, F(0), G );
+    const R gramNorm = newton_schulz::HermitianTwoNormEstimate( G );
+    if( gramNorm == R(0) )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return 0;
+    }
+    Scale( 1/Sqrt(gramNorm), A );
+
+    // E := I - A^H A
+    Matrix<F> E;
+    Identity( width, width, E );
+    Axpy( -1/gramNorm, G, E );
+    G.Empty();
+
+    int numIts=0;
+    const R delta = newton_schulz::HermitianTwoNormEstimate( E );
+    bool fallBack = ( delta >= R(1) ||
+        newton_schulz::PredictedIts( Sqrt(1-delta), tol ) > maxIts );
+    R lowerBound = ( delta < R(1) ? Sqrt(1-delta) : R(0) );
+    Matrix<F> ALast;
+    while( !fallBack )
+    {
+        ++numIts;
+
+        // A := A (I + E/2) = A (3 I - A^H A) / 2
+        const R frobNormE = HermitianFrobeniusNorm( LOWER, E );
+        MakeHermitian( LOWER, E );
+        ALast = A;
+        Gemm( NORMAL, NORMAL, F(R(1)/R(2)), ALast, E, F(1), A );
+
+        // The departure from orthonormality after this step is O(||E||^2)
+        if( frobNormE <= sqrtTol )
+            break;
+        else if( numIts == maxIts )
+        {
+            fallBack = true;
+            lowerBound = ( frobNormE < R(1) ? Sqrt(1-frobNormE) : R(0) );
+            break;
+        }
+
+        Identity( width, width, E );
+        Herk( LOWER, ADJOINT, F(-1), A, F(1), E );
+    }
+    if( fallBack )
+    {
+        // Convergence would be slow, so finish with QDWH
+        const R upperBound = TwoNormUpperBound( A );
+        numIts += polar::QDWH
+        ( A, std::max(lowerBound/upperBound,epsilon), upperBound );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return numIts;
+}
+
+template<typename F>
+inline int
+NewtonSchulz( DistMatrix<F>& A, int maxIts=10 )
+{
+#ifndef RELEASE
+    PushCallStack("polar::NewtonSchulz");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int height = A.Height();
+    const int width = A.Width();
+    if( height < width )
+        throw std::logic_error("Height cannot be less than width");
+
+    const R epsilon = lapack::MachineEpsilon<R>();
+    const R tol = 5*epsilon;
+    const R sqrtTol = Sqrt( tol );
+
+    // Scale A so that its largest singular value is (approximately) one
+    DistMatrix<F> G( g );
+    Zeros( width, width, G );
+    Herk( LOWER, ADJOINT, F(1), A, F(0), G );
+    const R gramNorm = newton_schulz::HermitianTwoNormEstimate( G );
+    if( gramNorm == R(0) )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return 0;
+    }
+    Scale( 1/Sqrt(gramNorm), A );
+
+    // E := I - A^H A
+    DistMatrix<F> E( g );
+    Identity( width, width, E );
+    Axpy( -1/gramNorm, G, E );
+    G.Empty();
+
+    int numIts=0;
+    const R delta = newton_schulz::HermitianTwoNormEstimate( E );
+    bool fallBack = ( delta >= R(1) ||
+        newton_schulz::PredictedIts( Sqrt(1-delta), tol ) > maxIts );
+    R lowerBound = ( delta < R(1) ? Sqrt(1-delta) : R(0) );
+    DistMatrix<F> ALast( g );
+    while( !fallBack )
+    {
+        ++numIts;
+
+        // A := A (I + E/2) = A (3 I - A^H A) / 2
+        const R frobNormE = HermitianFrobeniusNorm( LOWER, E );
+        MakeHermitian( LOWER, E );
+        ALast = A;
+        Gemm( NORMAL, NORMAL, F(R(1)/R(2)), ALast, E, F(1), A );
+
+        // The departure from orthonormality after this step is O(||E||^2)
+        if( frobNormE <= sqrtTol )
+            break;
+        else if( numIts == maxIts )
+        {
+            fallBack = true;
+            lowerBound = ( frobNormE < R(1) ? Sqrt(1-frobNormE) : R(0) );
+            break;
+        }
+
+        Identity( width, width, E );
+        Herk( LOWER, ADJOINT, F(-1), A, F(1), E );
+    }
+    if( fallBack )
+    {
+        // Convergence would be slow, so finish with QDWH
+        const R upperBound = TwoNormUpperBound( A );
+        numIts += polar::QDWH
+        ( A, std::max(lowerBound/upperBound,epsilon), upperBound );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return numIts;
+}
+
+} // namespace polar
+} // namespace elem
+
+#endif // ifndef LAPACK_POLAR_NEWTONSCHULZ_HPP
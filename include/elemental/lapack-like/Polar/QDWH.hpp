@@ -23,6 +23,23 @@
 
 namespace elem {
 
+namespace qdwh {
+
+//
+// The QR-based iteration is only required while the Cholesky factorization of
+// Z = I + c A^H A would be inaccurate. Rather than using the bound
+// cond(Z) <= 1+c, which led to the fixed switching criterion c <= 100, we use 
+// the sharper bound cond(Z) <= (1+c)/(1+c L^2), where L is the current lower
+// bound on the singular values of A. This typically allows switching to the
+// Cholesky-based iteration one or more iterations earlier.
+//
+template<typename R>
+inline bool
+UseCholesky( R c, R L2 )
+{ return 1+c <= 100*(1+c*L2); }
+
+} // namespace qdwh
+
 //
 // Based on Yuji Nakatsukasa's implementation of a QR-based dynamically 
 // weighted Halley iteration for the polar decomposition. In particular, this
@@ -96,12 +113,12 @@ QDWH
         const R a = (sqd + Sqrt( arg )/2).real;
         const R b = (a-1)*(a-1)/4;
         const R c = a+b-1;
-        const Complex<R> alpha = a-b/c;
-        const Complex<R> beta = b/c;
+        const F alpha = a-b/c;
+        const F beta = b/c;
 
         lowerBound = lowerBound*(a+b*L2)/(1+c*L2);
 
-        if( c > 100 )
+        if( !qdwh::UseCholesky( c, L2 ) )
         {
             //
             // The standard QR-based algorithm
@@ -109,13 +126,14 @@ QDWH
             QT = A;
             Scale( Sqrt(c), QT );
             MakeIdentity( QB );
-            qr::Explicit( Q );
+            qr::ExplicitStacked( Q );
             Gemm( NORMAL, ADJOINT, alpha/Sqrt(c), QT, QB, beta, A );
         }
         else
         {
             //
-            // Use faster Cholesky-based algorithm since A is well-conditioned
+            // Use faster Cholesky-based algorithm since I + c A^H A is 
+            // well-conditioned
             //
             Identity( width, width, C );
             Herk( LOWER, ADJOINT, F(c), A, F(1), C );
@@ -196,12 +214,12 @@ QDWH
         const R a = (sqd + Sqrt( arg )/2).real;
         const R b = (a-1)*(a-1)/4;
         const R c = a+b-1;
-        const Complex<R> alpha = a-b/c;
-        const Complex<R> beta = b/c;
+        const F alpha = a-b/c;
+        const F beta = b/c;
 
         lowerBound = lowerBound*(a+b*L2)/(1+c*L2);
 
-        if( c > 100 )
+        if( !qdwh::UseCholesky( c, L2 ) )
         {
             //
             // The standard QR-based algorithm
@@ -209,13 +227,14 @@ QDWH
             QT = A;
             Scale( Sqrt(c), QT );
             MakeIdentity( QB );
-            qr::Explicit( Q );
+            qr::ExplicitStacked( Q );
             Gemm( NORMAL, ADJOINT, alpha/Sqrt(c), QT, QB, beta, A );
         }
         else
         {
             //
-            // Use faster Cholesky-based algorithm since A is well-conditioned
+            // Use faster Cholesky-based algorithm since I + c A^H A is 
+            // well-conditioned
             //
             Identity( width, width, C );
             Herk( LOWER, ADJOINT, F(c), A, F(1), C );
@@ -298,12 +317,12 @@ QDWH
         const R a = (sqd + Sqrt( arg )/2).real;
         const R b = (a-1)*(a-1)/4;
         const R c = a+b-1;
-        const Complex<R> alpha = a-b/c;
-        const Complex<R> beta = b/c;
+        const F alpha = a-b/c;
+        const F beta = b/c;
 
         lowerBound = lowerBound*(a+b*L2)/(1+c*L2);
 
-        if( c > 100 )
+        if( !qdwh::UseCholesky( c, L2 ) )
         {
             //
             // The standard QR-based algorithm
@@ -312,13 +331,14 @@ QDWH
             QT = A;
             Scale( Sqrt(c), QT );
             MakeIdentity( QB );
-            qr::Explicit( Q );
+            qr::ExplicitStacked( Q );
             Trrk( uplo, NORMAL, ADJOINT, alpha/Sqrt(c), QT, QB, beta, A );
         }
         else
         {
             //
-            // Use faster Cholesky-based algorithm since A is well-conditioned
+            // Use faster Cholesky-based algorithm since I + c A^H A is 
+            // well-conditioned
             //
             // TODO: Think of how to better exploit the symmetry of A,
             //       e.g., by halving the work in the first Herk through 
@@ -404,12 +424,12 @@ QDWH
         const R a = (sqd + Sqrt( arg )/2).real;
         const R b = (a-1)*(a-1)/4;
         const R c = a+b-1;
-        const Complex<R> alpha = a-b/c;
-        const Complex<R> beta = b/c;
+        const F alpha = a-b/c;
+        const F beta = b/c;
 
         lowerBound = lowerBound*(a+b*L2)/(1+c*L2);
 
-        if( c > 100 )
+        if( !qdwh::UseCholesky( c, L2 ) )
         {
             //
             // The standard QR-based algorithm
@@ -418,13 +438,14 @@ QDWH
             QT = A;
             Scale( Sqrt(c), QT );
             MakeIdentity( QB );
-            qr::Explicit( Q );
+            qr::ExplicitStacked( Q );
             Trrk( uplo, NORMAL, ADJOINT, alpha/Sqrt(c), QT, QB, beta, A );
         }
         else
         {
             //
-            // Use faster Cholesky-based algorithm since A is well-conditioned
+            // Use faster Cholesky-based algorithm since I + c A^H A is 
+            // well-conditioned
             //
             // TODO: Think of how to better exploit the symmetry of A,
             //       e.g., by halving the work in the first Herk through 
@@ -13,6 +13,8 @@
 #include "elemental/lapack-like/QR/Cholesky.hpp"
 #include "elemental/lapack-like/QR/Householder.hpp"
 #include "elemental/lapack-like/QR/Explicit.hpp"
+#include "elemental/lapack-like/QR/TS.hpp"
+#include "elemental/lapack-like/QR/Stacked.hpp"
 
 namespace elem {
 
@@ -0,0 +1,290 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_QR_STACKED_HPP
+#define LAPACK_QR_STACKED_HPP
+
+#include "elemental/lapack-like/ApplyPackedReflectors.hpp"
+#include "elemental/lapack-like/QR/PanelHouseholder.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// Householder QR factorizations of (m+n) x n matrices of the form
+//
+//   [ A ]
+//   [ B ],
+//
+// where A is m x n, with m >= n, and B is n x n upper triangular (e.g., the
+// identity matrix in QDWH). Since the bottom block remains upper triangular
+// as the factorization progresses, the j'th Householder vector is nonzero
+// only within rows j through m+j, so each block of reflectors is only
+// computed and applied within that window of rows rather than over all of
+// the trailing m+n-j rows. For m = n, this roughly halves the work.
+//
+
+namespace elem {
+namespace qr {
+namespace stacked {
+
+template<typename Real>
+inline void
+PanelQR( Matrix<Real>& A, Matrix<Real>& t )
+{ PanelHouseholder( A ); }
+
+template<typename Real>
+inline void
+PanelQR( Matrix<Complex<Real> >& A, Matrix<Complex<Real> >& t )
+{ PanelHouseholder( A, t ); }
+
+template<typename Real>
+inline void
+PanelQR( DistMatrix<Real>& A, DistMatrix<Real,MD,STAR>& t )
+{ PanelHouseholder( A ); }
+
+template<typename Real>
+inline void
+PanelQR
+( DistMatrix<Complex<Real> >& A, DistMatrix<Complex<Real>,MD,STAR>& t )
+{ PanelHouseholder( A, t ); }
+
+// Apply the adjoint of the panel's Q from the left
+template<typename Real>
+inline void
+ApplyQAdjoint
+( const Matrix<Real>& H, const Matrix<Real>& t, Matrix<Real>& A )
+{ ApplyPackedReflectors( LEFT, LOWER, VERTICAL, FORWARD, 0, H, A ); }
+
+template<typename Real>
+inline void
+ApplyQAdjoint
+( const Matrix<Complex<Real> >& H, const Matrix<Complex<Real> >& t,
+  Matrix<Complex<Real> >& A )
+{
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, H, t, A );
+}
+
+template<typename Real>
+inline void
+ApplyQAdjoint
+( const DistMatrix<Real>& H, const DistMatrix<Real,MD,STAR>& t,
+  DistMatrix<Real>& A )
+{ ApplyPackedReflectors( LEFT, LOWER, VERTICAL, FORWARD, 0, H, A ); }
+
+template<typename Real>
+inline void
+ApplyQAdjoint
+( const DistMatrix<Complex<Real> >& H,
+  const DistMatrix<Complex<Real>,MD,STAR>& t,
+  DistMatrix<Complex<Real> >& A )
+{
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, H, t, A );
+}
+
+// Apply the panel's Q from the left
+template<typename Real>
+inline void
+ApplyQ( const Matrix<Real>& H, const Matrix<Real>& t, Matrix<Real>& A )
+{ ApplyPackedReflectors( LEFT, LOWER, VERTICAL, BACKWARD, 0, H, A ); }
+
+template<typename Real>
+inline void
+ApplyQ
+( const Matrix<Complex<Real> >& H, const Matrix<Complex<Real> >& t,
+  Matrix<Complex<Real> >& A )
+{
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 0, H, t, A );
+}
+
+template<typename Real>
+inline void
+ApplyQ
+( const DistMatrix<Real>& H, const DistMatrix<Real,MD,STAR>& t,
+  DistMatrix<Real>& A )
+{ ApplyPackedReflectors( LEFT, LOWER, VERTICAL, BACKWARD, 0, H, A ); }
+
+template<typename Real>
+inline void
+ApplyQ
+( const DistMatrix<Complex<Real> >& H,
+  const DistMatrix<Complex<Real>,MD,STAR>& t,
+  DistMatrix<Complex<Real> >& A )
+{
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 0, H, t, A );
+}
+
+} // namespace stacked
+
+//
+// Overwrite A with the packed QR factorization of the stacked matrix, where
+// t holds the scalings of the (complex) Householder reflectors and is unused
+// for real data
+//
+
+template<typename F>
+inline void
+Stacked( Matrix<F>& A, Matrix<F>& t )
+{
+#ifndef RELEASE
+    PushCallStack("qr::Stacked");
+#endif
+    const int n = A.Width();
+    const int m = A.Height() - n;
+    if( m < n )
+        throw std::logic_error
+        ("The top block must be at least as tall as it is wide");
+    Zeros( n, 1, t );
+
+    Matrix<F> APan, ARight, t1;
+    const int bsize = Blocksize();
+    for( int k=0; k<n; k+=bsize )
+    {
+        const int nb = std::min(bsize,n-k);
+        View( APan, A, k, k, m+nb, nb );
+        View( ARight, A, k, k+nb, m+nb, n-k-nb );
+        View( t1, t, k, 0, nb, 1 );
+        stacked::PanelQR( APan, t1 );
+        stacked::ApplyQAdjoint( APan, t1, ARight );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+Stacked( DistMatrix<F>& A, DistMatrix<F,MD,STAR>& t )
+{
+#ifndef RELEASE
+    PushCallStack("qr::Stacked");
+    if( A.Grid() != t.Grid() )
+        throw std::logic_error("{A,t} must be distributed over the same grid");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+    const int m = A.Height() - n;
+    if( m < n )
+        throw std::logic_error
+        ("The top block must be at least as tall as it is wide");
+    if( t.Viewing() )
+    {
+        if( !t.AlignedWithDiagonal( A ) )
+            throw std::logic_error("t was not aligned with A");
+        if( t.Height() != n || t.Width() != 1 )
+            throw std::logic_error("t was not the appropriate shape");
+    }
+    else
+    {
+        t.Empty();
+        t.AlignWithDiagonal( A );
+        t.ResizeTo( n, 1 );
+    }
+
+    DistMatrix<F> APan(g), ARight(g);
+    DistMatrix<F,MD,STAR> t1(g);
+    const int bsize = Blocksize();
+    for( int k=0; k<n; k+=bsize )
+    {
+        const int nb = std::min(bsize,n-k);
+        View( APan, A, k, k, m+nb, nb );
+        View( ARight, A, k, k+nb, m+nb, n-k-nb );
+        View( t1, t, k, 0, nb, 1 );
+        stacked::PanelQR( APan, t1 );
+        stacked::ApplyQAdjoint( APan, t1, ARight );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// Overwrite the stacked matrix with the first n columns of its Q factor.
+// The Householder vectors are applied in reverse order to the identity, and
+// each block only modifies the window of rows where its vectors are nonzero.
+//
+
+template<typename F>
+inline void
+ExplicitStacked( Matrix<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("qr::ExplicitStacked");
+#endif
+    const int n = A.Width();
+    const int m = A.Height() - n;
+    Matrix<F> t;
+    Stacked( A, t );
+
+    Matrix<F> APan, ACols, ARight, HPanCopy, t1;
+    const int bsize = Blocksize();
+    const int lastPanel = ( n > 0 ? ((n-1)/bsize)*bsize : 0 );
+    for( int k=lastPanel; k>=0 && n>0; k-=bsize )
+    {
+        const int nb = std::min(bsize,n-k);
+        View( APan, A, k, k, m+nb, nb );
+        View( ACols, A, 0, k, m+n, nb );
+        View( ARight, A, k, k, m+nb, n-k );
+        View( t1, t, k, 0, nb, 1 );
+
+        HPanCopy = APan;
+        MakeZeros( ACols );
+        for( int j=0; j<nb; ++j )
+            A.Set( k+j, k+j, F(1) );
+        stacked::ApplyQ( HPanCopy, t1, ARight );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+ExplicitStacked( DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("qr::ExplicitStacked");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+    const int m = A.Height() - n;
+    DistMatrix<F,MD,STAR> t(g);
+    Stacked( A, t );
+
+    DistMatrix<F> APan(g), ACols(g), ARight(g), HPanCopy(g);
+    DistMatrix<F,MD,STAR> t1(g);
+    const int bsize = Blocksize();
+    const int lastPanel = ( n > 0 ? ((n-1)/bsize)*bsize : 0 );
+    for( int k=lastPanel; k>=0 && n>0; k-=bsize )
+    {
+        const int nb = std::min(bsize,n-k);
+        View( APan, A, k, k, m+nb, nb );
+        View( ACols, A, 0, k, m+n, nb );
+        View( ARight, A, k, k, m+nb, n-k );
+        View( t1, t, k, 0, nb, 1 );
+
+        HPanCopy.Empty();
+        HPanCopy.AlignWith( APan );
+        HPanCopy = APan;
+        MakeZeros( ACols );
+        for( int j=0; j<nb; ++j )
+            A.Set( k+j, k+j, F(1) );
+        stacked::ApplyQ( HPanCopy, t1, ARight );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace qr
+} // namespace elem
+
+#endif // ifndef LAPACK_QR_STACKED_HPP
@@ -0,0 +1,272 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_QR_TS_HPP
+#define LAPACK_QR_TS_HPP
+
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/lapack-like/ApplyPackedReflectors.hpp"
+#include "elemental/lapack-like/QR.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// Tall-skinny QR (TSQR): each process factors its local rows of A[VC,* ]
+// and the resulting n x n triangular factors are then combined pairwise
+// along a binary tree, so that only O(n^2 log p) data is communicated rather
+// than the O(n) latency-bound panel reductions of Householder QR.
+//
+
+namespace elem {
+namespace qr {
+namespace ts {
+
+template<typename F>
+struct TreeData
+{
+    // The packed QR factorization of the local rows of A
+    Matrix<F> QR0, t0;
+    // The packed QR factorizations of the stacked 2n x n triangular factors,
+    // with one block column per level of the tree
+    Matrix<F> QRTree, tTree;
+    std::vector<bool> combined;
+    // The triangular factor of the subtree rooted at this process, which is
+    // the R from the QR factorization of A on the root (VC rank 0)
+    Matrix<F> R;
+};
+
+template<typename Real>
+inline void
+LocalQR( Matrix<Real>& A, Matrix<Real>& t )
+{ QR( A ); }
+
+template<typename Real>
+inline void
+LocalQR( Matrix<Complex<Real> >& A, Matrix<Complex<Real> >& t )
+{ QR( A, t ); }
+
+template<typename Real>
+inline void
+ApplyLocalQ( const Matrix<Real>& QR, const Matrix<Real>& t, Matrix<Real>& A )
+{ ApplyPackedReflectors( LEFT, LOWER, VERTICAL, BACKWARD, 0, QR, A ); }
+
+template<typename Real>
+inline void
+ApplyLocalQ
+( const Matrix<Complex<Real> >& QR, const Matrix<Complex<Real> >& t,
+  Matrix<Complex<Real> >& A )
+{
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 0, QR, t, A );
+}
+
+inline int
+NumLevels( int p )
+{
+    int numLevels = 0;
+    while( (1<<numLevels) < p )
+        ++numLevels;
+    return numLevels;
+}
+
+// Send/receive an n x n matrix, which need not have a leading dimension of n
+template<typename F>
+inline void
+SendSquare( const Matrix<F>& A, int to, mpi::Comm comm )
+{
+    const int n = A.Height();
+    std::vector<F> buffer( n*n );
+    for( int j=0; j<n; ++j )
+        MemCopy( &buffer[j*n], A.LockedBuffer(0,j), n );
+    if( n > 0 )
+        mpi::Send( &buffer[0], n*n, to, 0, comm );
+}
+
+template<typename F>
+inline void
+RecvSquare( Matrix<F>& A, int from, mpi::Comm comm )
+{
+    const int n = A.Height();
+    std::vector<F> buffer( n*n );
+    if( n > 0 )
+        mpi::Recv( &buffer[0], n*n, from, 0, comm );
+    for( int j=0; j<n; ++j )
+        MemCopy( A.Buffer(0,j), &buffer[j*n], n );
+}
+
+template<typename F>
+inline void
+Reduce( const DistMatrix<F,VC,STAR>& A, TreeData<F>& treeData )
+{
+#ifndef RELEASE
+    PushCallStack("qr::ts::Reduce");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+    const int p = g.Size();
+    const int rank = g.VCRank();
+    mpi::Comm comm = g.VCComm();
+    if( A.Height() < p*n )
+        throw std::logic_error
+        ("TSQR requires at least as many rows per process as columns");
+
+    // Factor the local rows
+    treeData.QR0 = A.LockedMatrix();
+    LocalQR( treeData.QR0, treeData.t0 );
+    Matrix<F> QR0T, QR0B;
+    LockedPartitionDown
+    ( treeData.QR0, QR0T,
+                    QR0B, n );
+    treeData.R = QR0T;
+    MakeTriangular( UPPER, treeData.R );
+
+    // Combine the triangular factors up the tree
+    const int numLevels = NumLevels( p );
+    Zeros( 2*n, numLevels*n, treeData.QRTree );
+    Zeros( n, numLevels, treeData.tTree );
+    treeData.combined.assign( numLevels, false );
+    for( int level=0; level<numLevels; ++level )
+    {
+        const int stride = 1<<level;
+        if( rank % (2*stride) != 0 )
+        {
+            SendSquare( treeData.R, rank-stride, comm );
+            break;
+        }
+        const int partner = rank + stride;
+        if( partner >= p )
+            continue;
+
+        Matrix<F> QR, t, QRT, QRB;
+        View( QR, treeData.QRTree, 0, level*n, 2*n, n );
+        View( t, treeData.tTree, 0, level, n, 1 );
+        PartitionDown
+        ( QR, QRT,
+              QRB, n );
+        for( int j=0; j<n; ++j )
+            MemCopy( QRT.Buffer(0,j), treeData.R.LockedBuffer(0,j), n );
+        RecvSquare( QRB, partner, comm );
+        LocalQR( QR, t );
+        treeData.combined[level] = true;
+        treeData.R = QRT;
+        MakeTriangular( UPPER, treeData.R );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Broadcast the triangular factor from the root into R[* ,* ]
+template<typename F>
+inline void
+BroadcastR( const TreeData<F>& treeData, DistMatrix<F,STAR,STAR>& R )
+{
+#ifndef RELEASE
+    PushCallStack("qr::ts::BroadcastR");
+#endif
+    const Grid& g = R.Grid();
+    const int n = treeData.QR0.Width();
+    std::vector<F> buffer( n*n );
+    if( g.VCRank() == 0 )
+        for( int j=0; j<n; ++j )
+            MemCopy( &buffer[j*n], treeData.R.LockedBuffer(0,j), n );
+    if( n > 0 )
+        mpi::Broadcast( &buffer[0], n*n, 0, g.VCComm() );
+    R.ResizeTo( n, n );
+    for( int j=0; j<n; ++j )
+        MemCopy( R.Buffer(0,j), &buffer[j*n], n );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Overwrite A with the explicit (thin) Q by applying the tree, from the root
+// down, to the first n columns of the identity
+template<typename F>
+inline void
+FormQ( const TreeData<F>& treeData, DistMatrix<F,VC,STAR>& A )
+{
+#ifndef RELEASE
+    PushCallStack("qr::ts::FormQ");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+    const int p = g.Size();
+    const int rank = g.VCRank();
+    mpi::Comm comm = g.VCComm();
+    const int numLevels = NumLevels( p );
+
+    // Find the level at which this process handed off its triangular factor
+    int sendLevel = 0;
+    while( sendLevel < numLevels && rank % (2<<sendLevel) == 0 )
+        ++sendLevel;
+
+    Matrix<F> Q( n, n );
+    if( sendLevel == numLevels )
+        MakeIdentity( Q );
+    else
+        RecvSquare( Q, rank-(1<<sendLevel), comm );
+
+    Matrix<F> QR, t, Z, ZT, ZB;
+    for( int level=sendLevel-1; level>=0; --level )
+    {
+        if( !treeData.combined[level] )
+            continue;
+        LockedView( QR, treeData.QRTree, 0, level*n, 2*n, n );
+        LockedView( t, treeData.tTree, 0, level, n, 1 );
+        Zeros( 2*n, n, Z );
+        PartitionDown
+        ( Z, ZT,
+             ZB, n );
+        for( int j=0; j<n; ++j )
+            MemCopy( ZT.Buffer(0,j), Q.LockedBuffer(0,j), n );
+        ApplyLocalQ( QR, t, Z );
+        SendSquare( ZB, rank+(1<<level), comm );
+        for( int j=0; j<n; ++j )
+            MemCopy( Q.Buffer(0,j), ZT.LockedBuffer(0,j), n );
+    }
+
+    Matrix<F>& ALocal = A.Matrix();
+    MakeZeros( ALocal );
+    for( int j=0; j<n; ++j )
+        MemCopy( ALocal.Buffer(0,j), Q.LockedBuffer(0,j), n );
+    ApplyLocalQ( treeData.QR0, treeData.t0, ALocal );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace ts
+
+//
+// Computes the QR factorization of the tall-skinny matrix A, which must have
+// at least as many rows on each process as it has columns, and overwrites A
+// with Q
+//
+
+template<typename F>
+inline void
+TS( DistMatrix<F,VC,STAR>& A, DistMatrix<F,STAR,STAR>& R )
+{
+#ifndef RELEASE
+    PushCallStack("qr::TS");
+#endif
+    ts::TreeData<F> treeData;
+    ts::Reduce( A, treeData );
+    ts::BroadcastR( treeData, R );
+    ts::FormQ( treeData, A );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace qr
+} // namespace elem
+
+#endif // ifndef LAPACK_QR_TS_HPP
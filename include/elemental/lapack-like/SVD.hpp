@@ -11,6 +11,7 @@
 #define LAPACK_SVD_HPP
 
 #include "elemental/lapack-like/SVD/Chan.hpp"
+#include "elemental/lapack-like/SVD/QDWH.hpp"
 #include "elemental/lapack-like/SVD/Thresholded.hpp"
 
 namespace elem {
@@ -83,7 +84,6 @@ inline void HermitianSVD
 #ifndef RELEASE
     PushCallStack("HermitianSVD");
 #endif
-#ifdef HAVE_PMRRR
     typedef typename Base<F>::type R;
 
     // Grab an eigenvalue decomposition of A
@@ -120,11 +120,6 @@ inline void HermitianSVD
             for( int iLocal=0; iLocal<localHeight; ++iLocal )
                 UCol[iLocal] = -VCol[iLocal];
     }
-#else
-    U = A;
-    MakeHermitian( uplo, U );
-    SVD( U, s, V );
-#endif // ifdef HAVE_PMRRR
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -193,7 +188,6 @@ inline void HermitianSVD
 #ifndef RELEASE
     PushCallStack("HermitianSVD");
 #endif
-#ifdef HAVE_PMRRR
     typedef typename Base<F>::type R;
 
     // Grab an eigenvalue decomposition of A
@@ -206,10 +200,6 @@ inline void HermitianSVD
         const R sigma = s.GetLocal(iLocal,0);
         s.SetLocal(iLocal,0,Abs(sigma));
     }
-#else
-    MakeHermitian( uplo, A );
-    SVD( A, s );
-#endif // ifdef HAVE_PMRRR
 #ifndef RELEASE
     PopCallStack();
 #endif
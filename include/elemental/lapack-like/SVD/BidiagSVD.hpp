@@ -0,0 +1,116 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_SVD_BIDIAGSVD_HPP
+#define LAPACK_SVD_BIDIAGSVD_HPP
+
+#include <cmath>
+
+namespace elem {
+namespace svd {
+
+//
+// Compute the SVD of the k x k upper bidiagonal matrix B with diagonal d and
+// superdiagonal e through the eigenvectors of its Golub-Kahan tridiagonal,
+//
+//   T = P [0 B^T; B 0] P^T,
+//
+// whose eigenpair (sigma,[v;u]/sqrt(2)) is interleaved by the perfect
+// shuffle P. The tridiagonal eigensolver (PMRRR or divide and conquer) leaves
+// each eigenvector in full on one process, so that the k x k factors are
+// returned in [* ,VR] distributions without ever being replicated.
+//
+// The half-vectors u and v lose orthogonality as the relative gap between
+// the singular values and zero vanishes, so false is returned (and nothing
+// is computed) when B is ill-conditioned; the caller should then fall back
+// to the bidiagonal QR algorithm.
+//
+template<typename F>
+inline bool
+BidiagSVD
+( const DistMatrix<typename Base<F>::type,STAR,STAR>& d,
+  const DistMatrix<typename Base<F>::type,STAR,STAR>& e,
+  DistMatrix<typename Base<F>::type,VR,STAR>& s,
+  DistMatrix<F,STAR,VR>& U, DistMatrix<F,STAR,VR>& V )
+{
+#ifndef RELEASE
+    PushCallStack("svd::BidiagSVD");
+#endif
+    typedef typename Base<F>::type Real;
+    const Grid& g = d.Grid();
+    const int k = d.Height();
+    if( k == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return false;
+    }
+
+    // The singular values alone only require O(k^2) work
+    std::vector<Real> sigma( k ), eCopy( k, 0 );
+    MemCopy( &sigma[0], d.LockedBuffer(), k );
+    if( k > 1 )
+        MemCopy( &eCopy[0], e.LockedBuffer(), k-1 );
+    lapack::BidiagQRAlg
+    ( 'U', k, 0, 0, &sigma[0], &eCopy[0], (Real*)0, 1, (Real*)0, 1 );
+    const Real sigmaMax = sigma[0];
+    const Real sigmaMin = sigma[k-1];
+    const Real eps = lapack::MachineEpsilon<Real>();
+    if( sigmaMax == Real(0) || sigmaMin <= Sqrt(Sqrt(eps))*sigmaMax )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return false;
+    }
+
+    // Form the Golub-Kahan tridiagonal with its off-diagonal negated so that
+    // its k smallest eigenvalues are the negated singular values, in
+    // descending order of the singular values
+    DistMatrix<Real,STAR,STAR> dGK( 2*k, 1, g ), eGK( 2*k-1, 1, g );
+    for( int i=0; i<k; ++i )
+    {
+        dGK.SetLocal( 2*i, 0, 0 );
+        dGK.SetLocal( 2*i+1, 0, 0 );
+        eGK.SetLocal( 2*i, 0, -d.GetLocal(i,0) );
+        if( i < k-1 )
+            eGK.SetLocal( 2*i+1, 0, -e.GetLocal(i,0) );
+    }
+    DistMatrix<Real,VR,STAR> w( g );
+    DistMatrix<Real,STAR,VR> Z( g );
+    HermitianTridiagEig( dGK, eGK, w, Z, 0, k-1 );
+    s = w;
+    Scale( Real(-1), s );
+
+    // Unshuffle each (locally complete) eigenvector into [v;u]
+    const Real sqrtTwo = Sqrt( Real(2) );
+    U.AlignWith( Z );
+    V.AlignWith( Z );
+    U.ResizeTo( k, k );
+    V.ResizeTo( k, k );
+    const int localWidth = Z.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        for( int i=0; i<k; ++i )
+        {
+            V.SetLocal( i, jLocal, sqrtTwo*Z.GetLocal(2*i,jLocal) );
+            U.SetLocal( i, jLocal, sqrtTwo*Z.GetLocal(2*i+1,jLocal) );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return true;
+}
+
+} // namespace svd
+} // namespace elem
+
+#endif // ifndef LAPACK_SVD_BIDIAGSVD_HPP
@@ -17,6 +17,7 @@
 #include "elemental/lapack-like/QR.hpp"
 
 #include "elemental/lapack-like/SVD/GolubReinsch.hpp"
+#include "elemental/lapack-like/SVD/TallSkinny.hpp"
 
 namespace elem {
 namespace svd {
@@ -39,7 +40,11 @@ ChanUpper
     const Grid& g = A.Grid();
     const int m = A.Height();
     const int n = A.Width();
-    if( m > heightRatio*n )
+    if( m >= GetSVDTallSkinnyRatio()*g.Size()*n )
+    {
+        svd::TallSkinny( A, s, V );
+    }
+    else if( m > heightRatio*n )
     {
         DistMatrix<F> R(g);
         qr::Explicit( A, R );
@@ -77,7 +82,11 @@ ChanUpper
     const Grid& g = A.Grid();
     const int m = A.Height();
     const int n = A.Width();
-    if( m >= heightRatio*n )
+    if( m >= GetSVDTallSkinnyRatio()*g.Size()*n )
+    {
+        svd::TallSkinny( A, s );
+    }
+    else if( m >= heightRatio*n )
     {
         QR( A );
         DistMatrix<Real> AT(g),
@@ -113,7 +122,11 @@ ChanUpper
     const Grid& g = A.Grid();
     const int m = A.Height();
     const int n = A.Width();
-    if( m >= heightRatio*n )
+    if( m >= GetSVDTallSkinnyRatio()*g.Size()*n )
+    {
+        svd::TallSkinny( A, s );
+    }
+    else if( m >= heightRatio*n )
     {
         DistMatrix<C,MD,STAR> t(g);
         QR( A, t );
@@ -161,8 +174,6 @@ Chan
     if( needRescaling )
         Scale( scale, A );
 
-    // TODO: Switch between different algorithms. For instance, starting 
-    //       with a QR decomposition of tall-skinny matrices.
     if( A.Height() >= A.Width() )
     {
         svd::ChanUpper( A, s, V, heightRatio );
@@ -206,8 +217,6 @@ Chan
     if( needRescaling )
         Scale( scale, A );
 
-    // TODO: Switch between different algorithms. For instance, starting 
-    //       with a QR decomposition of tall-skinny matrices.
     if( A.Height() >= A.Width() )
     {
         svd::ChanUpper( A, s, heightRatio );
@@ -17,6 +17,7 @@
 #include "elemental/matrices/Identity.hpp"
 #include "elemental/matrices/Zeros.hpp"
 
+#include "elemental/lapack-like/SVD/BidiagSVD.hpp"
 #include "elemental/lapack-like/SVD/Util.hpp"
 
 namespace elem {
@@ -60,23 +61,34 @@ GolubReinschUpper
     View( e_STAR_STAR, eHat_STAR_STAR, 0, 0, k-1, 1 );
     e_STAR_STAR = e_MD_STAR;
 
-    // Initialize U and VTrans to the appropriate identity matrices.
+    // When possible, compute the SVD of the (upper) bidiagonal matrix with
+    // a distributed tridiagonal eigensolver rather than accumulating the
+    // Givens rotations of the redundant QR algorithm
+    DistMatrix<Real,STAR,VR> UB_STAR_VR( g ), VB_STAR_VR( g );
+    const bool distributed =
+        ( m >= n &&
+          BidiagSVD( d_STAR_STAR, e_STAR_STAR, s, UB_STAR_VR, VB_STAR_VR ) );
+
     DistMatrix<Real,VC,STAR> U_VC_STAR( g );
     DistMatrix<Real,STAR,VC> VTrans_STAR_VC( g );
-    U_VC_STAR.AlignWith( A );
-    VTrans_STAR_VC.AlignWith( V );
-    Identity( m, k, U_VC_STAR );
-    Identity( k, n, VTrans_STAR_VC );
-
-    // Compute the SVD of the bidiagonal matrix and accumulate the Givens
-    // rotations into our local portion of U and VTrans
-    Matrix<Real>& ULocal = U_VC_STAR.Matrix();
-    Matrix<Real>& VTransLocal = VTrans_STAR_VC.Matrix();
-    lapack::BidiagQRAlg
-    ( uplo, k, VTransLocal.Width(), ULocal.Height(),
-      d_STAR_STAR.Buffer(), e_STAR_STAR.Buffer(), 
-      VTransLocal.Buffer(), VTransLocal.LDim(), 
-      ULocal.Buffer(), ULocal.LDim() );
+    if( !distributed )
+    {
+        // Initialize U and VTrans to the appropriate identity matrices.
+        U_VC_STAR.AlignWith( A );
+        VTrans_STAR_VC.AlignWith( V );
+        Identity( m, k, U_VC_STAR );
+        Identity( k, n, VTrans_STAR_VC );
+
+        // Compute the SVD of the bidiagonal matrix and accumulate the Givens
+        // rotations into our local portion of U and VTrans
+        Matrix<Real>& ULocal = U_VC_STAR.Matrix();
+        Matrix<Real>& VTransLocal = VTrans_STAR_VC.Matrix();
+        lapack::BidiagQRAlg
+        ( uplo, k, VTransLocal.Width(), ULocal.Height(),
+          d_STAR_STAR.Buffer(), e_STAR_STAR.Buffer(), 
+          VTransLocal.Buffer(), VTransLocal.LDim(), 
+          ULocal.Buffer(), ULocal.LDim() );
+    }
 
     // Make a copy of A (for the Householder vectors) and pull the necessary 
     // portions of U and VTrans into a standard matrix dist.
@@ -89,11 +101,19 @@ GolubReinschUpper
                                  UB_VC_STAR( g );
         PartitionDown( A, AT,
                           AB, n );
-        PartitionDown( U_VC_STAR, UT_VC_STAR,
-                                  UB_VC_STAR, n );
-        AT = UT_VC_STAR;
+        if( distributed )
+        {
+            AT = UB_STAR_VR;
+            V = VB_STAR_VR;
+        }
+        else
+        {
+            PartitionDown( U_VC_STAR, UT_VC_STAR,
+                                      UB_VC_STAR, n );
+            AT = UT_VC_STAR;
+            Transpose( VTrans_STAR_VC, V );
+        }
         MakeZeros( AB );
-        Transpose( VTrans_STAR_VC, V );
     }
     else
     {
@@ -120,7 +140,8 @@ GolubReinschUpper
     }
 
     // Copy out the appropriate subset of the singular values
-    s = d_STAR_STAR;
+    if( !distributed )
+        s = d_STAR_STAR;
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -161,23 +182,34 @@ GolubReinschUpper
     View( e_STAR_STAR, eHat_STAR_STAR, 0, 0, k-1, 1 );
     e_STAR_STAR = e_MD_STAR;
 
-    // Initialize U and VAdj to the appropriate identity matrices
+    // When possible, compute the SVD of the (upper) bidiagonal matrix with
+    // a distributed tridiagonal eigensolver rather than accumulating the
+    // Givens rotations of the redundant QR algorithm
+    DistMatrix<C,STAR,VR> UB_STAR_VR( g ), VB_STAR_VR( g );
+    const bool distributed =
+        ( m >= n &&
+          BidiagSVD( d_STAR_STAR, e_STAR_STAR, s, UB_STAR_VR, VB_STAR_VR ) );
+
     DistMatrix<C,VC,STAR> U_VC_STAR( g );
     DistMatrix<C,STAR,VC> VAdj_STAR_VC( g );
-    U_VC_STAR.AlignWith( A );
-    VAdj_STAR_VC.AlignWith( V );
-    Identity( m, k, U_VC_STAR );
-    Identity( k, n, VAdj_STAR_VC );
-
-    // Compute the SVD of the bidiagonal matrix and accumulate the Givens
-    // rotations into our local portion of U and VAdj
-    Matrix<C>& ULocal = U_VC_STAR.Matrix();
-    Matrix<C>& VAdjLocal = VAdj_STAR_VC.Matrix();
-    lapack::BidiagQRAlg
-    ( uplo, k, VAdjLocal.Width(), ULocal.Height(),
-      d_STAR_STAR.Buffer(), e_STAR_STAR.Buffer(), 
-      VAdjLocal.Buffer(), VAdjLocal.LDim(), 
-      ULocal.Buffer(), ULocal.LDim() );
+    if( !distributed )
+    {
+        // Initialize U and VAdj to the appropriate identity matrices
+        U_VC_STAR.AlignWith( A );
+        VAdj_STAR_VC.AlignWith( V );
+        Identity( m, k, U_VC_STAR );
+        Identity( k, n, VAdj_STAR_VC );
+
+        // Compute the SVD of the bidiagonal matrix and accumulate the Givens
+        // rotations into our local portion of U and VAdj
+        Matrix<C>& ULocal = U_VC_STAR.Matrix();
+        Matrix<C>& VAdjLocal = VAdj_STAR_VC.Matrix();
+        lapack::BidiagQRAlg
+        ( uplo, k, VAdjLocal.Width(), ULocal.Height(),
+          d_STAR_STAR.Buffer(), e_STAR_STAR.Buffer(), 
+          VAdjLocal.Buffer(), VAdjLocal.LDim(), 
+          ULocal.Buffer(), ULocal.LDim() );
+    }
 
     // Make a copy of A (for the Householder vectors) and pull the necessary 
     // portions of U and VAdj into a standard matrix dist.
@@ -190,11 +222,19 @@ GolubReinschUpper
                               UB_VC_STAR( g );
         PartitionDown( A, AT,
                           AB, n );
-        PartitionDown( U_VC_STAR, UT_VC_STAR,
-                                  UB_VC_STAR, n );
-        AT = UT_VC_STAR;
+        if( distributed )
+        {
+            AT = UB_STAR_VR;
+            V = VB_STAR_VR;
+        }
+        else
+        {
+            PartitionDown( U_VC_STAR, UT_VC_STAR,
+                                      UB_VC_STAR, n );
+            AT = UT_VC_STAR;
+            Adjoint( VAdj_STAR_VC, V );
+        }
         MakeZeros( AB );
-        Adjoint( VAdj_STAR_VC, V );
     }
     else
     {
@@ -225,7 +265,8 @@ GolubReinschUpper
     }
 
     // Copy out the appropriate subset of the singular values
-    s = d_STAR_STAR;
+    if( !distributed )
+        s = d_STAR_STAR;
 #ifndef RELEASE
     PopCallStack();
 #endif
@@ -0,0 +1,165 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_SVD_QDWH_HPP
+#define LAPACK_SVD_QDWH_HPP
+
+#include "elemental/blas-like/level1/Adjoint.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/HermitianEig/SDC.hpp"
+#include "elemental/lapack-like/HermitianEig/Sort.hpp"
+#include "elemental/lapack-like/Norm/TwoUpperBound.hpp"
+#include "elemental/lapack-like/Polar/QDWH.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// The SVD via the polar decomposition, A = Q H, followed by a spectral
+// divide and conquer eigensolver for the Hermitian positive semi-definite
+// factor, H = V Sigma V^H, so that A = (Q V) Sigma V^H. See
+//
+//   Y. Nakatsukasa and N. J. Higham, "Stable and efficient spectral divide
+//   and conquer algorithms for the symmetric eigenvalue decomposition and
+//   the SVD", SIAM J. Sci. Comput., 35(3), 2013.
+//
+
+namespace elem {
+namespace svd {
+
+namespace qdwh {
+
+// Overwrite A with its polar factor and H with the Hermitian factor
+template<typename F>
+inline void
+Polar( DistMatrix<F>& A, DistMatrix<F>& H )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+    const R upperBound = TwoNormUpperBound( A );
+    DistMatrix<F> ACopy( g );
+    ACopy = A;
+    if( upperBound != R(0) )
+        polar::QDWH( A, lapack::MachineEpsilon<R>(), upperBound );
+    Zeros( n, n, H );
+    Gemm( ADJOINT, NORMAL, F(1), A, ACopy, F(0), H );
+    MakeHermitian( LOWER, H );
+}
+
+// Ensure that the (rounded) eigenvalues of H are nonnegative by flipping the
+// signs of the corresponding eigenvectors, then sort in descending order
+template<typename F>
+inline void
+MakeSingularValues( DistMatrix<typename Base<F>::type,VR,STAR>& s,
+                    DistMatrix<F>& V )
+{
+    typedef typename Base<F>::type R;
+    DistMatrix<R,MR,STAR> s_MR_STAR( V.Grid() );
+    s_MR_STAR.AlignWith( V.DistData() );
+    s_MR_STAR = s;
+    const int localHeight = V.LocalHeight();
+    const int localWidth = V.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        if( s_MR_STAR.GetLocal(jLocal,0) < R(0) )
+        {
+            F* VCol = V.Buffer( 0, jLocal );
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+                VCol[iLocal] = -VCol[iLocal];
+        }
+    }
+    for( int iLocal=0; iLocal<s.LocalHeight(); ++iLocal )
+        s.SetLocal( iLocal, 0, Abs(s.GetLocal(iLocal,0)) );
+    hermitian_eig::Sort( s, V, false );
+}
+
+template<typename F>
+inline void
+Tall
+( DistMatrix<F>& A, DistMatrix<typename Base<F>::type,VR,STAR>& s,
+  DistMatrix<F>& V )
+{
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+    DistMatrix<F> H( g );
+    qdwh::Polar( A, H );
+    hermitian_eig::SDC( LOWER, H, s, V );
+    H.Empty();
+    qdwh::MakeSingularValues( s, V );
+
+    // U := Q V
+    DistMatrix<F> U( g );
+    Zeros( m, n, U );
+    Gemm( NORMAL, NORMAL, F(1), A, V, F(0), U );
+    A = U;
+}
+
+} // namespace qdwh
+
+//
+// Overwrite A with U in its thin SVD, A = U diag(s) V^H, with the singular
+// values sorted in descending order
+//
+template<typename F>
+inline void
+QDWH
+( DistMatrix<F>& A, DistMatrix<typename Base<F>::type,VR,STAR>& s,
+  DistMatrix<F>& V )
+{
+#ifndef RELEASE
+    PushCallStack("svd::QDWH");
+#endif
+    if( A.Height() >= A.Width() )
+        qdwh::Tall( A, s, V );
+    else
+    {
+        // A^H = U diag(s) V^H implies A = V diag(s) U^H
+        const Grid& g = A.Grid();
+        DistMatrix<F> AAdj( g );
+        Adjoint( A, AAdj );
+        qdwh::Tall( AAdj, s, V );
+        A = V;
+        V = AAdj;
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+QDWH( DistMatrix<F>& A, DistMatrix<typename Base<F>::type,VR,STAR>& s )
+{
+#ifndef RELEASE
+    PushCallStack("svd::QDWH");
+#endif
+    const Grid& g = A.Grid();
+    DistMatrix<F> H( g );
+    if( A.Height() >= A.Width() )
+        qdwh::Polar( A, H );
+    else
+    {
+        DistMatrix<F> AAdj( g );
+        Adjoint( A, AAdj );
+        qdwh::Polar( AAdj, H );
+    }
+    hermitian_eig::SDC( LOWER, H, s );
+    for( int iLocal=0; iLocal<s.LocalHeight(); ++iLocal )
+        s.SetLocal( iLocal, 0, Abs(s.GetLocal(iLocal,0)) );
+    hermitian_eig::Sort( s, false );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace svd
+} // namespace elem
+
+#endif // ifndef LAPACK_SVD_QDWH_HPP
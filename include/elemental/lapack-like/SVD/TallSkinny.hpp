@@ -0,0 +1,106 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_SVD_TALLSKINNY_HPP
+#define LAPACK_SVD_TALLSKINNY_HPP
+
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/QR.hpp"
+
+#include "elemental/lapack-like/SVD/Util.hpp"
+
+namespace elem {
+namespace svd {
+
+//
+// For matrices with at least as many rows per process as columns, compute a
+// tall-skinny QR factorization, A = Q R, in a [VC,* ] distribution and then
+// redundantly compute the SVD of the n x n factor R = U_R Sigma V^H. Since
+// U = Q U_R, every process can then form its rows of U without communication.
+//
+
+template<typename F>
+inline void
+TallSkinny
+( DistMatrix<F>& A,
+  DistMatrix<typename Base<F>::type,VR,STAR>& s,
+  DistMatrix<F>& V )
+{
+#ifndef RELEASE
+    PushCallStack("svd::TallSkinny");
+#endif
+    typedef typename Base<F>::type Real;
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+
+    DistMatrix<F,VC,STAR> Q_VC_STAR( A );
+    DistMatrix<F,STAR,STAR> R_STAR_STAR( g );
+    qr::TS( Q_VC_STAR, R_STAR_STAR );
+
+    // Overwrite R with U_R
+    DistMatrix<Real,STAR,STAR> s_STAR_STAR( n, 1, g );
+    DistMatrix<F,STAR,STAR> V_STAR_STAR( n, n, g );
+    svd::DivideAndConquerSVD
+    ( R_STAR_STAR.Matrix(), s_STAR_STAR.Matrix(), V_STAR_STAR.Matrix() );
+
+    DistMatrix<F,VC,STAR> U_VC_STAR( g );
+    U_VC_STAR.AlignWith( Q_VC_STAR );
+    U_VC_STAR.ResizeTo( m, n );
+    Gemm
+    ( NORMAL, NORMAL,
+      F(1), Q_VC_STAR.LockedMatrix(), R_STAR_STAR.LockedMatrix(),
+      F(0), U_VC_STAR.Matrix() );
+    Q_VC_STAR.Empty();
+
+    A = U_VC_STAR;
+    V = V_STAR_STAR;
+    s = s_STAR_STAR;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+inline void
+TallSkinny
+( DistMatrix<F>& A,
+  DistMatrix<typename Base<F>::type,VR,STAR>& s )
+{
+#ifndef RELEASE
+    PushCallStack("svd::TallSkinny");
+#endif
+    typedef typename Base<F>::type Real;
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+
+    qr::ts::TreeData<F> treeData;
+    {
+        DistMatrix<F,VC,STAR> A_VC_STAR( A );
+        qr::ts::Reduce( A_VC_STAR, treeData );
+    }
+
+    // Only the root holds R, so compute the singular values there
+    DistMatrix<Real,STAR,STAR> s_STAR_STAR( n, 1, g );
+    if( g.VCRank() == 0 && n > 0 )
+        lapack::SVD
+        ( n, n, treeData.R.Buffer(), treeData.R.LDim(),
+          s_STAR_STAR.Buffer() );
+    if( n > 0 )
+        mpi::Broadcast( s_STAR_STAR.Buffer(), n, 0, g.VCComm() );
+    s = s_STAR_STAR;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace svd
+} // namespace elem
+
+#endif // ifndef LAPACK_SVD_TALLSKINNY_HPP
@@ -18,8 +18,6 @@
 namespace elem {
 namespace svd {
 
-#ifdef HAVE_PMRRR
-
 template<typename F>
 inline void
 ThresholdedTall
@@ -182,8 +180,6 @@ Thresholded
 #endif
 }
 
-#endif // ifdef HAVE_PMRRR
-
 } // namespace svd
 } // namespace elem
 
@@ -0,0 +1,128 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_SIGN_HPP
+#define LAPACK_SIGN_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/lapack-like/Inverse.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/Norm/One.hpp"
+
+//
+// The matrix sign function of a matrix A with no purely imaginary
+// eigenvalues, computed with the scaled Newton iteration
+//
+//     X_{k+1} = (mu_k X_k + (mu_k X_k)^{-1}) / 2,  X_0 = A,
+//
+// with the Frobenius-norm scaling mu_k = sqrt(||X_k^{-1}||_F / ||X_k||_F),
+// which is turned off once the iteration enters the region of quadratic
+// convergence. See Chapter 5 of
+//
+//   N. J. Higham, "Functions of Matrices: Theory and Computation",
+//   SIAM, 2008.
+//
+
+namespace elem {
+
+template<typename F>
+inline int
+Sign( Matrix<F>& A, int maxIts=100 )
+{
+#ifndef RELEASE
+    PushCallStack("Sign");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    typedef typename Base<F>::type R;
+    const int n = A.Height();
+    const R epsilon = lapack::MachineEpsilon<R>();
+    const R sqrtTol = Sqrt( n*epsilon );
+    const R scalingTol = R(1)/R(100);
+
+    int numIts=0;
+    R relDiff = 1;
+    Matrix<F> XInv, XLast;
+    do
+    {
+        if( numIts >= maxIts )
+            throw std::runtime_error("Sign iteration did not converge");
+        ++numIts;
+        XLast = A;
+        XInv = A;
+        Inverse( XInv );
+
+        R mu = 1;
+        if( relDiff > scalingTol )
+            mu = Sqrt( FrobeniusNorm(XInv)/FrobeniusNorm(A) );
+
+        // X := (mu X + X^{-1}/mu) / 2
+        Scale( mu/2, A );
+        Axpy( 1/(2*mu), XInv, A );
+
+        Axpy( F(-1), A, XLast );
+        relDiff = OneNorm( XLast ) / OneNorm( A );
+    }
+    while( relDiff > sqrtTol );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return numIts;
+}
+
+template<typename F>
+inline int
+Sign( DistMatrix<F>& A, int maxIts=100 )
+{
+#ifndef RELEASE
+    PushCallStack("Sign");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const R epsilon = lapack::MachineEpsilon<R>();
+    const R sqrtTol = Sqrt( n*epsilon );
+    const R scalingTol = R(1)/R(100);
+
+    int numIts=0;
+    R relDiff = 1;
+    DistMatrix<F> XInv( g ), XLast( g );
+    do
+    {
+        if( numIts >= maxIts )
+            throw std::runtime_error("Sign iteration did not converge");
+        ++numIts;
+        XLast = A;
+        XInv = A;
+        Inverse( XInv );
+
+        R mu = 1;
+        if( relDiff > scalingTol )
+            mu = Sqrt( FrobeniusNorm(XInv)/FrobeniusNorm(A) );
+
+        // X := (mu X + X^{-1}/mu) / 2
+        Scale( mu/2, A );
+        Axpy( 1/(2*mu), XInv, A );
+
+        Axpy( F(-1), A, XLast );
+        relDiff = OneNorm( XLast ) / OneNorm( A );
+    }
+    while( relDiff > sqrtTol );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return numIts;
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_SIGN_HPP
@@ -10,8 +10,6 @@
 #ifndef LAPACK_SKEWHERMITIANEIG_HPP
 #define LAPACK_SKEWHERMITIANEIG_HPP
 
-#ifdef HAVE_PMRRR
-
 #include "elemental/blas-like/level1/ScaleTrapezoid.hpp"
 
 namespace elem {
@@ -454,6 +452,4 @@ SkewHermitianEig
 
 } // namespace elem
 
-#endif // ifdef HAVE_PMRRR
-
 #endif // ifndef LAPACK_SKEWHERMITIANEIG_HPP
@@ -0,0 +1,132 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_SQUAREROOT_HPP
+#define LAPACK_SQUAREROOT_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Inverse.hpp"
+#include "elemental/lapack-like/Norm/One.hpp"
+#include "elemental/matrices/Identity.hpp"
+
+//
+// The principal square root of a matrix A with no eigenvalues on the closed
+// negative real axis, computed with the product form of the Denman-Beavers
+// iteration,
+//
+//     M_{k+1} = (I + (M_k + M_k^{-1})/2) / 2,   M_0 = A,
+//     Y_{k+1} = Y_k (I + M_k^{-1}) / 2,         Y_0 = A,
+//
+// so that M_k -> I and Y_k -> A^{1/2}, which requires one inversion and one
+// matrix-matrix multiplication per step. See Section 6.3 of
+//
+//   N. J. Higham, "Functions of Matrices: Theory and Computation",
+//   SIAM, 2008.
+//
+
+namespace elem {
+
+template<typename F>
+inline int
+SquareRoot( Matrix<F>& A, int maxIts=100 )
+{
+#ifndef RELEASE
+    PushCallStack("SquareRoot");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    typedef typename Base<F>::type R;
+    const int n = A.Height();
+    const R epsilon = lapack::MachineEpsilon<R>();
+    const R sqrtTol = Sqrt( n*epsilon );
+
+    int numIts=0;
+    R relDiff;
+    Matrix<F> M, MInv, YLast, I;
+    M = A;
+    Identity( n, n, I );
+    do
+    {
+        if( numIts >= maxIts )
+            throw std::runtime_error("Square root did not converge");
+        ++numIts;
+        MInv = M;
+        Inverse( MInv );
+
+        // Y := Y (I + M^{-1}) / 2
+        YLast = A;
+        Gemm( NORMAL, NORMAL, F(R(1)/R(2)), YLast, MInv, F(R(1)/R(2)), A );
+
+        // M := (2 I + M + M^{-1}) / 4
+        Axpy( F(1), MInv, M );
+        Scale( R(1)/R(4), M );
+        Axpy( R(1)/R(2), I, M );
+
+        Axpy( F(-1), A, YLast );
+        relDiff = OneNorm( YLast ) / OneNorm( A );
+    }
+    while( relDiff > sqrtTol );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return numIts;
+}
+
+template<typename F>
+inline int
+SquareRoot( DistMatrix<F>& A, int maxIts=100 )
+{
+#ifndef RELEASE
+    PushCallStack("SquareRoot");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const R epsilon = lapack::MachineEpsilon<R>();
+    const R sqrtTol = Sqrt( n*epsilon );
+
+    int numIts=0;
+    R relDiff;
+    DistMatrix<F> M( g ), MInv( g ), YLast( g ), I( g );
+    M = A;
+    Identity( n, n, I );
+    do
+    {
+        if( numIts >= maxIts )
+            throw std::runtime_error("Square root did not converge");
+        ++numIts;
+        MInv = M;
+        Inverse( MInv );
+
+        // Y := Y (I + M^{-1}) / 2
+        YLast = A;
+        Gemm( NORMAL, NORMAL, F(R(1)/R(2)), YLast, MInv, F(R(1)/R(2)), A );
+
+        // M := (2 I + M + M^{-1}) / 4
+        Axpy( F(1), MInv, M );
+        Scale( R(1)/R(4), M );
+        Axpy( R(1)/R(2), I, M );
+
+        Axpy( F(-1), A, YLast );
+        relDiff = OneNorm( YLast ) / OneNorm( A );
+    }
+    while( relDiff > sqrtTol );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return numIts;
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_SQUAREROOT_HPP
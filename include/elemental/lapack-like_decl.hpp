@@ -24,6 +24,67 @@ void HermitianTridiag
 ( UpperOrLower uplo, 
   DistMatrix<Complex<R> >& A, DistMatrix<Complex<R>,STAR,STAR>& t );
 
+// The second stage of the two-stage reduction to tridiagonal form chases 
+// bulges out of a [* ,* ] copy of the band. Rather than keeping all O(n^2) of
+// the resulting reflectors on every process, a copy of the band is
+// checkpointed every few sweeps so that the reflectors can be regenerated, 
+// in reverse order, during the backtransformation.
+template<typename F>
+struct HermitianTridiagBulges
+{
+    int height, bandwidth;
+    std::vector<int> sweepOffsets;
+    std::vector<F> checkpoints;
+};
+
+template<typename F>
+void HermitianTridiagTwoStage
+( UpperOrLower uplo, 
+  DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t,
+  DistMatrix<typename Base<F>::type,STAR,STAR>& d,
+  DistMatrix<typename Base<F>::type,STAR,STAR>& e,
+  HermitianTridiagBulges<F>& bulges );
+// Z := Q2 Z, where Z is the local portion of a [* ,VR] matrix (or any 
+// matrix whose columns are complete) and Q2 is from the bulge-chasing stage
+template<typename F>
+void ApplyHermitianTridiagBulges
+( const HermitianTridiagBulges<F>& bulges, Matrix<F>& Z );
+// Z := Q1 Z, where Q1 is from the reduction to banded form
+template<typename F>
+void ApplyHermitianTridiagBand
+( const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& t,
+  const HermitianTridiagBulges<F>& bulges, DistMatrix<F>& Z );
+
+// Eigenpairs of the real symmetric tridiagonal matrix with diagonal d and 
+// subdiagonal e via a distributed divide-and-conquer algorithm. The
+// eigenvalues are returned in ascending order.
+template<typename R>
+void HermitianTridiagEig
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  DistMatrix<R,VR,STAR>& w, DistMatrix<R,STAR,VR>& Z );
+template<typename R>
+void HermitianTridiagEig
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  DistMatrix<R,VR,STAR>& w, DistMatrix<R,STAR,VR>& Z,
+  int lowerBound, int upperBound );
+template<typename R>
+void HermitianTridiagEig
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  DistMatrix<R,VR,STAR>& w, DistMatrix<R,STAR,VR>& Z,
+  R lowerBound, R upperBound );
+template<typename R>
+void HermitianTridiagEig
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  DistMatrix<R,VR,STAR>& w );
+template<typename R>
+void HermitianTridiagEig
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  DistMatrix<R,VR,STAR>& w, int lowerBound, int upperBound );
+template<typename R>
+void HermitianTridiagEig
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  DistMatrix<R,VR,STAR>& w, R lowerBound, R upperBound );
+
 void HermitianEig
 ( UpperOrLower uplo, DistMatrix<double>& A, 
   DistMatrix<double,VR,STAR>& w, DistMatrix<double>& paddedZ );
@@ -118,6 +179,7 @@ enum HermitianTridiagApproach
 {
     HERMITIAN_TRIDIAG_NORMAL, // Keep the current grid
     HERMITIAN_TRIDIAG_SQUARE, // Drop to a square process grid
+    HERMITIAN_TRIDIAG_TWO_STAGE, // Reduce to banded form, then chase bulges
     HERMITIAN_TRIDIAG_DEFAULT // Square grid algorithm only if already square
 };
 }
@@ -132,6 +194,51 @@ HermitianTridiagApproach GetHermitianTridiagApproach();
 void SetHermitianTridiagGridOrder( GridOrder order );
 GridOrder GetHermitianTridiagGridOrder();
 
+// The bandwidth of the intermediate banded matrix in the two-stage approach.
+// Larger values make the first stage more efficient at the expense of the
+// (replicated) bulge-chasing stage.
+void SetHermitianTridiagBandwidth( int bandwidth );
+int GetHermitianTridiagBandwidth();
+
+namespace hermitian_tridiag_eig_approach_wrapper {
+enum HermitianTridiagEigApproach
+{
+    HERMITIAN_TRIDIAG_EIG_PMRRR, // Requires Elemental to be built with PMRRR
+    HERMITIAN_TRIDIAG_EIG_DIVIDE_AND_CONQUER,
+    HERMITIAN_TRIDIAG_EIG_DEFAULT // PMRRR if available, else divide and conquer
+};
+}
+using namespace hermitian_tridiag_eig_approach_wrapper;
+
+// The solver used by HermitianEig for the tridiagonal eigenvalue problem. 
+// If PMRRR was not built, divide and conquer is always used.
+void SetHermitianTridiagEigApproach( HermitianTridiagEigApproach approach );
+HermitianTridiagEigApproach GetHermitianTridiagEigApproach();
+
+namespace hermitian_eig_approach_wrapper {
+enum HermitianEigApproach
+{
+    HERMITIAN_EIG_TRIDIAG, // reduction to tridiagonal form
+    HERMITIAN_EIG_SDC      // QDWH-based spectral divide and conquer
+};
+}
+using namespace hermitian_eig_approach_wrapper;
+
+// The algorithm used by HermitianEig when computing the full spectrum. 
+// Spectral divide and conquer recursively splits the spectrum until the 
+// subproblems are assigned to a single process or are at most 'cutoff' in 
+// dimension, and then falls back to tridiagonalization.
+void SetHermitianEigApproach( HermitianEigApproach approach );
+HermitianEigApproach GetHermitianEigApproach();
+void SetHermitianEigSDCCutoff( int cutoff );
+int GetHermitianEigSDCCutoff();
+
+// Matrices which are at least 'ratio' p times as tall as they are wide, where
+// p is the number of processes, have their SVDs computed via a tall-skinny QR
+// factorization followed by a redundant SVD of the triangular factor.
+void SetSVDTallSkinnyRatio( double ratio );
+double GetSVDTallSkinnyRatio();
+
 } // namespace elem
 
 #endif // ifndef LAPACK_DECL_HPP
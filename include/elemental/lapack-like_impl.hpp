@@ -13,11 +13,13 @@
 #include "./lapack-like/ApplyPackedReflectors.hpp"
 #include "./lapack-like/ApplyColumnPivots.hpp"
 #include "./lapack-like/ApplyRowPivots.hpp"
+#include "./lapack-like/Batched.hpp"
 #include "./lapack-like/Bidiag.hpp"
 #include "./lapack-like/Cholesky.hpp"
 #include "./lapack-like/ComposePivots.hpp"
 #include "./lapack-like/ConditionNumber.hpp"
 #include "./lapack-like/Determinant.hpp"
+#include "./lapack-like/Exp.hpp"
 #include "./lapack-like/ExpandPackedReflectors.hpp"
 #include "./lapack-like/GaussianElimination.hpp"
 #include "./lapack-like/HermitianEig.hpp"
@@ -31,15 +33,20 @@
 #include "./lapack-like/Inverse.hpp"
 #include "./lapack-like/LDL.hpp"
 #include "./lapack-like/LeastSquares.hpp"
+#include "./lapack-like/LowRank.hpp"
 #include "./lapack-like/LQ.hpp"
 #include "./lapack-like/LU.hpp"
+#include "./lapack-like/MixedPrecision.hpp"
 #include "./lapack-like/Norm.hpp"
+#include "./lapack-like/OutOfCore.hpp"
 #include "./lapack-like/PivotParity.hpp"
 #include "./lapack-like/Polar.hpp"
 #include "./lapack-like/Pseudoinverse.hpp"
 #include "./lapack-like/QR.hpp"
 #include "./lapack-like/Reflector.hpp"
+#include "./lapack-like/Sign.hpp"
 #include "./lapack-like/SkewHermitianEig.hpp"
+#include "./lapack-like/SquareRoot.hpp"
 #include "./lapack-like/SVD.hpp"
 #include "./lapack-like/Trace.hpp"
 #include "./lapack-like/TriangularInverse.hpp"
@@ -137,10 +137,9 @@ MakeHermitianUniformSpectrum
     // Form d and D
     const int n = A.Height();
     std::vector<F> d( n );
-    if( grid.Rank() == 0 )
-        for( int j=0; j<n; ++j )
-            d[j] = lower + (upper-lower)*Uniform();
-    mpi::Broadcast( &d[0], n, 0, grid.Comm() );
+    const unsigned stream = NewRandomStream( grid );
+    for( int j=0; j<n; ++j )
+        d[j] = lower + (upper-lower)*Uniform( stream, j, 0 );
     DistMatrix<F> ABackup( grid );
     if( standardDist )
         Diagonal( d, A );
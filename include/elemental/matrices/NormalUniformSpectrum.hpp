@@ -132,10 +132,9 @@ MakeNormalUniformSpectrum
     // Form d and D
     const int n = A.Height();
     std::vector<C> d( n );
-    if( grid.Rank() == 0 )
-        for( int j=0; j<n; ++j )
-            d[j] = center + radius*SampleUnitBall<C>();
-    mpi::Broadcast( &d[0], n, 0, grid.Comm() );
+    const unsigned stream = NewRandomStream( grid );
+    for( int j=0; j<n; ++j )
+        d[j] = center + radius*SampleUnitBall<C>( stream, j, 0 );
     DistMatrix<C> ABackup( grid );
     if( standardDist )
         Diagonal( d, A );
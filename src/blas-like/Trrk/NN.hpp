@@ -42,6 +42,7 @@ void TrrkNN
     A1_MC_STAR.AlignWith( C );
     B1Trans_MR_STAR.AlignWith( C );
 
+    ScaleTrapezoid( beta, LEFT, uplo, 0, C );
     LockedPartitionRight( A, AL, AR, 0 );
     LockedPartitionDown
     ( B, BT,
@@ -61,7 +62,7 @@ void TrrkNN
         A1_MC_STAR = A1;
         B1Trans_MR_STAR.TransposeFrom( B1 );
         LocalTrrk
-        ( uplo, TRANSPOSE, alpha, A1_MC_STAR, B1Trans_MR_STAR, beta, C );
+        ( uplo, TRANSPOSE, alpha, A1_MC_STAR, B1Trans_MR_STAR, T(1), C );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionDown
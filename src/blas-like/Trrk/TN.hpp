@@ -46,6 +46,7 @@ void TrrkTN
     A1_STAR_MC.AlignWith( C );
     B1Trans_MR_STAR.AlignWith( C );
 
+    ScaleTrapezoid( beta, LEFT, uplo, 0, C );
     LockedPartitionDown
     ( A, AT,
          AB, 0 );
@@ -70,7 +71,7 @@ void TrrkTN
         B1Trans_MR_STAR.TransposeFrom( B1 );
         LocalTrrk
         ( uplo, orientationOfA, TRANSPOSE, 
-          alpha, A1_STAR_MC, B1Trans_MR_STAR, beta, C );
+          alpha, A1_STAR_MC, B1Trans_MR_STAR, T(1), C );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionDown
@@ -22,12 +22,12 @@ void TrrkTT
   T beta,        DistMatrix<T>& C )
 {
 #ifndef RELEASE
-    PushCallStack("internal::TrrkTN");
+    PushCallStack("internal::TrrkTT");
     if( C.Height() != C.Width() ||
         A.Width() != C.Height() || 
         B.Height() != C.Width() ||
         A.Height() != B.Width() )
-        throw std::logic_error("Nonconformal TrrkTN");
+        throw std::logic_error("Nonconformal TrrkTT");
     if( orientationOfA == NORMAL || orientationOfB == NORMAL )
         throw std::logic_error("Orientations must be TRANSPOSE or ADJOINT");
 #endif
@@ -47,11 +47,12 @@ void TrrkTT
     B1_VR_STAR.AlignWith( C );
     B1AdjOrTrans_STAR_MR.AlignWith( C );
 
+    ScaleTrapezoid( beta, LEFT, uplo, 0, C );
     LockedPartitionDown
     ( A, AT,
          AB, 0 );
     LockedPartitionRight( B, BL, BR, 0 );
-    while( AT.Width() < A.Height() )
+    while( AT.Height() < A.Height() )
     {
         LockedRepartitionDown
         ( AT,  A0,
@@ -71,7 +72,7 @@ void TrrkTT
             B1AdjOrTrans_STAR_MR.TransposeFrom( B1_VR_STAR );
         LocalTrrk
         ( uplo, orientationOfA,
-          alpha, A1_STAR_MC, B1AdjOrTrans_STAR_MR, beta, C );
+          alpha, A1_STAR_MC, B1AdjOrTrans_STAR_MR, T(1), C );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionRight
@@ -0,0 +1,343 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+#include <cstdio>
+#include <sys/stat.h>
+#include <sys/types.h>
+#ifdef WIN32
+# include <direct.h>
+#endif
+
+namespace elem {
+
+Checkpoint::Checkpoint( const std::string directory, const Grid& grid )
+: directory_(directory), comm_(grid.ViewingComm()), epoch_(-1),
+  begun_(false), ended_(false)
+{
+#ifndef RELEASE
+    PushCallStack("Checkpoint::Checkpoint");
+#endif
+    ReadManifest();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Closing the shards and committing are collective, so they are left to an
+// explicit call to Wait. A pending checkpoint is discarded (the previous one
+// remains valid) after finishing the local writes.
+Checkpoint::~Checkpoint()
+{
+    if( begun_ || !pending_.empty() )
+    {
+        if( !std::uncaught_exception() )
+        {
+            std::ostringstream os;
+            os << mpi::CommRank( comm_ )
+               << ": Checkpoint destroyed without a call to Wait; the "
+                  "checkpoint being written was discarded" << std::endl;
+            std::cerr << os.str();
+        }
+        for( std::size_t k=0; k<pending_.size(); ++k )
+        {
+            ShardWrite* shard = pending_[k];
+            if( shard->writing )
+                mpi::Wait( shard->request );
+            mpi::TypeFree( shard->fileType );
+            mpi::TypeFree( shard->elemType );
+            delete shard;
+        }
+    }
+}
+
+std::string
+Checkpoint::ManifestName() const
+{ return directory_ + "/checkpoint.txt"; }
+
+std::string
+Checkpoint::ShardName( const std::string name, int epoch ) const
+{
+    std::ostringstream os;
+    os << directory_ << "/" << name << "." << epoch << ".bin";
+    return os.str();
+}
+
+void
+Checkpoint::Begin()
+{
+#ifndef RELEASE
+    PushCallStack("Checkpoint::Begin");
+#endif
+    Wait();
+    int created = 1;
+    if( mpi::CommRank( comm_ ) == 0 )
+    {
+#ifdef WIN32
+        _mkdir( directory_.c_str() );
+#else
+        mkdir( directory_.c_str(), 0755 );
+#endif
+        struct stat info;
+        if( stat( directory_.c_str(), &info ) != 0 || 
+            !(info.st_mode & S_IFDIR) )
+            created = 0;
+    }
+    mpi::Broadcast( &created, 1, 0, comm_ );
+    if( !created )
+        throw std::runtime_error
+        ("Could not create checkpoint directory "+directory_);
+    begun_ = true;
+    ended_ = false;
+    newNames_.clear();
+    newScalars_.clear();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void
+Checkpoint::Save( const std::string name, const AutoDistMatrix<int>& A )
+{
+#ifndef RELEASE
+    PushCallStack("Checkpoint::Save");
+    if( !begun_ || ended_ )
+        throw std::logic_error("Save must be called between Begin and End");
+    if( name.empty() || name.find_first_of(" \t\n/") != std::string::npos )
+        throw std::logic_error("Checkpoint names cannot contain whitespace");
+#endif
+    ShardWrite* shard = new ShardWrite;
+    shard->writing = internal::OpenBinaryForWrite
+        ( A, ShardName(name,epoch_+1), shard->fh,
+          shard->elemType, shard->fileType );
+    if( shard->writing )
+    {
+        // Copy the local entries so that A may be modified during the write
+        const int localHeight = A.LocalHeight();
+        const int localWidth = A.LocalWidth();
+        const std::size_t colSize = localHeight*A.DataSize();
+        const std::size_t ldimSize = A.LDim()*A.DataSize();
+        const byte* ABuffer = static_cast<const byte*>(A.LockedBuffer());
+        shard->buffer.resize( colSize*localWidth );
+        for( int jLocal=0; jLocal<localWidth; ++jLocal )
+            MemCopy
+            ( &shard->buffer[jLocal*colSize], &ABuffer[jLocal*ldimSize],
+              colSize );
+        mpi::FileIWrite
+        ( shard->fh, &shard->buffer[0], localHeight*localWidth,
+          shard->elemType, shard->request );
+    }
+    pending_.push_back( shard );
+    newNames_.push_back( name );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void
+Checkpoint::SetScalar( const std::string name, double value )
+{
+#ifndef RELEASE
+    PushCallStack("Checkpoint::SetScalar");
+    if( !begun_ || ended_ )
+        throw std::logic_error
+        ("SetScalar must be called between Begin and End");
+    if( name.empty() || name.find_first_of(" \t\n") != std::string::npos )
+        throw std::logic_error("Checkpoint names cannot contain whitespace");
+#endif
+    newScalars_.push_back( std::pair<std::string,double>(name,value) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void
+Checkpoint::End()
+{
+#ifndef RELEASE
+    PushCallStack("Checkpoint::End");
+    if( !begun_ || ended_ )
+        throw std::logic_error("End must follow Begin");
+#endif
+    ended_ = true;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+bool
+Checkpoint::Pending() const
+{ return begun_; }
+
+void
+Checkpoint::Wait()
+{
+#ifndef RELEASE
+    PushCallStack("Checkpoint::Wait");
+#endif
+    for( std::size_t k=0; k<pending_.size(); ++k )
+    {
+        ShardWrite* shard = pending_[k];
+        if( shard->writing )
+            mpi::Wait( shard->request );
+        mpi::FileClose( shard->fh );
+        mpi::TypeFree( shard->fileType );
+        mpi::TypeFree( shard->elemType );
+        delete shard;
+    }
+    pending_.clear();
+    const bool commit = ended_;
+    begun_ = ended_ = false;
+    if( commit )
+        Commit();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Atomically replace the manifest and then remove the previous shards. Only 
+// the root touches the manifest, so it broadcasts whether it succeeded in 
+// order for every process to throw together.
+void
+Checkpoint::Commit()
+{
+    const int newEpoch = epoch_+1;
+    mpi::Barrier( comm_ );
+    int committed = 1;
+    if( mpi::CommRank( comm_ ) == 0 )
+    {
+        const std::string tmpName = ManifestName() + ".tmp";
+        std::ofstream file( tmpName.c_str() );
+        file.precision( 17 );
+        file << "ELEMCKPT 1\n" << "epoch " << newEpoch << "\n";
+        for( std::size_t k=0; k<newNames_.size(); ++k )
+            file << "matrix " << newNames_[k] << "\n";
+        for( std::size_t k=0; k<newScalars_.size(); ++k )
+            file << "scalar " << newScalars_[k].first << " "
+                 << newScalars_[k].second << "\n";
+        file.close();
+        if( !file || std::rename( tmpName.c_str(), ManifestName().c_str() ) )
+        {
+            committed = 0;
+            for( std::size_t k=0; k<newNames_.size(); ++k )
+                std::remove( ShardName(newNames_[k],newEpoch).c_str() );
+        }
+        else
+            for( std::size_t k=0; k<names_.size(); ++k )
+                std::remove( ShardName(names_[k],epoch_).c_str() );
+    }
+    mpi::Broadcast( &committed, 1, 0, comm_ );
+    if( !committed )
+        throw std::runtime_error("Could not write checkpoint manifest");
+    epoch_ = newEpoch;
+    names_ = newNames_;
+    scalars_ = newScalars_;
+    mpi::Barrier( comm_ );
+}
+
+// The root reads the manifest, if it exists, and broadcasts its contents
+void
+Checkpoint::ReadManifest()
+{
+    std::string contents;
+    int size = 0;
+    if( mpi::CommRank( comm_ ) == 0 )
+    {
+        std::ifstream file( ManifestName().c_str() );
+        if( file.is_open() )
+        {
+            std::ostringstream os;
+            os << file.rdbuf();
+            contents = os.str();
+            size = contents.size();
+        }
+    }
+    mpi::Broadcast( &size, 1, 0, comm_ );
+    if( size == 0 )
+        return;
+    std::vector<byte> buffer( size );
+    if( mpi::CommRank( comm_ ) == 0 )
+        MemCopy( &buffer[0], (const byte*)contents.data(), size );
+    mpi::Broadcast( &buffer[0], size, 0, comm_ );
+    contents.assign( (const char*)&buffer[0], size );
+
+    std::istringstream is( contents );
+    std::string magic, key, name;
+    int version;
+    is >> magic >> version;
+    if( magic != "ELEMCKPT" || version != 1 )
+        throw std::runtime_error("Invalid checkpoint manifest");
+    while( is >> key )
+    {
+        if( key == "epoch" )
+            is >> epoch_;
+        else if( key == "matrix" )
+        {
+            is >> name;
+            names_.push_back( name );
+        }
+        else if( key == "scalar" )
+        {
+            double value;
+            is >> name >> value;
+            scalars_.push_back( std::pair<std::string,double>(name,value) );
+        }
+        else
+            throw std::runtime_error("Invalid checkpoint manifest");
+    }
+}
+
+bool
+Checkpoint::Exists() const
+{ return epoch_ >= 0; }
+
+int
+Checkpoint::Epoch() const
+{ return epoch_; }
+
+bool
+Checkpoint::Contains( const std::string name ) const
+{
+    for( std::size_t k=0; k<names_.size(); ++k )
+        if( names_[k] == name )
+            return true;
+    for( std::size_t k=0; k<scalars_.size(); ++k )
+        if( scalars_[k].first == name )
+            return true;
+    return false;
+}
+
+void
+Checkpoint::Load( const std::string name, AutoDistMatrix<int>& A ) const
+{
+#ifndef RELEASE
+    PushCallStack("Checkpoint::Load");
+#endif
+    bool found = false;
+    for( std::size_t k=0; k<names_.size(); ++k )
+        if( names_[k] == name )
+            found = true;
+    if( !found )
+        throw std::logic_error("Matrix "+name+" is not in the checkpoint");
+    A.ReadBinary( ShardName(name,epoch_) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+double
+Checkpoint::Scalar( const std::string name ) const
+{
+    for( std::size_t k=0; k<scalars_.size(); ++k )
+        if( scalars_[k].first == name )
+            return scalars_[k].second;
+    throw std::logic_error("Scalar "+name+" is not in the checkpoint");
+    return 0;
+}
+
+} // namespace elem
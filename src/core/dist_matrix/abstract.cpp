@@ -148,6 +148,236 @@ AbstractDistMatrix<T,Int>::CopyFrom_( const Parent& AA )
 	}
 }
 
+namespace {
+
+template<typename R>
+inline bool IsNaN( R alpha )
+{ return alpha != alpha; }
+
+template<typename R>
+inline bool IsInf( R alpha )
+{ return alpha == alpha && alpha-alpha != alpha-alpha; }
+
+// The number of entries of A which are gathered to the root at once
+const int printPanelSize = 1<<20;
+
+} // anonymous namespace
+
+template<typename T,typename Int>
+void
+AbstractDistMatrix<T,Int>::PrintBase
+( std::ostream& os, const std::string msg ) const
+{
+#ifndef RELEASE
+    PushCallStack("AbstractDistMatrix::PrintBase");
+#endif
+    const elem::Grid& g = this->Grid();
+    if( g.Rank() == 0 && msg != "" )
+        os << msg << std::endl;
+
+    const Int height = this->Height();
+    const Int width  = this->Width();
+    if( height == 0 || width == 0 || !g.InGrid() )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    // Gather the shifts and local widths of the processes which send
+    mpi::Comm comm = g.VCComm();
+    const int commSize = g.Size();
+    const bool root = ( g.VCRank() == 0 );
+    const bool sending = this->ReplicaRoot();
+    const Int colStride = this->ColStride();
+    const Int rowStride = this->RowStride();
+    const Int colShift = ( sending ? this->ColShift() : 0 );
+    const Int localWidth = ( sending ? this->LocalWidth() : 0 );
+    int layout[3] = { colShift, this->RowShift(), localWidth };
+    std::vector<int> layouts( root ? 3*commSize : 3 );
+    mpi::Gather( layout, 3, &layouts[0], 3, 0, comm );
+
+    // Print the matrix in panels of rows so that only a panel of the matrix
+    // is ever stored on the root
+    const Int panelHeight = std::max( Int(1), Int(printPanelSize/width) );
+    const T* thisBuffer = this->LockedBuffer();
+    const Int thisLDim = this->LDim();
+    // The receive buffers are only significant on the root, but are given at
+    // least one entry everywhere so that their addresses may be taken
+    std::vector<T> sendBuf, recvBuf( 1 ), panel;
+    std::vector<int> recvCounts( root ? commSize : 1 ),
+                     recvDispls( root ? commSize : 1 );
+    for( Int i=0; i<height; i+=panelHeight )
+    {
+        const Int b = std::min( panelHeight, height-i );
+
+        // Pack our local rows of the panel
+        const Int iLocalBeg = Length( i, colShift, colStride );
+        const Int panelLocalHeight = 
+            Length( i+b, colShift, colStride ) - iLocalBeg;
+        sendBuf.resize( std::max(panelLocalHeight*localWidth,Int(1)) );
+        for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+            MemCopy
+            ( &sendBuf[jLocal*panelLocalHeight],
+              &thisBuffer[iLocalBeg+jLocal*thisLDim], panelLocalHeight );
+
+        int totalRecv = 0;
+        if( root )
+        {
+            for( int q=0; q<commSize; ++q )
+            {
+                const int* qLayout = &layouts[3*q];
+                const Int qPanelHeight = 
+                    Length( i+b, Int(qLayout[0]), colStride ) - 
+                    Length( i,   Int(qLayout[0]), colStride );
+                recvCounts[q] = qPanelHeight*qLayout[2];
+                recvDispls[q] = totalRecv;
+                totalRecv += recvCounts[q];
+            }
+            recvBuf.resize( std::max(totalRecv,1) );
+        }
+        mpi::Gather
+        ( &sendBuf[0], panelLocalHeight*localWidth,
+          &recvBuf[0], &recvCounts[0], &recvDispls[0], 0, comm );
+
+        if( root )
+        {
+            // Unpack the contributions into the panel and print it
+            panel.resize( b*width );
+            for( int q=0; q<commSize; ++q )
+            {
+                const int* qLayout = &layouts[3*q];
+                const Int qColShift = qLayout[0];
+                const Int qRowShift = qLayout[1];
+                const Int qLocalWidth = qLayout[2];
+                const Int qLocalBeg = Length( i, qColShift, colStride );
+                const Int qPanelHeight = 
+                    Length( i+b, qColShift, colStride ) - qLocalBeg;
+                const T* data = &recvBuf[0] + recvDispls[q];
+                for( Int jLocal=0; jLocal<qLocalWidth; ++jLocal )
+                {
+                    const Int j = qRowShift + jLocal*rowStride;
+                    for( Int iLocal=0; iLocal<qPanelHeight; ++iLocal )
+                    {
+                        const Int iPanel = 
+                            qColShift + (qLocalBeg+iLocal)*colStride - i;
+                        panel[iPanel+j*b] = data[iLocal+jLocal*qPanelHeight];
+                    }
+                }
+            }
+            for( Int iPanel=0; iPanel<b; ++iPanel )
+            {
+                for( Int j=0; j<width; ++j )
+                    os << panel[iPanel+j*b] << " ";
+                os << "\n";
+            }
+        }
+    }
+    if( root )
+        os << std::endl;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+void
+AbstractDistMatrix<T,Int>::PrintSummaryBase
+( std::ostream& os, const std::string msg ) const
+{
+#ifndef RELEASE
+    PushCallStack("AbstractDistMatrix::PrintSummaryBase");
+#endif
+    const elem::Grid& g = this->Grid();
+    if( g.Rank() == 0 && msg != "" )
+        os << msg << std::endl;
+
+    const Int height = this->Height();
+    const Int width  = this->Width();
+    if( !g.InGrid() )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    // Accumulate the statistics of the entries owned by the replica roots
+    // (the sum of squares, the NaN count, and the infinity count) 
+    double sums[3] = { 0, 0, 0 };
+    double maxAbs = 0;
+    T corners[4] = { T(0), T(0), T(0), T(0) };
+    if( this->ReplicaRoot() )
+    {
+        const Int localHeight = this->LocalHeight();
+        const Int localWidth = this->LocalWidth();
+        for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+        {
+            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
+            {
+                const T alpha = this->GetLocal( iLocal, jLocal );
+                const RT alphaReal = RealPart(alpha);
+                const RT alphaImag = ImagPart(alpha);
+                if( IsNaN(alphaReal) || IsNaN(alphaImag) )
+                    sums[1] += 1;
+                else if( IsInf(alphaReal) || IsInf(alphaImag) )
+                    sums[2] += 1;
+                else
+                {
+                    const double alphaAbs = Abs(alpha);
+                    sums[0] += alphaAbs*alphaAbs;
+                    maxAbs = std::max( maxAbs, alphaAbs );
+                }
+            }
+        }
+
+        // Each corner is owned by exactly one replica root
+        if( height > 0 && width > 0 )
+        {
+            const Int colShift = this->ColShift();
+            const Int rowShift = this->RowShift();
+            const Int colStride = this->ColStride();
+            const Int rowStride = this->RowStride();
+            const Int is[2] = { 0, height-1 };
+            const Int js[2] = { 0, width-1 };
+            for( Int k=0; k<4; ++k )
+            {
+                const Int i = is[k%2];
+                const Int j = js[k/2];
+                if( (i-colShift) % colStride == 0 && i >= colShift &&
+                    (j-rowShift) % rowStride == 0 && j >= rowShift )
+                    corners[k] = this->GetLocal
+                    ( (i-colShift)/colStride, (j-rowShift)/rowStride );
+            }
+        }
+    }
+    mpi::Comm comm = g.VCComm();
+    mpi::Reduce( sums, 3, mpi::SUM, 0, comm );
+    mpi::Reduce( &maxAbs, 1, mpi::MAX, 0, comm );
+    mpi::Reduce( corners, 4, mpi::SUM, 0, comm );
+
+    if( g.VCRank() == 0 )
+    {
+        this->PrintShort( os );
+        os << "\n"
+           << "  ||A||_F = " << std::sqrt(sums[0]) 
+           << ", max |A(i,j)| = " << maxAbs 
+           << ", NaN count = " << Int(sums[1]) 
+           << ", Inf count = " << Int(sums[2]) << "\n";
+        if( height > 0 && width > 0 )
+            os << "  A(0,0) = " << corners[0] 
+               << ", A(" << height-1 << ",0) = " << corners[1] 
+               << ", A(0," << width-1 << ") = " << corners[2] 
+               << ", A(" << height-1 << "," << width-1 << ") = " 
+               << corners[3] << "\n";
+        os << std::endl;
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 #undef TEMPLATE_INST
 #define TEMPLATE_INST(T,Int) \
 	template class AbstractDistMatrix<T,Int>; \
@@ -156,6 +156,170 @@ ADM::Print
 	PopCallStack();
 }
 
+template<typename Int>
+void
+ADM::PrintSummary( const std::string msg ) const
+{ 
+	PushCallStack("DistMatrix::PrintSummary");
+	PrintSummaryBase( std::cout, msg ); 
+	PopCallStack();
+}
+
+template<typename Int>
+void
+ADM::PrintSummary
+( std::ostream& os, const std::string msg ) const
+{ 
+	PushCallStack("DistMatrix::PrintSummary");
+	PrintSummaryBase( os, msg ); 
+	PopCallStack();
+}
+
+template<typename Int>
+bool
+ADM::ReplicaRoot() const
+{
+    if( !Participating() )
+        return false;
+    const elem::Grid& g = Grid();
+    switch( Dist2D() )
+    {
+    case MC_STAR: 
+    case STAR_MC:   return g.Col() == 0;
+    case MR_STAR:
+    case STAR_MR:   return g.Row() == 0;
+    case STAR_STAR: return g.VCRank() == 0;
+    default:        return true;
+    }
+}
+
+template<typename Int>
+void
+ADM::GetBlock
+( Int i, Int j, Int height, Int width, void* buffer, Int ldim ) const
+{
+    PushCallStack("DistMatrix::GetBlock");
+    if( i < 0 || j < 0 || height < 0 || width < 0 || 
+        i+height > Height() || j+width > Width() )
+        throw std::logic_error("Block is out of bounds");
+    if( ldim < std::max(height,Int(1)) )
+        throw std::logic_error("Leading dimension of the block is too small");
+    const elem::Grid& g = Grid();
+    if( !g.InGrid() )
+    {
+        PopCallStack();
+        return;
+    }
+    mpi::Comm comm = g.VCComm();
+    const int commSize = g.Size();
+    const std::size_t dataSize = DataSize();
+    const Int colStride = ColStride();
+    const Int rowStride = RowStride();
+
+    // Pack the entries of the block owned by one replica of each local matrix
+    const bool sending = ReplicaRoot();
+    const Int colShift = ColShift();
+    const Int rowShift = RowShift();
+    const Int iLocalBeg = Length( i, colShift, colStride );
+    const Int jLocalBeg = Length( j, rowShift, rowStride );
+    const Int blockLocalHeight = 
+        ( sending ? Length( i+height, colShift, colStride )-iLocalBeg : 0 );
+    const Int blockLocalWidth = 
+        ( sending ? Length( j+width, rowShift, rowStride )-jLocalBeg : 0 );
+    const std::size_t colSize = blockLocalHeight*dataSize;
+    std::vector<byte> sendBuf( std::max(colSize*blockLocalWidth,std::size_t(1)) );
+    const byte* ABuffer = static_cast<const byte*>(LockedBuffer());
+    const std::size_t ldimSize = LDim()*dataSize;
+    for( Int jLocal=0; jLocal<blockLocalWidth; ++jLocal )
+        MemCopy
+        ( &sendBuf[jLocal*colSize], 
+          &ABuffer[iLocalBeg*dataSize+(jLocalBeg+jLocal)*ldimSize], colSize );
+
+    // Exchange the layouts and then the entries
+    int layout[4] = { colShift, rowShift, blockLocalHeight, blockLocalWidth };
+    std::vector<int> layouts( 4*commSize );
+    mpi::AllGather( layout, 4, &layouts[0], 4, comm );
+    std::vector<int> recvCounts( commSize ), recvDispls( commSize );
+    int totalRecv = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        recvCounts[q] = layouts[4*q+2]*layouts[4*q+3]*dataSize;
+        recvDispls[q] = totalRecv;
+        totalRecv += recvCounts[q];
+    }
+    std::vector<byte> recvBuf( std::max(totalRecv,1) );
+    mpi::AllGather
+    ( &sendBuf[0], colSize*blockLocalWidth, 
+      &recvBuf[0], &recvCounts[0], &recvDispls[0], comm );
+
+    // Unpack the entries into the column-major buffer
+    byte* block = static_cast<byte*>(buffer);
+    for( int q=0; q<commSize; ++q )
+    {
+        const Int qColShift = layouts[4*q];
+        const Int qRowShift = layouts[4*q+1];
+        const Int qHeight = layouts[4*q+2];
+        const Int qWidth = layouts[4*q+3];
+        const Int iFirst = 
+            qColShift + Length( i, qColShift, colStride )*colStride - i;
+        const Int jFirst = 
+            qRowShift + Length( j, qRowShift, rowStride )*rowStride - j;
+        const byte* data = &recvBuf[0] + recvDispls[q];
+        for( Int jLocal=0; jLocal<qWidth; ++jLocal )
+        {
+            byte* blockCol = &block[(jFirst+jLocal*rowStride)*ldim*dataSize];
+            for( Int iLocal=0; iLocal<qHeight; ++iLocal )
+                MemCopy
+                ( &blockCol[(iFirst+iLocal*colStride)*dataSize], 
+                  &data[(iLocal+jLocal*qHeight)*dataSize], dataSize );
+        }
+    }
+    PopCallStack();
+}
+
+template<typename Int>
+void
+ADM::SetBlock
+( Int i, Int j, Int height, Int width, const void* buffer, Int ldim )
+{
+    PushCallStack("DistMatrix::SetBlock");
+    AssertNotLocked();
+    if( i < 0 || j < 0 || height < 0 || width < 0 || 
+        i+height > Height() || j+width > Width() )
+        throw std::logic_error("Block is out of bounds");
+    if( ldim < std::max(height,Int(1)) )
+        throw std::logic_error("Leading dimension of the block is too small");
+    if( Participating() )
+    {
+        const std::size_t dataSize = DataSize();
+        const Int colShift = ColShift();
+        const Int rowShift = RowShift();
+        const Int colStride = ColStride();
+        const Int rowStride = RowStride();
+        const Int iLocalBeg = Length( i, colShift, colStride );
+        const Int iLocalEnd = Length( i+height, colShift, colStride );
+        const Int jLocalBeg = Length( j, rowShift, rowStride );
+        const Int jLocalEnd = Length( j+width, rowShift, rowStride );
+        const byte* block = static_cast<const byte*>(buffer);
+        byte* ABuffer = static_cast<byte*>(Buffer());
+        const std::size_t ldimSize = LDim()*dataSize;
+        for( Int jLocal=jLocalBeg; jLocal<jLocalEnd; ++jLocal )
+        {
+            const Int jBlock = rowShift + jLocal*rowStride - j;
+            const byte* blockCol = &block[jBlock*ldim*dataSize];
+            byte* ACol = &ABuffer[jLocal*ldimSize];
+            for( Int iLocal=iLocalBeg; iLocal<iLocalEnd; ++iLocal )
+            {
+                const Int iBlock = colShift + iLocal*colStride - i;
+                MemCopy
+                ( &ACol[iLocal*dataSize], &blockCol[iBlock*dataSize], 
+                  dataSize );
+            }
+        }
+    }
+    PopCallStack();
+}
+
 template<typename Int>
 void
 ADM::Write
@@ -179,6 +343,268 @@ ADM::Write
     PopCallStack();
 }
 
+namespace {
+
+const mpi::Offset fileHeaderSize = 64;
+
+// Build the file type which selects the local entries of A from the 
+// column-major global matrix of height fileHeight, where A is the submatrix
+// whose top-left entry is (i,j), and return the displacement of the first 
+// one. Processes without local entries simply use the element type.
+template<typename Int>
+mpi::Offset
+LocalFileType
+( const AutoDistMatrix<Int>& A, Int fileHeight, Int i, Int j,
+  mpi::Datatype elemType, mpi::Datatype& fileType )
+{
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const mpi::Offset dataSize = A.DataSize();
+    if( !A.Participating() || localHeight == 0 || localWidth == 0 )
+    {
+        mpi::TypeContiguous( 1, elemType, fileType );
+        mpi::TypeCommit( fileType );
+        return fileHeaderSize;
+    }
+    mpi::Datatype colType;
+    mpi::TypeVector( localHeight, 1, A.ColStride(), elemType, colType );
+    mpi::TypeHVector
+    ( localWidth, 1, mpi::Offset(A.RowStride())*fileHeight*dataSize, 
+      colType, fileType );
+    mpi::TypeCommit( fileType );
+    mpi::TypeFree( colType );
+    return fileHeaderSize + 
+           (i+A.ColShift()+mpi::Offset(j+A.RowShift())*fileHeight)*dataSize;
+}
+
+// Only the first process storing each set of replicated entries writes them
+template<typename Int>
+bool
+ReplicaWriter( const AutoDistMatrix<Int>& A )
+{
+    const bool participating = A.Participating();
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::Comm replicaComm;
+    const int color = 
+        ( participating ? A.ColRank()+A.RowRank()*A.ColStride() 
+                        : mpi::UNDEFINED );
+    mpi::CommSplit( comm, color, mpi::CommRank(comm), replicaComm );
+    const bool writer = 
+        participating && mpi::CommRank( replicaComm ) == 0;
+    if( participating )
+        mpi::CommFree( replicaComm );
+    return writer;
+}
+
+// Read and check the header of a binary matrix file. Every process reads the
+// same header, so on a mismatch they all (collectively) close the file before
+// throwing.
+template<typename Int>
+void
+ReadFileHeader
+( const AutoDistMatrix<Int>& A, mpi::File& fh, DistMatrixFileHeader& header )
+{
+    mpi::FileReadAt( fh, 0, &header, sizeof(header), mpi::BYTE );
+    if( std::strncmp( header.magic, "ELEMMAT", 8 ) != 0 || 
+        header.version != 1 )
+    {
+        mpi::FileClose( fh );
+        throw std::runtime_error("Not an Elemental binary matrix file");
+    }
+    if( header.dataType != A.DataType() || 
+        header.dataSize != Int(A.DataSize()) )
+    {
+        mpi::FileClose( fh );
+        throw std::logic_error("File datatype does not match the matrix");
+    }
+}
+
+} // anonymous namespace
+
+namespace internal {
+
+template<typename Int>
+bool
+OpenBinaryForWrite
+( const AutoDistMatrix<Int>& A, const std::string filename, 
+  mpi::File& fh, mpi::Datatype& elemType, mpi::Datatype& fileType )
+{
+    mpi::Comm comm = A.Grid().ViewingComm();
+    const Int dataSize = A.DataSize();
+    const bool writer = ReplicaWriter( A );
+
+    mpi::FileOpen( comm, filename, mpi::MODE_CREATE | mpi::MODE_WRONLY, fh );
+    mpi::FileSetSize
+    ( fh, fileHeaderSize + mpi::Offset(A.Height())*A.Width()*dataSize );
+    if( mpi::CommRank( comm ) == 0 )
+    {
+        DistMatrixFileHeader header;
+        MemZero( (char*)&header, sizeof(header) );
+        std::strcpy( header.magic, "ELEMMAT" );
+        header.version = 1;
+        header.dataType = A.DataType();
+        header.dataSize = dataSize;
+        header.colDist = A.ColDist();
+        header.rowDist = A.RowDist();
+        header.height = A.Height();
+        header.width = A.Width();
+        mpi::FileWriteAt( fh, 0, &header, sizeof(header), mpi::BYTE );
+    }
+
+    mpi::TypeContiguous( dataSize, mpi::BYTE, elemType );
+    mpi::TypeCommit( elemType );
+    const mpi::Offset displacement = 
+        LocalFileType( A, A.Height(), Int(0), Int(0), elemType, fileType );
+    mpi::FileSetView( fh, displacement, elemType, fileType );
+    return writer && A.LocalHeight() > 0 && A.LocalWidth() > 0;
+}
+
+template<typename Int>
+bool
+OpenBinaryForRead
+( AutoDistMatrix<Int>& A, const std::string filename, 
+  mpi::File& fh, mpi::Datatype& elemType, mpi::Datatype& fileType )
+{
+    A.AssertNotLocked();
+    mpi::Comm comm = A.Grid().ViewingComm();
+
+    mpi::FileOpen( comm, filename, mpi::MODE_RDONLY, fh );
+    DistMatrixFileHeader header;
+    ReadFileHeader( A, fh, header );
+    A.ResizeTo( header.height, header.width );
+
+    mpi::TypeContiguous( A.DataSize(), mpi::BYTE, elemType );
+    mpi::TypeCommit( elemType );
+    const mpi::Offset displacement = 
+        LocalFileType( A, A.Height(), Int(0), Int(0), elemType, fileType );
+    mpi::FileSetView( fh, displacement, elemType, fileType );
+    return A.Participating() && A.LocalHeight() > 0 && A.LocalWidth() > 0;
+}
+
+template<typename Int>
+void
+OpenBinaryBlocks
+( const AutoDistMatrix<Int>& A, const std::string filename, 
+  mpi::File& fh, Int& height, Int& width )
+{
+    mpi::FileOpen( A.Grid().ViewingComm(), filename, mpi::MODE_RDWR, fh );
+    DistMatrixFileHeader header;
+    ReadFileHeader( A, fh, header );
+    height = header.height;
+    width = header.width;
+}
+
+template<typename Int>
+void
+IReadBinaryBlock
+( AutoDistMatrix<Int>& A, mpi::File fh, Int fileHeight, Int i, Int j,
+  mpi::Request& request )
+{
+    mpi::Datatype elemType, fileType, memType;
+    mpi::TypeContiguous( A.DataSize(), mpi::BYTE, elemType );
+    mpi::TypeCommit( elemType );
+    const mpi::Offset displacement = 
+        LocalFileType( A, fileHeight, i, j, elemType, fileType );
+    mpi::FileSetView( fh, displacement, elemType, fileType );
+    if( A.Participating() && A.LocalHeight() > 0 && A.LocalWidth() > 0 )
+    {
+        mpi::TypeVector
+        ( A.LocalWidth(), A.LocalHeight(), A.LDim(), elemType, memType );
+        mpi::TypeCommit( memType );
+        mpi::FileIRead( fh, A.Buffer(), 1, memType, request );
+        mpi::TypeFree( memType );
+    }
+    else
+        request = mpi::REQUEST_NULL;
+    // Freeing the datatypes does not affect the pending read
+    mpi::TypeFree( fileType );
+    mpi::TypeFree( elemType );
+}
+
+template<typename Int>
+void
+ReadBinaryBlock
+( AutoDistMatrix<Int>& A, mpi::File fh, Int fileHeight, Int i, Int j )
+{
+    mpi::Request request;
+    IReadBinaryBlock( A, fh, fileHeight, i, j, request );
+    mpi::Wait( request );
+}
+
+template<typename Int>
+void
+WriteBinaryBlock
+( const AutoDistMatrix<Int>& A, mpi::File fh, Int fileHeight, Int i, Int j )
+{
+    const bool writer = ReplicaWriter( A );
+    mpi::Datatype elemType, fileType, memType;
+    mpi::TypeContiguous( A.DataSize(), mpi::BYTE, elemType );
+    mpi::TypeCommit( elemType );
+    const mpi::Offset displacement = 
+        LocalFileType( A, fileHeight, i, j, elemType, fileType );
+    mpi::FileSetView( fh, displacement, elemType, fileType );
+    if( writer && A.LocalHeight() > 0 && A.LocalWidth() > 0 )
+    {
+        mpi::TypeVector
+        ( A.LocalWidth(), A.LocalHeight(), A.LDim(), elemType, memType );
+        mpi::TypeCommit( memType );
+        mpi::FileWriteAll( fh, A.LockedBuffer(), 1, memType );
+        mpi::TypeFree( memType );
+    }
+    else
+        mpi::FileWriteAll( fh, 0, 0, elemType );
+    mpi::TypeFree( fileType );
+    mpi::TypeFree( elemType );
+}
+
+} // namespace internal
+
+template<typename Int>
+void
+ADM::WriteBinary( const std::string filename ) const
+{
+    PushCallStack("DistMatrix::WriteBinary");
+    mpi::File fh;
+    mpi::Datatype elemType, fileType, memType;
+    if( internal::OpenBinaryForWrite( *this, filename, fh, elemType, fileType ) )
+    {
+        mpi::TypeVector
+        ( LocalWidth(), LocalHeight(), LDim(), elemType, memType );
+        mpi::TypeCommit( memType );
+        mpi::FileWriteAll( fh, LockedBuffer(), 1, memType );
+        mpi::TypeFree( memType );
+    }
+    else
+        mpi::FileWriteAll( fh, 0, 0, elemType );
+    mpi::TypeFree( fileType );
+    mpi::TypeFree( elemType );
+    mpi::FileClose( fh );
+    PopCallStack();
+}
+
+template<typename Int>
+void
+ADM::ReadBinary( const std::string filename )
+{
+    PushCallStack("DistMatrix::ReadBinary");
+    mpi::File fh;
+    mpi::Datatype elemType, fileType, memType;
+    if( internal::OpenBinaryForRead( *this, filename, fh, elemType, fileType ) )
+    {
+        mpi::TypeVector
+        ( LocalWidth(), LocalHeight(), LDim(), elemType, memType );
+        mpi::TypeCommit( memType );
+        mpi::FileReadAll( fh, Buffer(), 1, memType );
+        mpi::TypeFree( memType );
+    }
+    else
+        mpi::FileReadAll( fh, 0, 0, elemType );
+    mpi::TypeFree( fileType );
+    mpi::TypeFree( elemType );
+    mpi::FileClose( fh );
+    PopCallStack();
+}
+
 template <typename Int>
 Int ADM::DiagPath() const
 { return 0; }
@@ -556,6 +982,22 @@ bool ADM::AlignedWithDiagonal( const Self& A, Int offset ) const
 
 template class DistData<int>;
 template class AutoDistMatrix<int>;
+template bool internal::OpenBinaryForWrite
+( const AutoDistMatrix<int>& A, const std::string filename, 
+  mpi::File& fh, mpi::Datatype& elemType, mpi::Datatype& fileType );
+template bool internal::OpenBinaryForRead
+( AutoDistMatrix<int>& A, const std::string filename, 
+  mpi::File& fh, mpi::Datatype& elemType, mpi::Datatype& fileType );
+template void internal::OpenBinaryBlocks
+( const AutoDistMatrix<int>& A, const std::string filename, 
+  mpi::File& fh, int& height, int& width );
+template void internal::IReadBinaryBlock
+( AutoDistMatrix<int>& A, mpi::File fh, int fileHeight, int i, int j,
+  mpi::Request& request );
+template void internal::ReadBinaryBlock
+( AutoDistMatrix<int>& A, mpi::File fh, int fileHeight, int i, int j );
+template void internal::WriteBinaryBlock
+( const AutoDistMatrix<int>& A, mpi::File fh, int fileHeight, int i, int j );
 template class AbstractDistMatrix<int,int>& AutoDistMatrix<int>::Cast<int>();
 #ifndef DISABLE_FLOAT
 template class AbstractDistMatrix<float,int>& AutoDistMatrix<int>::Cast<float>();
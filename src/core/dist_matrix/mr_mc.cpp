@@ -309,77 +309,6 @@ void
 DistMatrix<T,MR,MC,Int>::AlignRowsWith( const AutoDistMatrix<Int>& A )
 { this->AlignRowsWith( A.DistData() ); }
 
-template<typename T,typename Int>
-void
-DistMatrix<T,MR,MC,Int>::PrintBase
-( std::ostream& os, const std::string msg ) const
-{
-#ifndef RELEASE
-    PushCallStack("[MR,MC]::PrintBase");
-#endif
-    const elem::Grid& g = this->Grid();
-    if( g.Rank() == 0 && msg != "" )
-        os << msg << std::endl;
-
-    const Int height = this->Height();
-    const Int width = this->Width();
-    const Int localHeight = this->LocalHeight();
-    const Int localWidth = this->LocalWidth();
-    const Int r = g.Height();
-    const Int c = g.Width();
-    const Int colShift = this->ColShift();
-    const Int rowShift = this->RowShift();
-
-    if( height == 0 || width == 0 || !g.InGrid() )
-    {
-#ifndef RELEASE
-        PopCallStack();
-#endif
-        return;
-    }
-
-    // Fill the send buffer: zero it then place our entries into their
-    // appropriate locations
-    std::vector<T> sendBuf(height*width,0);
-    const T* thisBuffer = this->LockedBuffer();
-    const Int thisLDim = this->LDim();
-#ifdef HAVE_OPENMP
-    #pragma omp parallel for
-#endif
-    for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-    {
-        T* destCol = &sendBuf[colShift+(rowShift+jLocal*r)*height];
-        const T* sourceCol = &thisBuffer[jLocal*thisLDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal*c] = sourceCol[iLocal];
-    }
-
-    // If we are the root, allocate a receive buffer
-    std::vector<T> recvBuf;
-    if( g.Rank() == 0 )
-        recvBuf.resize( height*width );
-
-    // Sum the contributions and send to the root
-    mpi::Reduce
-    ( &sendBuf[0], &recvBuf[0], height*width, mpi::SUM, 0, g.Comm() );
-
-    if( g.Rank() == 0 )
-    {
-        // Print the data
-        for( Int i=0; i<height; ++i )
-        {
-            for( Int j=0; j<width; ++j )
-                os << recvBuf[i+j*height] << " ";
-            os << "\n";
-        }
-        os << std::endl;
-    }
-    mpi::Barrier( g.Comm() );
-#ifndef RELEASE
-    PopCallStack();
-#endif
-}
-
 template<typename T,typename Int>
 void
 DistMatrix<T,MR,MC,Int>::Attach
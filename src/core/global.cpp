@@ -16,6 +16,8 @@ bool elemInitializedMpi;
 std::stack<int> blocksizeStack;
 elem::Grid* defaultGrid = 0;
 elem::MpiArgs* args = 0;
+unsigned randomSeed = 0;
+unsigned randomStream = 0;
 
 // Debugging
 #ifndef RELEASE
@@ -42,6 +44,11 @@ int localTrrkComplexDoubleBlocksize = 64;
 using namespace elem;
 HermitianTridiagApproach tridiagApproach = HERMITIAN_TRIDIAG_DEFAULT;
 GridOrder gridOrder = ROW_MAJOR;
+int tridiagBandwidth = 32;
+HermitianTridiagEigApproach tridiagEigApproach = HERMITIAN_TRIDIAG_EIG_DEFAULT;
+double svdTallSkinnyRatio = 2.;
+HermitianEigApproach eigApproach = HERMITIAN_EIG_TRIDIAG;
+int sdcCutoff = 256;
 }
 
 namespace elem {
@@ -120,6 +127,11 @@ void Initialize( int& argc, char**& argv )
 #else
     srand48( seed );
 #endif
+
+    // The counter-based generator must be keyed identically on every process
+    int counterSeed = secs;
+    mpi::Broadcast( &counterSeed, 1, 0, mpi::COMM_WORLD );
+    SetRandomSeed( unsigned(counterSeed) );
 }
 
 void Finalize()
@@ -173,6 +185,26 @@ MpiArgs& GetArgs()
     return *::args; 
 }
 
+void SetRandomSeed( unsigned seed )
+{
+    ::randomSeed = seed;
+    ::randomStream = 0;
+}
+
+unsigned RandomSeed()
+{ return ::randomSeed; }
+
+unsigned NewRandomStream( const Grid& g )
+{
+    // Processes outside of the grid do not sample from the stream, so they
+    // are free to skip the synchronization
+    int stream = ::randomStream;
+    if( g.InGrid() )
+        mpi::AllReduce( &stream, 1, mpi::MAX, g.Comm() );
+    ::randomStream = stream+1;
+    return stream;
+}
+
 int Blocksize()
 { return ::blocksizeStack.top(); }
 
@@ -338,4 +370,42 @@ void SetHermitianTridiagGridOrder( GridOrder order )
 GridOrder GetHermitianTridiagGridOrder()
 { return ::gridOrder; }
 
+void SetHermitianTridiagBandwidth( int bandwidth )
+{ ::tridiagBandwidth = bandwidth; }
+
+int GetHermitianTridiagBandwidth()
+{ return ::tridiagBandwidth; }
+
+void SetHermitianTridiagEigApproach( HermitianTridiagEigApproach approach )
+{ ::tridiagEigApproach = approach; }
+
+HermitianTridiagEigApproach GetHermitianTridiagEigApproach()
+{ return ::tridiagEigApproach; }
+
+void SetHermitianEigApproach( HermitianEigApproach approach )
+{ ::eigApproach = approach; }
+
+HermitianEigApproach GetHermitianEigApproach()
+{ return ::eigApproach; }
+
+void SetHermitianEigSDCCutoff( int cutoff )
+{
+    if( cutoff < 1 )
+        throw std::logic_error("SDC cutoff must be positive");
+    ::sdcCutoff = cutoff;
+}
+
+int GetHermitianEigSDCCutoff()
+{ return ::sdcCutoff; }
+
+void SetSVDTallSkinnyRatio( double ratio )
+{
+    if( ratio < 1. )
+        throw std::logic_error("Tall-skinny SVD ratio must be at least one");
+    ::svdTallSkinnyRatio = ratio;
+}
+
+double GetSVDTallSkinnyRatio()
+{ return ::svdTallSkinnyRatio; }
+
 } // namespace elem
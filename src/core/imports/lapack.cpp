@@ -125,6 +125,22 @@ void LAPACK(zhseqr)
   elem::dcomplex* w, elem::dcomplex* Z, const int* ldz,
   elem::dcomplex* work, const int* lwork, int* info );
 
+// Symmetric tridiagonal QR algorithm
+void LAPACK(ssteqr)
+( const char* compz, const int* n, float* d, float* e, float* Z, 
+  const int* ldz, float* work, int* info );
+void LAPACK(dsteqr)
+( const char* compz, const int* n, double* d, double* e, double* Z, 
+  const int* ldz, double* work, int* info );
+
+// Secular equation roots for divide and conquer
+void LAPACK(slaed4)
+( const int* n, const int* i, const float* d, const float* z, float* delta,
+  const float* rho, float* lambda, int* info );
+void LAPACK(dlaed4)
+( const int* n, const int* i, const double* d, const double* z, 
+  double* delta, const double* rho, double* lambda, int* info );
+
 } // extern "C"
 
 namespace elem {
@@ -1164,5 +1180,135 @@ void HessenbergEig( int n, dcomplex* H, int ldh, dcomplex* w )
 #endif
 }
 
+//
+// Symmetric tridiagonal QR algorithm
+//
+
+void TridiagQRAlg( int n, float* d, float* e, float* Z, int ldz )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::TridiagQRAlg");
+#endif
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    int info;
+    const char compz = ( Z==0 ? 'N' : 'I' );
+    const int fakeLDim = 1;
+    std::vector<float> work( Z==0 ? 1 : std::max(1,2*n-2) );
+    LAPACK(ssteqr)
+    ( &compz, &n, d, e, Z, ( Z==0 ? &fakeLDim : &ldz ), &work[0], &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+    {
+        std::ostringstream msg;
+        msg << "ssteqr had " << info << " elements of e not converge";
+        throw std::runtime_error( msg.str().c_str() );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void TridiagQRAlg( int n, double* d, double* e, double* Z, int ldz )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::TridiagQRAlg");
+#endif
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    int info;
+    const char compz = ( Z==0 ? 'N' : 'I' );
+    const int fakeLDim = 1;
+    std::vector<double> work( Z==0 ? 1 : std::max(1,2*n-2) );
+    LAPACK(dsteqr)
+    ( &compz, &n, d, e, Z, ( Z==0 ? &fakeLDim : &ldz ), &work[0], &info );
+    if( info < 0 )
+    {
+        std::ostringstream msg;
+        msg << "Argument " << -info << " had illegal value";
+        throw std::logic_error( msg.str().c_str() );
+    }
+    else if( info > 0 )
+    {
+        std::ostringstream msg;
+        msg << "dsteqr had " << info << " elements of e not converge";
+        throw std::runtime_error( msg.str().c_str() );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// Roots of the secular equation
+//
+
+float SecularEigenvalue
+( int n, int i, const float* d, const float* z, float rho, float* delta )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::SecularEigenvalue");
+    if( i < 0 || i >= n )
+        throw std::logic_error("Invalid root index");
+#endif
+    int info;
+    float lambda;
+    const int fortranIndex = i+1;
+    LAPACK(slaed4)
+    ( &n, &fortranIndex, d, z, delta, &rho, &lambda, &info );
+    if( info != 0 )
+    {
+        std::ostringstream msg;
+        msg << "slaed4 failed with info=" << info;
+        throw std::runtime_error( msg.str().c_str() );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return lambda;
+}
+
+double SecularEigenvalue
+( int n, int i, const double* d, const double* z, double rho, double* delta )
+{
+#ifndef RELEASE
+    PushCallStack("lapack::SecularEigenvalue");
+    if( i < 0 || i >= n )
+        throw std::logic_error("Invalid root index");
+#endif
+    int info;
+    double lambda;
+    const int fortranIndex = i+1;
+    LAPACK(dlaed4)
+    ( &n, &fortranIndex, d, z, delta, &rho, &lambda, &info );
+    if( info != 0 )
+    {
+        std::ostringstream msg;
+        msg << "dlaed4 failed with info=" << info;
+        throw std::runtime_error( msg.str().c_str() );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+    return lambda;
+}
+
 } // namespace lapack
 } // namespace elem
@@ -358,6 +358,201 @@ void GroupTranslateRanks
 #endif
 }
 
+void TypeContiguous( int count, Datatype oldType, Datatype& newType )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::TypeContiguous");
+#endif
+    SafeMpi( MPI_Type_contiguous( count, oldType, &newType ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void TypeVector
+( int count, int blocklength, int stride, Datatype oldType, 
+  Datatype& newType )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::TypeVector");
+#endif
+    SafeMpi( MPI_Type_vector( count, blocklength, stride, oldType, &newType ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void TypeHVector
+( int count, int blocklength, Offset stride, Datatype oldType, 
+  Datatype& newType )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::TypeHVector");
+#endif
+    SafeMpi( MPI_Type_create_hvector
+      ( count, blocklength, MPI_Aint(stride), oldType, &newType ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void TypeCommit( Datatype& type )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::TypeCommit");
+#endif
+    SafeMpi( MPI_Type_commit( &type ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void TypeFree( Datatype& type )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::TypeFree");
+#endif
+    SafeMpi( MPI_Type_free( &type ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileOpen( Comm comm, const std::string filename, int mode, File& fh )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileOpen");
+#endif
+    SafeMpi
+    ( MPI_File_open
+      ( comm, const_cast<char*>(filename.c_str()), mode, MPI_INFO_NULL, 
+        &fh ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileClose( File& fh )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileClose");
+#endif
+    SafeMpi( MPI_File_close( &fh ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileSetSize( File fh, Offset size )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileSetSize");
+#endif
+    SafeMpi( MPI_File_set_size( fh, size ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+// Flush the writes through fh; the usual sync-barrier-sync sequence makes
+// them visible to reads through other file handles
+void FileSync( File fh )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileSync");
+#endif
+    SafeMpi( MPI_File_sync( fh ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileSetView
+( File fh, Offset displacement, Datatype elemType, Datatype fileType )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileSetView");
+#endif
+    SafeMpi( MPI_File_set_view
+      ( fh, displacement, elemType, fileType, const_cast<char*>("native"), 
+        MPI_INFO_NULL ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileReadAt( File fh, Offset offset, void* buf, int count, Datatype type )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileReadAt");
+#endif
+    SafeMpi( MPI_File_read_at
+      ( fh, offset, buf, count, type, MPI_STATUS_IGNORE ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileWriteAt
+( File fh, Offset offset, const void* buf, int count, Datatype type )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileWriteAt");
+#endif
+    SafeMpi( MPI_File_write_at
+      ( fh, offset, const_cast<void*>(buf), count, type, MPI_STATUS_IGNORE ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileReadAll( File fh, void* buf, int count, Datatype type )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileReadAll");
+#endif
+    SafeMpi( MPI_File_read_all( fh, buf, count, type, MPI_STATUS_IGNORE ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileWriteAll( File fh, const void* buf, int count, Datatype type )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileWriteAll");
+#endif
+    SafeMpi( MPI_File_write_all
+      ( fh, const_cast<void*>(buf), count, type, MPI_STATUS_IGNORE ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileIRead( File fh, void* buf, int count, Datatype type, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileIRead");
+#endif
+    SafeMpi( MPI_File_iread( fh, buf, count, type, &request ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+void FileIWrite
+( File fh, const void* buf, int count, Datatype type, Request& request )
+{
+#ifndef RELEASE
+    PushCallStack("mpi::FileIWrite");
+#endif
+    SafeMpi
+    ( MPI_File_iwrite( fh, const_cast<void*>(buf), count, type, &request ) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 // Wait until every process in comm reaches this statement
 void Barrier( Comm comm )
 {
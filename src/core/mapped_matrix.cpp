@@ -0,0 +1,255 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+#ifndef WIN32
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace elem {
+
+namespace {
+const std::size_t fileHeaderSize = 64;
+}
+
+template<typename T,typename Int>
+MappedMatrix<T,Int>::MappedMatrix( const std::string filename, bool readOnly )
+: map_(0), mapSize_(0), readOnly_(readOnly)
+{
+#ifndef RELEASE
+    PushCallStack("MappedMatrix::MappedMatrix");
+#endif
+    Map( filename, false, 0, 0 );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+MappedMatrix<T,Int>::MappedMatrix
+( const std::string filename, Int height, Int width )
+: map_(0), mapSize_(0), readOnly_(false)
+{
+#ifndef RELEASE
+    PushCallStack("MappedMatrix::MappedMatrix");
+    if( height < 0 || width < 0 )
+        throw std::logic_error("Dimensions must be non-negative");
+#endif
+    Map( filename, true, height, width );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+MappedMatrix<T,Int>::~MappedMatrix()
+{
+    this->Empty();
+#ifndef WIN32
+    if( map_ != 0 )
+        munmap( map_, mapSize_ );
+#endif
+}
+
+template<typename T,typename Int>
+void
+MappedMatrix<T,Int>::Map
+( const std::string filename, bool create, Int height, Int width )
+{
+#ifdef WIN32
+    throw std::logic_error("Memory-mapped matrices require POSIX");
+#else
+    const int flags = 
+        ( create ? O_RDWR | O_CREAT | O_TRUNC : (readOnly_ ? O_RDONLY : O_RDWR) );
+    const int fd = open( filename.c_str(), flags, 0644 );
+    if( fd < 0 )
+        throw std::runtime_error("Could not open "+filename);
+
+    DistMatrixFileHeader header;
+    if( create )
+    {
+        MemZero( (char*)&header, sizeof(header) );
+        std::strcpy( header.magic, "ELEMMAT" );
+        header.version = 1;
+        header.dataType = this->DataType();
+        header.dataSize = sizeof(T);
+        header.colDist = STAR;
+        header.rowDist = STAR;
+        header.height = height;
+        header.width = width;
+        mapSize_ = fileHeaderSize + std::size_t(height)*width*sizeof(T);
+        if( ftruncate( fd, mapSize_ ) != 0 ||
+            pwrite( fd, &header, sizeof(header), 0 ) != sizeof(header) )
+        {
+            close( fd );
+            throw std::runtime_error("Could not initialize "+filename);
+        }
+    }
+    else
+    {
+        if( pread( fd, &header, sizeof(header), 0 ) != sizeof(header) ||
+            std::strncmp( header.magic, "ELEMMAT", 8 ) != 0 || 
+            header.version != 1 )
+        {
+            close( fd );
+            throw std::runtime_error(filename+" is not an Elemental matrix");
+        }
+        if( header.dataType != this->DataType() || 
+            header.dataSize != int(sizeof(T)) )
+        {
+            close( fd );
+            throw std::logic_error("File datatype does not match the matrix");
+        }
+        height = header.height;
+        width = header.width;
+        mapSize_ = fileHeaderSize + std::size_t(height)*width*sizeof(T);
+        struct stat info;
+        if( fstat( fd, &info ) != 0 || std::size_t(info.st_size) < mapSize_ )
+        {
+            close( fd );
+            throw std::runtime_error(filename+" is truncated");
+        }
+    }
+
+    const int prot = ( readOnly_ ? PROT_READ : PROT_READ | PROT_WRITE );
+    map_ = mmap( 0, mapSize_, prot, MAP_SHARED, fd, 0 );
+    close( fd );
+    if( map_ == MAP_FAILED )
+    {
+        map_ = 0;
+        throw std::runtime_error("Could not map "+filename);
+    }
+
+    T* buffer = reinterpret_cast<T*>( static_cast<byte*>(map_)+fileHeaderSize );
+    const Int ldim = std::max( height, 1 );
+    if( readOnly_ )
+        this->LockedAttach( height, width, buffer, ldim );
+    else
+        this->Attach( height, width, buffer, ldim );
+#endif
+}
+
+// Return the page-aligned byte range of the mapping containing columns
+// j through j+width-1
+template<typename T,typename Int>
+void
+MappedMatrix<T,Int>::ColumnRange
+( Int j, Int width, byte*& start, std::size_t& size ) const
+{
+#ifndef RELEASE
+    if( j < 0 || width < 0 || j+width > this->Width() )
+        throw std::logic_error("Column range is out of bounds");
+#endif
+#ifndef WIN32
+    const std::size_t pageSize = sysconf( _SC_PAGESIZE );
+    const std::size_t ldim = this->LDim();
+    const std::size_t begin = fileHeaderSize + j*ldim*sizeof(T);
+    const std::size_t end = 
+        std::min( mapSize_, fileHeaderSize + (j+width)*ldim*sizeof(T) );
+    const std::size_t alignedBegin = (begin/pageSize)*pageSize;
+    start = static_cast<byte*>(map_) + alignedBegin;
+    size = ( end > alignedBegin ? end-alignedBegin : 0 );
+#endif
+}
+
+template<typename T,typename Int>
+void
+MappedMatrix<T,Int>::Advise( MappedAccess access )
+{
+#ifndef RELEASE
+    PushCallStack("MappedMatrix::Advise");
+#endif
+#ifndef WIN32
+    int advice = MADV_NORMAL;
+    if( access == MAPPED_SEQUENTIAL )
+        advice = MADV_SEQUENTIAL;
+    else if( access == MAPPED_RANDOM )
+        advice = MADV_RANDOM;
+    if( map_ != 0 )
+        madvise( map_, mapSize_, advice );
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+void
+MappedMatrix<T,Int>::Prefetch( Int j, Int width )
+{
+#ifndef RELEASE
+    PushCallStack("MappedMatrix::Prefetch");
+#endif
+#ifndef WIN32
+    byte* start;
+    std::size_t size;
+    ColumnRange( j, width, start, size );
+    if( size > 0 )
+        madvise( start, size, MADV_WILLNEED );
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+void
+MappedMatrix<T,Int>::Release( Int j, Int width )
+{
+#ifndef RELEASE
+    PushCallStack("MappedMatrix::Release");
+#endif
+#ifndef WIN32
+    byte* start;
+    std::size_t size;
+    ColumnRange( j, width, start, size );
+    if( size > 0 )
+    {
+        if( !readOnly_ )
+            msync( start, size, MS_SYNC );
+        madvise( start, size, MADV_DONTNEED );
+    }
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename T,typename Int>
+void
+MappedMatrix<T,Int>::Flush()
+{
+#ifndef RELEASE
+    PushCallStack("MappedMatrix::Flush");
+#endif
+#ifndef WIN32
+    if( map_ != 0 && !readOnly_ )
+        if( msync( map_, mapSize_, MS_SYNC ) != 0 )
+            throw std::runtime_error("Could not flush the mapping");
+#endif
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template class MappedMatrix<int,int>;
+#ifndef DISABLE_FLOAT
+template class MappedMatrix<float,int>;
+#endif // ifndef DISABLE_FLOAT
+template class MappedMatrix<double,int>;
+#ifndef DISABLE_COMPLEX
+#ifndef DISABLE_FLOAT
+template class MappedMatrix<Complex<float>,int>;
+#endif // ifndef DISABLE_FLOAT
+template class MappedMatrix<Complex<double>,int>;
+#endif // ifndef DISABLE_COMPLEX
+
+} // namespace elem
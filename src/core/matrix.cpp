@@ -755,6 +755,43 @@ Matrix<T,Int>::UpdateImagPart_S( Int i, Int j, const Scalar& v )
 	UpdateImagPart_( i, j, v.template Cast<RT>() );
 }
 
+//
+// BULK ENTRY MANIPULATION
+//
+
+template <typename Int>
+void
+AutoMatrix<Int>::GetBlock
+( Int i, Int j, Int height, Int width, void* buffer, Int ldim ) const
+{
+	PushCallStack( "AutoMatrix::GetBlock" );
+	AssertValidSubmatrix( i, j, height, width, height_, width_ );
+	AssertLDim( height, ldim );
+	PopCallStack();
+	const size_t colSize = height * dsize_;
+	byte* dest = static_cast<byte*>(buffer);
+	const byte* source = data_ + ( i + j * ldim_ ) * dsize_;
+	for ( Int jj = 0 ; jj < width ; ++jj )
+		MemCopy( dest + jj * ldim * dsize_, source + jj * ldim_ * dsize_, colSize );
+}
+
+template <typename Int>
+void
+AutoMatrix<Int>::SetBlock
+( Int i, Int j, Int height, Int width, const void* buffer, Int ldim )
+{
+	PushCallStack( "AutoMatrix::SetBlock" );
+	AssertValidSubmatrix( i, j, height, width, height_, width_ );
+	AssertLDim( height, ldim );
+	AssertUnlocked( *this );
+	PopCallStack();
+	const size_t colSize = height * dsize_;
+	const byte* source = static_cast<const byte*>(buffer);
+	byte* dest = data_ + ( i + j * ldim_ ) * dsize_;
+	for ( Int jj = 0 ; jj < width ; ++jj )
+		MemCopy( dest + jj * ldim_ * dsize_, source + jj * ldim * dsize_, colSize );
+}
+
 //
 // DIAGONAL MANIPULATION
 //
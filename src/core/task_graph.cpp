@@ -0,0 +1,210 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental.hpp"
+#include <set>
+
+namespace elem {
+
+TaskGraph::Task::Task( const elem::Grid& grid, int priority )
+: grid_(&grid), priority_(priority)
+{ }
+
+TaskGraph::Task::~Task()
+{ }
+
+void
+TaskGraph::Task::AddAccess
+( const AutoDistMatrix<int>* distMatrix, const AutoMatrix<int>* matrix,
+  bool write )
+{
+    Access access;
+    access.distMatrix = distMatrix;
+    access.matrix = matrix;
+    access.write = write;
+    accesses_.push_back( access );
+}
+
+TaskGraph::Task&
+TaskGraph::Task::Reads( const AutoDistMatrix<int>& A )
+{
+    AddAccess( &A, 0, false );
+    return *this;
+}
+
+TaskGraph::Task&
+TaskGraph::Task::Reads( const AutoMatrix<int>& A )
+{
+    AddAccess( 0, &A, false );
+    return *this;
+}
+
+TaskGraph::Task&
+TaskGraph::Task::Writes( AutoDistMatrix<int>& A )
+{
+    AddAccess( &A, 0, true );
+    return *this;
+}
+
+TaskGraph::Task&
+TaskGraph::Task::Writes( AutoMatrix<int>& A )
+{
+    AddAccess( 0, &A, true );
+    return *this;
+}
+
+namespace {
+
+// Return the range of local memory currently spanned by the matrix, if any
+bool
+Footprint
+( const AutoDistMatrix<int>* distMatrix, const AutoMatrix<int>* matrix,
+  const byte*& begin, const byte*& end )
+{
+    const void* buffer;
+    int localHeight, localWidth, ldim;
+    std::size_t dataSize;
+    if( distMatrix != 0 )
+    {
+        buffer = distMatrix->LockedBuffer();
+        localHeight = distMatrix->LocalHeight();
+        localWidth = distMatrix->LocalWidth();
+        ldim = distMatrix->LDim();
+        dataSize = distMatrix->DataSize();
+    }
+    else
+    {
+        buffer = matrix->LockedBuffer();
+        localHeight = matrix->Height();
+        localWidth = matrix->Width();
+        ldim = matrix->LDim();
+        dataSize = matrix->DataSize();
+    }
+    if( localHeight == 0 || localWidth == 0 )
+        return false;
+    begin = static_cast<const byte*>(buffer);
+    end = begin + ((localWidth-1)*ldim+localHeight)*dataSize;
+    return true;
+}
+
+} // anonymous namespace
+
+// Two accesses, at least one of which is a write, conflict if they are to the
+// same matrix, even if it is empty or is reallocated by one of the tasks. 
+// Otherwise, they conflict if the ranges of local memory spanned by the 
+// matrices overlap when the graph is scheduled, since views share the memory 
+// of the matrices that they view.
+bool
+TaskGraph::Task::ConflictsWith( const Task& task ) const
+{
+    for( std::size_t k=0; k<accesses_.size(); ++k )
+    {
+        const Access& a = accesses_[k];
+        for( std::size_t l=0; l<task.accesses_.size(); ++l )
+        {
+            const Access& b = task.accesses_[l];
+            if( !a.write && !b.write )
+                continue;
+            if( a.distMatrix == b.distMatrix && a.matrix == b.matrix )
+                return true;
+            const byte *aBegin, *aEnd, *bBegin, *bEnd;
+            if( Footprint( a.distMatrix, a.matrix, aBegin, aEnd ) &&
+                Footprint( b.distMatrix, b.matrix, bBegin, bEnd ) &&
+                aBegin < bEnd && bBegin < aEnd )
+                return true;
+        }
+    }
+    return false;
+}
+
+TaskGraph::TaskGraph( const elem::Grid& grid )
+: grid_(&grid)
+{ }
+
+TaskGraph::~TaskGraph()
+{ Clear(); }
+
+int
+TaskGraph::NumPending() const
+{ return tasks_.size(); }
+
+void
+TaskGraph::Clear()
+{
+    for( std::size_t k=0; k<tasks_.size(); ++k )
+        delete tasks_[k];
+    tasks_.clear();
+}
+
+// Every process computes the same order: task j depends upon an earlier task
+// i if they conflict on any process, and the ready tasks are taken in order
+// of decreasing priority and then in the order in which they were queued.
+// Each pair of tasks is thus run in the same relative order by every process
+// which belongs to both of their grids, so their collectives cannot deadlock.
+std::vector<int>
+TaskGraph::Schedule() const
+{
+    const int n = tasks_.size();
+    std::vector<byte> conflicts( std::max(n*(n-1)/2,1), 0 );
+    for( int j=0; j<n; ++j )
+        for( int i=0; i<j; ++i )
+            conflicts[j*(j-1)/2+i] = tasks_[i]->ConflictsWith( *tasks_[j] );
+    mpi::AllReduce
+    ( &conflicts[0], conflicts.size(), mpi::MAX, grid_->ViewingComm() );
+
+    std::vector<int> numDeps( n, 0 );
+    for( int j=0; j<n; ++j )
+        for( int i=0; i<j; ++i )
+            numDeps[j] += conflicts[j*(j-1)/2+i];
+    std::set<std::pair<int,int> > ready;
+    for( int j=0; j<n; ++j )
+        if( numDeps[j] == 0 )
+            ready.insert( std::make_pair( -tasks_[j]->priority_, j ) );
+
+    std::vector<int> order;
+    order.reserve( n );
+    while( !ready.empty() )
+    {
+        const int i = ready.begin()->second;
+        ready.erase( ready.begin() );
+        order.push_back( i );
+        for( int j=i+1; j<n; ++j )
+            if( conflicts[j*(j-1)/2+i] && --numDeps[j] == 0 )
+                ready.insert( std::make_pair( -tasks_[j]->priority_, j ) );
+    }
+    return order;
+}
+
+void
+TaskGraph::Wait()
+{
+#ifndef RELEASE
+    PushCallStack("TaskGraph::Wait");
+#endif
+    const std::vector<int> order = Schedule();
+    try
+    {
+        for( std::size_t k=0; k<order.size(); ++k )
+        {
+            Task& task = *tasks_[order[k]];
+            if( task.grid_->InGrid() )
+                task.Run();
+        }
+    }
+    catch( ... )
+    {
+        Clear();
+        throw;
+    }
+    Clear();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace elem
@@ -8,12 +8,11 @@
 */
 #include "elemental-lite.hpp"
 
-#ifdef HAVE_PMRRR
-
 #include "elemental/blas-like/level1/Scale.hpp"
 #include "elemental/blas-like/level1/ScaleTrapezoid.hpp"
 #include "elemental/lapack-like/ApplyPackedReflectors.hpp"
 #include "elemental/lapack-like/Norm/Max.hpp"
+#include "elemental/lapack-like/HermitianEig/SDC.hpp"
 
 namespace elem {
 
@@ -215,27 +214,229 @@ void CheckScale
     }
 }
 
+// Reduce A to real symmetric tridiagonal form (using the approach chosen
+// via SetHermitianTridiagApproach) and fill d and e with full copies of the
+// diagonal and subdiagonal.
+template<typename R>
+void Tridiagonalize
+( UpperOrLower uplo, DistMatrix<R>& A,
+  DistMatrix<R,STAR,STAR>& d, DistMatrix<R,STAR,STAR>& e,
+  HermitianTridiagBulges<R>& bulges )
+{
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    if( GetHermitianTridiagApproach() == HERMITIAN_TRIDIAG_TWO_STAGE )
+    {
+        DistMatrix<R,STAR,STAR> t(g);
+        HermitianTridiagTwoStage( uplo, A, t, d, e, bulges );
+    }
+    else
+    {
+        const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+        HermitianTridiag( uplo, A );
+
+        DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
+                              e_MD_STAR( n-1, 1, g );
+        A.GetDiagonal( d_MD_STAR );
+        A.GetDiagonal( e_MD_STAR, subdiagonal );
+        d = d_MD_STAR;
+        e = e_MD_STAR;
+    }
+}
+
+template<typename R>
+void Tridiagonalize
+( UpperOrLower uplo,
+  DistMatrix<Complex<R> >& A, DistMatrix<Complex<R>,STAR,STAR>& t,
+  DistMatrix<R,STAR,STAR>& d, DistMatrix<R,STAR,STAR>& e,
+  HermitianTridiagBulges<Complex<R> >& bulges )
+{
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    if( GetHermitianTridiagApproach() == HERMITIAN_TRIDIAG_TWO_STAGE )
+        HermitianTridiagTwoStage( uplo, A, t, d, e, bulges );
+    else
+    {
+        const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+        HermitianTridiag( uplo, A, t );
+
+        DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
+                              e_MD_STAR( n-1, 1, g );
+        A.GetRealPartOfDiagonal( d_MD_STAR );
+        A.GetRealPartOfDiagonal( e_MD_STAR, subdiagonal );
+        d = d_MD_STAR;
+        e = e_MD_STAR;
+    }
+}
+
+// Z := Q Z, where Q is the unitary matrix from Tridiagonalize. In the
+// two-stage case, the bulge-chasing reflectors are applied to a [* ,VR]
+// copy of Z, since each process then owns complete columns.
+template<typename R>
+void Backtransform
+( UpperOrLower uplo, const DistMatrix<R>& A,
+  const HermitianTridiagBulges<R>& bulges, DistMatrix<R>& Z )
+{
+    const Grid& g = A.Grid();
+    if( GetHermitianTridiagApproach() == HERMITIAN_TRIDIAG_TWO_STAGE )
+    {
+        {
+            DistMatrix<R,STAR,VR> Z_STAR_VR(g);
+            Z_STAR_VR = Z;
+            ApplyHermitianTridiagBulges( bulges, Z_STAR_VR.Matrix() );
+            Z = Z_STAR_VR;
+        }
+        DistMatrix<R,STAR,STAR> t(g);
+        ApplyHermitianTridiagBand( A, t, bulges, Z );
+    }
+    else
+    {
+        const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+        if( uplo == LOWER )
+            ApplyPackedReflectors
+            ( LEFT, LOWER, VERTICAL, BACKWARD, subdiagonal, A, Z );
+        else
+            ApplyPackedReflectors
+            ( LEFT, UPPER, VERTICAL, FORWARD,  subdiagonal, A, Z );
+    }
+}
+
+template<typename R>
+void Backtransform
+( UpperOrLower uplo,
+  const DistMatrix<Complex<R> >& A,
+  const DistMatrix<Complex<R>,STAR,STAR>& t,
+  const HermitianTridiagBulges<Complex<R> >& bulges,
+  DistMatrix<Complex<R> >& Z )
+{
+    const Grid& g = A.Grid();
+    if( GetHermitianTridiagApproach() == HERMITIAN_TRIDIAG_TWO_STAGE )
+    {
+        {
+            DistMatrix<Complex<R>,STAR,VR> Z_STAR_VR(g);
+            Z_STAR_VR = Z;
+            ApplyHermitianTridiagBulges( bulges, Z_STAR_VR.Matrix() );
+            Z = Z_STAR_VR;
+        }
+        ApplyHermitianTridiagBand( A, t, bulges, Z );
+    }
+    else
+    {
+        const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+        if( uplo == LOWER )
+            ApplyPackedReflectors
+            ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED,
+              subdiagonal, A, t, Z );
+        else
+            ApplyPackedReflectors
+            ( LEFT, UPPER, VERTICAL, FORWARD, UNCONJUGATED,
+              subdiagonal, A, t, Z );
+    }
+}
+
+// Overwrite the leading n x k submatrix of Z[MC,MR] with the eigenvectors of
+// the tridiagonal matrix, which are stored in X[* ,VR]
+template<typename R>
+void StoreTridiagEigenvectors
+( const DistMatrix<R,STAR,VR>& X, DistMatrix<R>& paddedZ )
+{
+    DistMatrix<R> Z( paddedZ.Grid() );
+    View( Z, paddedZ, 0, 0, X.Height(), X.Width() );
+    Z = X;
+}
+
+template<typename R>
+void StoreTridiagEigenvectors
+( const DistMatrix<R,STAR,VR>& X, DistMatrix<Complex<R> >& paddedZ )
+{
+    const Grid& g = paddedZ.Grid();
+    DistMatrix<Complex<R>,STAR,VR> XComplex( g );
+    XComplex.AlignWith( X );
+    XComplex.ResizeTo( X.Height(), X.Width() );
+    const int localHeight = X.LocalHeight();
+    const int localWidth = X.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            XComplex.SetLocal( iLocal, jLocal, X.GetLocal(iLocal,jLocal) );
+
+    DistMatrix<Complex<R> > Z( g );
+    View( Z, paddedZ, 0, 0, X.Height(), X.Width() );
+    Z = XComplex;
+}
+
+// Solve the tridiagonal eigenvalue problem with divide and conquer into 
+// Z[* ,VR] and then redistribute into Z[MC,MR]. Unless paddedZ is a view, 
+// it is reallocated to be exactly n x k.
+template<typename F>
+void DivideAndConquer
+( const DistMatrix<typename Base<F>::type,STAR,STAR>& d,
+  const DistMatrix<typename Base<F>::type,STAR,STAR>& e,
+  DistMatrix<typename Base<F>::type,VR,STAR>& w, DistMatrix<F>& paddedZ )
+{
+    typedef typename Base<F>::type R;
+    if( !paddedZ.Viewing() )
+        paddedZ.Empty();
+    DistMatrix<R,STAR,VR> Z_STAR_VR( paddedZ.Grid() );
+    HermitianTridiagEig( d, e, w, Z_STAR_VR );
+    if( !paddedZ.Viewing() )
+        paddedZ.ResizeTo( Z_STAR_VR.Height(), Z_STAR_VR.Width() );
+    StoreTridiagEigenvectors( Z_STAR_VR, paddedZ );
+}
+
+template<typename F>
+void DivideAndConquer
+( const DistMatrix<typename Base<F>::type,STAR,STAR>& d,
+  const DistMatrix<typename Base<F>::type,STAR,STAR>& e,
+  DistMatrix<typename Base<F>::type,VR,STAR>& w, DistMatrix<F>& paddedZ,
+  int lowerBound, int upperBound )
+{
+    typedef typename Base<F>::type R;
+    if( !paddedZ.Viewing() )
+        paddedZ.Empty();
+    DistMatrix<R,STAR,VR> Z_STAR_VR( paddedZ.Grid() );
+    HermitianTridiagEig( d, e, w, Z_STAR_VR, lowerBound, upperBound );
+    if( !paddedZ.Viewing() )
+        paddedZ.ResizeTo( Z_STAR_VR.Height(), Z_STAR_VR.Width() );
+    StoreTridiagEigenvectors( Z_STAR_VR, paddedZ );
+}
+
+template<typename F>
+void DivideAndConquer
+( const DistMatrix<typename Base<F>::type,STAR,STAR>& d,
+  const DistMatrix<typename Base<F>::type,STAR,STAR>& e,
+  DistMatrix<typename Base<F>::type,VR,STAR>& w, DistMatrix<F>& paddedZ,
+  typename Base<F>::type lowerBound, typename Base<F>::type upperBound )
+{
+    typedef typename Base<F>::type R;
+    if( !paddedZ.Viewing() )
+        paddedZ.Empty();
+    DistMatrix<R,STAR,VR> Z_STAR_VR( paddedZ.Grid() );
+    HermitianTridiagEig( d, e, w, Z_STAR_VR, lowerBound, upperBound );
+    if( !paddedZ.Viewing() )
+        paddedZ.ResizeTo( Z_STAR_VR.Height(), Z_STAR_VR.Width() );
+    StoreTridiagEigenvectors( Z_STAR_VR, paddedZ );
+}
+
 } // namespace hermitian_eig
 
-//----------------------------------------------------------------------------//
-// Grab the full set of eigenpairs of the real, symmetric matrix A            //
-//----------------------------------------------------------------------------//
-void HermitianEig
+namespace hermitian_eig {
+
+// Compute the full set of eigenpairs of the real, symmetric matrix A through
+// tridiagonalization, regardless of the HermitianEigApproach
+void TridiagEig
 ( UpperOrLower uplo, 
   DistMatrix<double>& A,
   DistMatrix<double,VR,STAR>& w,
   DistMatrix<double>& paddedZ )
 {
 #ifndef RELEASE
-    PushCallStack("HermitianEig");
+    PushCallStack("hermitian_eig::TridiagEig");
 #endif
     typedef double R;
 
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square");
 
-    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
-
     const int n = A.Height();
     const int k = n; // full set of eigenpairs
     const Grid& g = A.Grid();
@@ -280,25 +481,19 @@ void HermitianEig
     if( needRescaling )
         ScaleTrapezoid( scale, LEFT, uplo, 0, A );
 
-    // Tridiagonalize A
-    HermitianTridiag( uplo, A );
-
-    // Grab copies of the diagonal and subdiagonal of A
-    DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
-                          e_MD_STAR( n-1, 1, g );
-    A.GetDiagonal( d_MD_STAR );
-    A.GetDiagonal( e_MD_STAR, subdiagonal );
-
-    // In order to call pmrrr, we need full copies of the diagonal and 
-    // subdiagonal in vectors of length n. We accomplish this for e by 
-    // making its leading dimension n.
+    // Tridiagonalize A. In order to call pmrrr, we need full copies of the 
+    // diagonal and subdiagonal in vectors of length n. We accomplish this 
+    // for e by making its leading dimension n.
     DistMatrix<R,STAR,STAR> d_STAR_STAR( n,   1,    g ),
                             e_STAR_STAR( n-1, 1, n, g );
-    d_STAR_STAR = d_MD_STAR;
-    e_STAR_STAR = e_MD_STAR;
+    HermitianTridiagBulges<R> bulges;
+    hermitian_eig::Tridiagonalize( uplo, A, d_STAR_STAR, e_STAR_STAR, bulges );
 
+#ifdef HAVE_PMRRR
     // Solve the tridiagonal eigenvalue problem with PMRRR into Z[* ,VR]
     // then redistribute into Z[MC,MR] in place, panel by panel
+    if( GetHermitianTridiagEigApproach() !=
+        HERMITIAN_TRIDIAG_EIG_DIVIDE_AND_CONQUER )
     {
         // Grab a pointer into the paddedZ local matrix
         R* paddedZBuffer = paddedZ.Buffer();
@@ -360,15 +555,13 @@ void HermitianEig
         }
         PopBlocksizeStack();
     }
+    else
+#endif // ifdef HAVE_PMRRR
+        hermitian_eig::DivideAndConquer( d_STAR_STAR, e_STAR_STAR, w, paddedZ );
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() ); // We can simply shrink matrices
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, subdiagonal, A, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD,  subdiagonal, A, paddedZ );
+    hermitian_eig::Backtransform( uplo, A, bulges, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -378,6 +571,29 @@ void HermitianEig
 #endif
 }
 
+} // namespace hermitian_eig
+
+//----------------------------------------------------------------------------//
+// Grab the full set of eigenpairs of the real, symmetric matrix A            //
+//----------------------------------------------------------------------------//
+void HermitianEig
+( UpperOrLower uplo, 
+  DistMatrix<double>& A,
+  DistMatrix<double,VR,STAR>& w,
+  DistMatrix<double>& paddedZ )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#endif
+    if( hermitian_eig::UseSDC( A ) )
+        hermitian_eig::SDC( uplo, A, w, paddedZ );
+    else
+        hermitian_eig::TridiagEig( uplo, A, w, paddedZ );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 //----------------------------------------------------------------------------//
 // Grab a partial set of eigenpairs of the real, symmetric n x n matrix A.    //
 // The partial set is determined by the inclusive zero-indexed range          //
@@ -399,8 +615,6 @@ void HermitianEig
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square");
 
-    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
-
     const int n = A.Height();
     const int k = (upperBound - lowerBound) + 1;
     const Grid& g = A.Grid();
@@ -445,25 +659,19 @@ void HermitianEig
     if( needRescaling )
         ScaleTrapezoid( scale, LEFT, uplo, 0, A );
 
-    // Tridiagonalize A
-    HermitianTridiag( uplo, A );
-
-    // Grab copies of the diagonal and subdiagonal of A
-    DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
-                          e_MD_STAR( n-1, 1, g );
-    A.GetDiagonal( d_MD_STAR );
-    A.GetDiagonal( e_MD_STAR, subdiagonal );
-
-    // In order to call pmrrr, we need full copies of the diagonal and 
-    // subdiagonal in vectors of length n. We accomplish this for e by 
-    // making its leading dimension n.
+    // Tridiagonalize A. In order to call pmrrr, we need full copies of the 
+    // diagonal and subdiagonal in vectors of length n. We accomplish this 
+    // for e by making its leading dimension n.
     DistMatrix<R,STAR,STAR> d_STAR_STAR( n,   1,    g ),
                             e_STAR_STAR( n-1, 1, n, g );
-    d_STAR_STAR = d_MD_STAR;
-    e_STAR_STAR = e_MD_STAR;
+    HermitianTridiagBulges<R> bulges;
+    hermitian_eig::Tridiagonalize( uplo, A, d_STAR_STAR, e_STAR_STAR, bulges );
 
+#ifdef HAVE_PMRRR
     // Solve the tridiagonal eigenvalue problem with PMRRR into Z[* ,VR]
     // then redistribute into Z[MC,MR] in place, panel by panel
+    if( GetHermitianTridiagEigApproach() !=
+        HERMITIAN_TRIDIAG_EIG_DIVIDE_AND_CONQUER )
     {
         // Grab a pointer into the paddedZ local matrix 
         R* paddedZBuffer = paddedZ.Buffer();
@@ -526,15 +734,14 @@ void HermitianEig
         }
         PopBlocksizeStack();
     }
+    else
+#endif // ifdef HAVE_PMRRR
+        hermitian_eig::DivideAndConquer
+        ( d_STAR_STAR, e_STAR_STAR, w, paddedZ, lowerBound, upperBound );
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() );
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, subdiagonal, A, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD,  subdiagonal, A, paddedZ );
+    hermitian_eig::Backtransform( uplo, A, bulges, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -563,8 +770,6 @@ void HermitianEig
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square");
 
-    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
-
     const int n = A.Height();
     const Grid& g = A.Grid();
 
@@ -601,25 +806,19 @@ void HermitianEig
     if( needRescaling )
         ScaleTrapezoid( scale, LEFT, uplo, 0, A );
 
-    // Tridiagonalize A
-    HermitianTridiag( uplo, A );
-
-    // Grab copies of the diagonal and subdiagonal of A
-    DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
-                          e_MD_STAR( n-1, 1, g );
-    A.GetDiagonal( d_MD_STAR );
-    A.GetDiagonal( e_MD_STAR, subdiagonal );
-
-    // In order to call pmrrr, we need full copies of the diagonal and 
-    // subdiagonal in vectors of length n. We accomplish this for e by 
-    // making its leading dimension n.
+    // Tridiagonalize A. In order to call pmrrr, we need full copies of the 
+    // diagonal and subdiagonal in vectors of length n. We accomplish this 
+    // for e by making its leading dimension n.
     DistMatrix<R,STAR,STAR> d_STAR_STAR( n,   1,    g ),
                             e_STAR_STAR( n-1, 1, n, g );
-    d_STAR_STAR = d_MD_STAR;
-    e_STAR_STAR = e_MD_STAR;
+    HermitianTridiagBulges<R> bulges;
+    hermitian_eig::Tridiagonalize( uplo, A, d_STAR_STAR, e_STAR_STAR, bulges );
 
+#ifdef HAVE_PMRRR
     // Solve the tridiagonal eigenvalue problem with PMRRR into Z[* ,VR]
     // then redistribute into Z[MC,MR]
+    if( GetHermitianTridiagEigApproach() !=
+        HERMITIAN_TRIDIAG_EIG_DIVIDE_AND_CONQUER )
     {
         // Get an estimate of the amount of memory to allocate
         std::vector<R> dVector(n), eVector(n), wVector(n);
@@ -703,15 +902,14 @@ void HermitianEig
         }
         PopBlocksizeStack();
     }
+    else
+#endif // ifdef HAVE_PMRRR
+        hermitian_eig::DivideAndConquer
+        ( d_STAR_STAR, e_STAR_STAR, w, paddedZ, lowerBound, upperBound );
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() );
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, subdiagonal, A, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD,  subdiagonal, A, paddedZ );
+    hermitian_eig::Backtransform( uplo, A, bulges, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -721,16 +919,17 @@ void HermitianEig
 #endif
 }
 
-//----------------------------------------------------------------------------//
-// Grab the full set of eigenvalues the of the real, symmetric matrix A       //
-//----------------------------------------------------------------------------//
-void HermitianEig
+namespace hermitian_eig {
+
+// Compute the full set of eigenvalues of the real, symmetric matrix A through
+// tridiagonalization, regardless of the HermitianEigApproach
+void TridiagEig
 ( UpperOrLower uplo, 
   DistMatrix<double>& A,
   DistMatrix<double,VR,STAR>& w )
 {
 #ifndef RELEASE
-    PushCallStack("HermitianEig");
+    PushCallStack("hermitian_eig::TridiagEig");
 #endif
     typedef double R;
     if( A.Height() != A.Width() )
@@ -740,8 +939,6 @@ void HermitianEig
     const int k = n;
     const Grid& g = A.Grid();
 
-    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
-
     if( w.Viewing() )
     {
         if( w.ColAlignment() != 0 )
@@ -762,24 +959,18 @@ void HermitianEig
     if( needRescaling )
         ScaleTrapezoid( scale, LEFT, uplo, 0, A );
 
-    // Tridiagonalize A
-    HermitianTridiag( uplo, A );
-
-    // Grab copies of the diagonal and subdiagonal of A
-    DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
-                          e_MD_STAR( n-1, 1, g );
-    A.GetDiagonal( d_MD_STAR );
-    A.GetDiagonal( e_MD_STAR, subdiagonal );
-
-    // In order to call pmrrr, we need full copies of the diagonal and 
-    // subdiagonal in vectors of length n. We accomplish this for e by 
-    // making its leading dimension n.
+    // Tridiagonalize A. In order to call pmrrr, we need full copies of the 
+    // diagonal and subdiagonal in vectors of length n. We accomplish this 
+    // for e by making its leading dimension n.
     DistMatrix<R,STAR,STAR> d_STAR_STAR( n,   1,    g ),
                             e_STAR_STAR( n-1, 1, n, g );
-    d_STAR_STAR = d_MD_STAR;
-    e_STAR_STAR = e_MD_STAR;
+    HermitianTridiagBulges<R> bulges;
+    hermitian_eig::Tridiagonalize( uplo, A, d_STAR_STAR, e_STAR_STAR, bulges );
 
+#ifdef HAVE_PMRRR
     // Solve the tridiagonal eigenvalue problem with PMRRR.
+    if( GetHermitianTridiagEigApproach() !=
+        HERMITIAN_TRIDIAG_EIG_DIVIDE_AND_CONQUER )
     {
         std::vector<R> wVector(n);
         pmrrr::Eig
@@ -790,6 +981,9 @@ void HermitianEig
         for( int iLocal=0; iLocal<w.LocalHeight(); ++iLocal )
             w.SetLocal(iLocal,0,wVector[iLocal]);
     }
+    else
+#endif // ifdef HAVE_PMRRR
+        HermitianTridiagEig( d_STAR_STAR, e_STAR_STAR, w );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -799,6 +993,28 @@ void HermitianEig
 #endif
 }
 
+} // namespace hermitian_eig
+
+//----------------------------------------------------------------------------//
+// Grab the full set of eigenvalues the of the real, symmetric matrix A       //
+//----------------------------------------------------------------------------//
+void HermitianEig
+( UpperOrLower uplo, 
+  DistMatrix<double>& A,
+  DistMatrix<double,VR,STAR>& w )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#endif
+    if( hermitian_eig::UseSDC( A ) )
+        hermitian_eig::SDC( uplo, A, w );
+    else
+        hermitian_eig::TridiagEig( uplo, A, w );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 //----------------------------------------------------------------------------//
 // Grab a partial set of eigenvalues of the real, symmetric n x n matrix A.   //
 // The partial set is determined by the inclusive zero-indexed range          //
@@ -819,8 +1035,6 @@ void HermitianEig
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square");
 
-    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
-
     const int n = A.Height();
     const int k = (upperBound - lowerBound) + 1;
     const Grid& g = A.Grid();
@@ -845,24 +1059,18 @@ void HermitianEig
     if( needRescaling )
         ScaleTrapezoid( scale, LEFT, uplo, 0, A );
 
-    // Tridiagonalize A
-    HermitianTridiag( uplo, A );
-
-    // Grab copies of the diagonal and subdiagonal of A
-    DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
-                          e_MD_STAR( n-1, 1, g );
-    A.GetDiagonal( d_MD_STAR );
-    A.GetDiagonal( e_MD_STAR, subdiagonal );
-
-    // In order to call pmrrr, we need full copies of the diagonal and 
-    // subdiagonal in vectors of length n. We accomplish this for e by 
-    // making its leading dimension n.
+    // Tridiagonalize A. In order to call pmrrr, we need full copies of the 
+    // diagonal and subdiagonal in vectors of length n. We accomplish this 
+    // for e by making its leading dimension n.
     DistMatrix<R,STAR,STAR> d_STAR_STAR( n,   1,    g ),
                             e_STAR_STAR( n-1, 1, n, g );
-    d_STAR_STAR = d_MD_STAR;
-    e_STAR_STAR = e_MD_STAR;
+    HermitianTridiagBulges<R> bulges;
+    hermitian_eig::Tridiagonalize( uplo, A, d_STAR_STAR, e_STAR_STAR, bulges );
 
+#ifdef HAVE_PMRRR
     // Solve the tridiagonal eigenvalue problem with PMRRR.
+    if( GetHermitianTridiagEigApproach() !=
+        HERMITIAN_TRIDIAG_EIG_DIVIDE_AND_CONQUER )
     {
         std::vector<R> wVector(n);
         pmrrr::Eig
@@ -873,6 +1081,10 @@ void HermitianEig
         for( int iLocal=0; iLocal<w.LocalHeight(); ++iLocal )
             w.SetLocal(iLocal,0,wVector[iLocal]);
     }
+    else
+#endif // ifdef HAVE_PMRRR
+        HermitianTridiagEig
+        ( d_STAR_STAR, e_STAR_STAR, w, lowerBound, upperBound );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -900,8 +1112,6 @@ void HermitianEig
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square");
 
-    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
-
     const int n = A.Height();
     const Grid& g = A.Grid();
 
@@ -921,24 +1131,18 @@ void HermitianEig
     if( needRescaling )
         ScaleTrapezoid( scale, LEFT, uplo, 0, A );
 
-    // Tridiagonalize A
-    HermitianTridiag( uplo, A );
-
-    // Grab copies of the diagonal and subdiagonal of A
-    DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
-                          e_MD_STAR( n-1, 1, g );
-    A.GetDiagonal( d_MD_STAR );
-    A.GetDiagonal( e_MD_STAR, subdiagonal );
-
-    // In order to call pmrrr, we need full copies of the diagonal and 
-    // subdiagonal in vectors of length n. We accomplish this for e by 
-    // making its leading dimension n.
+    // Tridiagonalize A. In order to call pmrrr, we need full copies of the 
+    // diagonal and subdiagonal in vectors of length n. We accomplish this 
+    // for e by making its leading dimension n.
     DistMatrix<R,STAR,STAR> d_STAR_STAR( n,   1,    g ),
                             e_STAR_STAR( n-1, 1, n, g );
-    d_STAR_STAR = d_MD_STAR;
-    e_STAR_STAR = e_MD_STAR;
+    HermitianTridiagBulges<R> bulges;
+    hermitian_eig::Tridiagonalize( uplo, A, d_STAR_STAR, e_STAR_STAR, bulges );
 
+#ifdef HAVE_PMRRR
     // Solve the tridiagonal eigenvalue problem with PMRRR.
+    if( GetHermitianTridiagEigApproach() !=
+        HERMITIAN_TRIDIAG_EIG_DIVIDE_AND_CONQUER )
     {
         std::vector<R> wVector(n);
         pmrrr::Info info = pmrrr::Eig
@@ -951,6 +1155,10 @@ void HermitianEig
         for( int iLocal=0; iLocal<w.LocalHeight(); ++iLocal )
             w.SetLocal(iLocal,0,wVector[iLocal]);
     }
+    else
+#endif // ifdef HAVE_PMRRR
+        HermitianTridiagEig
+        ( d_STAR_STAR, e_STAR_STAR, w, lowerBound, upperBound );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling ) 
@@ -960,25 +1168,24 @@ void HermitianEig
 #endif
 }
 
-//----------------------------------------------------------------------------//
-// Grab the full set of eigenpairs of the complex, Hermitian matrix A         //
-//----------------------------------------------------------------------------//
-void HermitianEig
+namespace hermitian_eig {
+
+// Compute the full set of eigenpairs of the complex, Hermitian matrix A
+// through tridiagonalization, regardless of the HermitianEigApproach
+void TridiagEig
 ( UpperOrLower uplo, 
   DistMatrix<Complex<double> >& A,
   DistMatrix<double,VR,STAR>& w,
   DistMatrix<Complex<double> >& paddedZ )
 {
 #ifndef RELEASE
-    PushCallStack("HermitianEig");
+    PushCallStack("hermitian_eig::TridiagEig");
 #endif
     typedef double R;
     typedef Complex<double> C;
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square");
 
-    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
-
     const int n = A.Height();
     const int k = n; // full set of eigenpairs
     const Grid& g = A.Grid();
@@ -1023,26 +1230,21 @@ void HermitianEig
     if( needRescaling )
         ScaleTrapezoid( C(scale), LEFT, uplo, 0, A );
 
-    // Tridiagonalize A
+    // Tridiagonalize A. In order to call pmrrr, we need full copies of the 
+    // diagonal and subdiagonal in vectors of length n. We accomplish this 
+    // for e by making its leading dimension n.
     DistMatrix<C,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t );
-
-    // Grab copies of the diagonal and subdiagonal of A
-    DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
-                          e_MD_STAR( n-1, 1, g );
-    A.GetRealPartOfDiagonal( d_MD_STAR );
-    A.GetRealPartOfDiagonal( e_MD_STAR, subdiagonal );
-
-    // In order to call pmrrr, we need full copies of the diagonal and 
-    // subdiagonal in vectors of length n. We accomplish this for e by 
-    // making its leading dimension n.
     DistMatrix<R,STAR,STAR> d_STAR_STAR( n,   1,    g ),
                             e_STAR_STAR( n-1, 1, n, g );
-    d_STAR_STAR = d_MD_STAR;
-    e_STAR_STAR = e_MD_STAR;
+    HermitianTridiagBulges<C> bulges;
+    hermitian_eig::Tridiagonalize
+    ( uplo, A, t, d_STAR_STAR, e_STAR_STAR, bulges );
 
+#ifdef HAVE_PMRRR
     // Solve the tridiagonal eigenvalue problem with PMRRR into Z[* ,VR]
     // then redistribute into Z[MC,MR] in place, panel by panel
+    if( GetHermitianTridiagEigApproach() !=
+        HERMITIAN_TRIDIAG_EIG_DIVIDE_AND_CONQUER )
     {
         // Grab a pointer into the paddedZ local matrix
         R* paddedZBuffer = (R*)paddedZ.Buffer();
@@ -1104,17 +1306,13 @@ void HermitianEig
         }
         PopBlocksizeStack();
     }
+    else
+#endif // ifdef HAVE_PMRRR
+        hermitian_eig::DivideAndConquer( d_STAR_STAR, e_STAR_STAR, w, paddedZ );
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() ); 
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
+    hermitian_eig::Backtransform( uplo, A, t, bulges, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -1124,6 +1322,29 @@ void HermitianEig
 #endif
 }
 
+} // namespace hermitian_eig
+
+//----------------------------------------------------------------------------//
+// Grab the full set of eigenpairs of the complex, Hermitian matrix A         //
+//----------------------------------------------------------------------------//
+void HermitianEig
+( UpperOrLower uplo, 
+  DistMatrix<Complex<double> >& A,
+  DistMatrix<double,VR,STAR>& w,
+  DistMatrix<Complex<double> >& paddedZ )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#endif
+    if( hermitian_eig::UseSDC( A ) )
+        hermitian_eig::SDC( uplo, A, w, paddedZ );
+    else
+        hermitian_eig::TridiagEig( uplo, A, w, paddedZ );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 //----------------------------------------------------------------------------//
 // Grab a partial set of eigenpairs of the complex, Hermitian n x n matrix A. //
 // The partial set is determined by the inclusive zero-indexed range          //
@@ -1145,8 +1366,6 @@ void HermitianEig
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square");
 
-    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
-
     const int n = A.Height();
     const int k = (upperBound - lowerBound) + 1;
     const Grid& g = A.Grid();
@@ -1191,26 +1410,21 @@ void HermitianEig
     if( needRescaling )
         ScaleTrapezoid( C(scale), LEFT, uplo, 0, A );
 
-    // Tridiagonalize A
+    // Tridiagonalize A. In order to call pmrrr, we need full copies of the 
+    // diagonal and subdiagonal in vectors of length n. We accomplish this 
+    // for e by making its leading dimension n.
     DistMatrix<C,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t );
-
-    // Grab copies of the diagonal and subdiagonal of A
-    DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
-                          e_MD_STAR( n-1, 1, g );
-    A.GetRealPartOfDiagonal( d_MD_STAR );
-    A.GetRealPartOfDiagonal( e_MD_STAR, subdiagonal );
-
-    // In order to call pmrrr, we need full copies of the diagonal and 
-    // subdiagonal in vectors of length n. We accomplish this for e by 
-    // making its leading dimension n.
     DistMatrix<R,STAR,STAR> d_STAR_STAR( n,   1,    g ),
                             e_STAR_STAR( n-1, 1, n, g );
-    d_STAR_STAR = d_MD_STAR;
-    e_STAR_STAR = e_MD_STAR;
+    HermitianTridiagBulges<C> bulges;
+    hermitian_eig::Tridiagonalize
+    ( uplo, A, t, d_STAR_STAR, e_STAR_STAR, bulges );
 
+#ifdef HAVE_PMRRR
     // Solve the tridiagonal eigenvalue problem with PMRRR into Z[* ,VR]
     // then redistribute into Z[MC,MR]
+    if( GetHermitianTridiagEigApproach() !=
+        HERMITIAN_TRIDIAG_EIG_DIVIDE_AND_CONQUER )
     {
         // Grab a pointer into the paddedZ local matrix
         R* paddedZBuffer = (R*)paddedZ.Buffer();
@@ -1273,17 +1487,14 @@ void HermitianEig
         }
         PopBlocksizeStack();
     }
+    else
+#endif // ifdef HAVE_PMRRR
+        hermitian_eig::DivideAndConquer
+        ( d_STAR_STAR, e_STAR_STAR, w, paddedZ, lowerBound, upperBound );
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() );
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
+    hermitian_eig::Backtransform( uplo, A, t, bulges, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -1312,8 +1523,6 @@ void HermitianEig
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square");
 
-    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
-
     const int n = A.Height();
     const Grid& g = A.Grid();
 
@@ -1350,26 +1559,21 @@ void HermitianEig
     if( needRescaling )
         ScaleTrapezoid( C(scale), LEFT, uplo, 0, A );
 
-    // Tridiagonalize A
+    // Tridiagonalize A. In order to call pmrrr, we need full copies of the 
+    // diagonal and subdiagonal in vectors of length n. We accomplish this 
+    // for e by making its leading dimension n.
     DistMatrix<C,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t );
-
-    // Grab copies of the diagonal and subdiagonal of A
-    DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
-                          e_MD_STAR( n-1, 1, g );
-    A.GetRealPartOfDiagonal( d_MD_STAR );
-    A.GetRealPartOfDiagonal( e_MD_STAR, subdiagonal );
-
-    // In order to call pmrrr, we need full copies of the diagonal and 
-    // subdiagonal in vectors of length n. We accomplish this for e by 
-    // making its leading dimension n.
     DistMatrix<R,STAR,STAR> d_STAR_STAR( n,   1,    g ),
                             e_STAR_STAR( n-1, 1, n, g );
-    d_STAR_STAR = d_MD_STAR;
-    e_STAR_STAR = e_MD_STAR;
+    HermitianTridiagBulges<C> bulges;
+    hermitian_eig::Tridiagonalize
+    ( uplo, A, t, d_STAR_STAR, e_STAR_STAR, bulges );
 
+#ifdef HAVE_PMRRR
     // Solve the tridiagonal eigenvalue problem with PMRRR into Z[* ,VR]
     // then redistribute into Z[MC,MR]
+    if( GetHermitianTridiagEigApproach() !=
+        HERMITIAN_TRIDIAG_EIG_DIVIDE_AND_CONQUER )
     {
         // Get an estimate of the amount of memory to allocate
         std::vector<R> dVector(n), eVector(n), wVector(n);
@@ -1453,17 +1657,14 @@ void HermitianEig
         }
         PopBlocksizeStack();
     }
+    else
+#endif // ifdef HAVE_PMRRR
+        hermitian_eig::DivideAndConquer
+        ( d_STAR_STAR, e_STAR_STAR, w, paddedZ, lowerBound, upperBound );
 
     // Backtransform the tridiagonal eigenvectors, Z
     paddedZ.ResizeTo( A.Height(), w.Height() );
-    if( uplo == LOWER )
-        ApplyPackedReflectors
-        ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
-    else
-        ApplyPackedReflectors
-        ( LEFT, UPPER, VERTICAL, FORWARD, UNCONJUGATED, 
-          subdiagonal, A, t, paddedZ );
+    hermitian_eig::Backtransform( uplo, A, t, bulges, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -1473,24 +1674,23 @@ void HermitianEig
 #endif
 }
 
-//----------------------------------------------------------------------------//
-// Grab the full set of eigenvalues of the complex, Hermitian matrix A        //
-//----------------------------------------------------------------------------//
-void HermitianEig
+namespace hermitian_eig {
+
+// Compute the full set of eigenvalues of the complex, Hermitian matrix A
+// through tridiagonalization, regardless of the HermitianEigApproach
+void TridiagEig
 ( UpperOrLower uplo, 
   DistMatrix<Complex<double> >& A,
   DistMatrix<        double, VR,STAR>& w )
 {
 #ifndef RELEASE
-    PushCallStack("HermitianEig");
+    PushCallStack("hermitian_eig::TridiagEig");
 #endif
     typedef double R;
     typedef Complex<double> C;
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square");
 
-    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
-
     const int n = A.Height();
     const int k = n;
     const Grid& g = A.Grid();
@@ -1515,25 +1715,20 @@ void HermitianEig
     if( needRescaling )
         ScaleTrapezoid( C(scale), LEFT, uplo, 0, A );
 
-    // Tridiagonalize A
+    // Tridiagonalize A. In order to call pmrrr, we need full copies of the 
+    // diagonal and subdiagonal in vectors of length n. We accomplish this 
+    // for e by making its leading dimension n.
     DistMatrix<C,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t );
-
-    // Grab copies of the diagonal and subdiagonal of A
-    DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
-                          e_MD_STAR( n-1, 1, g );
-    A.GetRealPartOfDiagonal( d_MD_STAR );
-    A.GetRealPartOfDiagonal( e_MD_STAR, subdiagonal );
-
-    // In order to call pmrrr, we need full copies of the diagonal and 
-    // subdiagonal in vectors of length n. We accomplish this for e by 
-    // making its leading dimension n.
     DistMatrix<R,STAR,STAR> d_STAR_STAR( n,   1,    g ),
                             e_STAR_STAR( n-1, 1, n, g );
-    d_STAR_STAR = d_MD_STAR;
-    e_STAR_STAR = e_MD_STAR;
+    HermitianTridiagBulges<C> bulges;
+    hermitian_eig::Tridiagonalize
+    ( uplo, A, t, d_STAR_STAR, e_STAR_STAR, bulges );
 
+#ifdef HAVE_PMRRR
     // Solve the tridiagonal eigenvalue problem with PMRRR
+    if( GetHermitianTridiagEigApproach() !=
+        HERMITIAN_TRIDIAG_EIG_DIVIDE_AND_CONQUER )
     {
         std::vector<R> wVector(n);
         pmrrr::Eig
@@ -1544,6 +1739,9 @@ void HermitianEig
         for( int iLocal=0; iLocal<w.LocalHeight(); ++iLocal )
             w.SetLocal(iLocal,0,wVector[iLocal]);
     }
+    else
+#endif // ifdef HAVE_PMRRR
+        HermitianTridiagEig( d_STAR_STAR, e_STAR_STAR, w );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -1553,6 +1751,28 @@ void HermitianEig
 #endif
 }
 
+} // namespace hermitian_eig
+
+//----------------------------------------------------------------------------//
+// Grab the full set of eigenvalues of the complex, Hermitian matrix A        //
+//----------------------------------------------------------------------------//
+void HermitianEig
+( UpperOrLower uplo, 
+  DistMatrix<Complex<double> >& A,
+  DistMatrix<        double, VR,STAR>& w )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianEig");
+#endif
+    if( hermitian_eig::UseSDC( A ) )
+        hermitian_eig::SDC( uplo, A, w );
+    else
+        hermitian_eig::TridiagEig( uplo, A, w );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 //----------------------------------------------------------------------------//
 // Grab a partial set of eigenvalues of the complex, Hermitian n x n matrix A.//
 // The partial set is determined by the inclusive zero-indexed range          //
@@ -1573,8 +1793,6 @@ void HermitianEig
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square");
 
-    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
-
     const int n = A.Height();
     const int k = (upperBound - lowerBound) + 1;
     const Grid& g = A.Grid();
@@ -1599,25 +1817,20 @@ void HermitianEig
     if( needRescaling )
         ScaleTrapezoid( C(scale), LEFT, uplo, 0, A );
 
-    // Tridiagonalize A
+    // Tridiagonalize A. In order to call pmrrr, we need full copies of the 
+    // diagonal and subdiagonal in vectors of length n. We accomplish this 
+    // for e by making its leading dimension n.
     DistMatrix<C,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t );
-
-    // Grab copies of the diagonal and subdiagonal of A
-    DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
-                          e_MD_STAR( n-1, 1, g );
-    A.GetRealPartOfDiagonal( d_MD_STAR );
-    A.GetRealPartOfDiagonal( e_MD_STAR, subdiagonal );
-
-    // In order to call pmrrr, we need full copies of the diagonal and 
-    // subdiagonal in vectors of length n. We accomplish this for e by 
-    // making its leading dimension n.
     DistMatrix<R,STAR,STAR> d_STAR_STAR( n,   1,    g ),
                             e_STAR_STAR( n-1, 1, n, g );
-    d_STAR_STAR = d_MD_STAR;
-    e_STAR_STAR = e_MD_STAR;
+    HermitianTridiagBulges<C> bulges;
+    hermitian_eig::Tridiagonalize
+    ( uplo, A, t, d_STAR_STAR, e_STAR_STAR, bulges );
 
+#ifdef HAVE_PMRRR
     // Solve the tridiagonal eigenvalue problem with PMRRR
+    if( GetHermitianTridiagEigApproach() !=
+        HERMITIAN_TRIDIAG_EIG_DIVIDE_AND_CONQUER )
     {
         std::vector<R> wVector(n);
         pmrrr::Eig
@@ -1628,6 +1841,10 @@ void HermitianEig
         for( int iLocal=0; iLocal<w.LocalHeight(); ++iLocal )
             w.SetLocal(iLocal,0,wVector[iLocal]);
     }
+    else
+#endif // ifdef HAVE_PMRRR
+        HermitianTridiagEig
+        ( d_STAR_STAR, e_STAR_STAR, w, lowerBound, upperBound );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -1655,8 +1872,6 @@ void HermitianEig
     if( A.Height() != A.Width() )
         throw std::logic_error("Hermitian matrices must be square");
 
-    const int subdiagonal = ( uplo==LOWER ? -1 : +1 );
-
     const int n = A.Height();
     const Grid& g = A.Grid();
 
@@ -1676,25 +1891,20 @@ void HermitianEig
     if( needRescaling )
         ScaleTrapezoid( C(scale), LEFT, uplo, 0, A );
 
-    // Tridiagonalize A
+    // Tridiagonalize A. In order to call pmrrr, we need full copies of the 
+    // diagonal and subdiagonal in vectors of length n. We accomplish this 
+    // for e by making its leading dimension n.
     DistMatrix<C,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t );
-
-    // Grab copies of the diagonal and subdiagonal of A
-    DistMatrix<R,MD,STAR> d_MD_STAR( n,   1, g ),
-                          e_MD_STAR( n-1, 1, g );
-    A.GetRealPartOfDiagonal( d_MD_STAR );
-    A.GetRealPartOfDiagonal( e_MD_STAR, subdiagonal );
-
-    // In order to call pmrrr, we need full copies of the diagonal and 
-    // subdiagonal in vectors of length n. We accomplish this for e by 
-    // making its leading dimension n.
     DistMatrix<R,STAR,STAR> d_STAR_STAR( n,   1,    g ),
                             e_STAR_STAR( n-1, 1, n, g );
-    d_STAR_STAR = d_MD_STAR;
-    e_STAR_STAR = e_MD_STAR;
+    HermitianTridiagBulges<C> bulges;
+    hermitian_eig::Tridiagonalize
+    ( uplo, A, t, d_STAR_STAR, e_STAR_STAR, bulges );
 
+#ifdef HAVE_PMRRR
     // Solve the tridiagonal eigenvalue problem with PMRRR
+    if( GetHermitianTridiagEigApproach() !=
+        HERMITIAN_TRIDIAG_EIG_DIVIDE_AND_CONQUER )
     {
         std::vector<R> wVector(n);
         pmrrr::Info info = pmrrr::Eig
@@ -1707,6 +1917,10 @@ void HermitianEig
         for( int iLocal=0; iLocal<w.LocalHeight(); ++iLocal )
             w.SetLocal(iLocal,0,wVector[iLocal]);
     }
+    else
+#endif // ifdef HAVE_PMRRR
+        HermitianTridiagEig
+        ( d_STAR_STAR, e_STAR_STAR, w, lowerBound, upperBound );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -1719,5 +1933,3 @@ void HermitianEig
 #undef TARGET_CHUNKS
 
 } // namespace elem
-
-#endif // ifdef HAVE_PMRRR
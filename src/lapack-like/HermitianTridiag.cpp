@@ -7,6 +7,8 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/lapack-like/ApplyPackedReflectors.hpp"
 
 #include "./HermitianTridiag/PanelL.hpp"
 #include "./HermitianTridiag/PanelLSquare.hpp"
@@ -16,9 +18,50 @@
 #include "./HermitianTridiag/LSquare.hpp"
 #include "./HermitianTridiag/U.hpp"
 #include "./HermitianTridiag/USquare.hpp"
+#include "./HermitianTridiag/LBand.hpp"
+#include "./HermitianTridiag/BandToTridiag.hpp"
 
 namespace elem {
 
+namespace hermitian_tridiag {
+
+template<typename R>
+inline void
+ReduceToBand( DistMatrix<R>& A, DistMatrix<R,STAR,STAR>& t, int bandwidth )
+{
+    LBand( A, bandwidth );
+    t.ResizeTo( 0, 1 );
+}
+
+template<typename R>
+inline void
+ReduceToBand
+( DistMatrix<Complex<R> >& A, DistMatrix<Complex<R>,STAR,STAR>& t, 
+  int bandwidth )
+{ LBand( A, t, bandwidth ); }
+
+template<typename R>
+inline void
+ApplyBand
+( const DistMatrix<R>& A, const DistMatrix<R,STAR,STAR>& t, 
+  int bandwidth, DistMatrix<R>& Z )
+{
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, -bandwidth, A, Z );
+}
+
+template<typename R>
+inline void
+ApplyBand
+( const DistMatrix<Complex<R> >& A, const DistMatrix<Complex<R>,STAR,STAR>& t,
+  int bandwidth, DistMatrix<Complex<R> >& Z )
+{
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, BACKWARD, UNCONJUGATED, -bandwidth, A, t, Z );
+}
+
+} // namespace hermitian_tridiag
+
 template<typename R>
 void HermitianTridiag( UpperOrLower uplo, Matrix<R>& A )
 {
@@ -64,6 +107,9 @@ HermitianTridiag( UpperOrLower uplo, DistMatrix<R>& A )
     const Grid& g = A.Grid();
     const HermitianTridiagApproach approach = GetHermitianTridiagApproach();
     const GridOrder order = GetHermitianTridiagGridOrder();
+    if( approach == HERMITIAN_TRIDIAG_TWO_STAGE )
+        throw std::logic_error
+        ("The two-stage approach requires HermitianTridiagTwoStage");
     if( approach == HERMITIAN_TRIDIAG_NORMAL )
     {
         // Use the pipelined algorithm for nonsquare meshes
@@ -114,7 +160,7 @@ HermitianTridiag( UpperOrLower uplo, DistMatrix<R>& A )
     else
     {
         // Use the normal approach unless we're already on a square 
-        // grid, in which case we use the fast square method.
+        // grid, in which case we use the fast square method
         if( g.Height() == g.Width() )
         {
             if( uplo == LOWER )
@@ -150,6 +196,9 @@ HermitianTridiag
     const Grid& g = A.Grid();
     const HermitianTridiagApproach approach = GetHermitianTridiagApproach();
     const GridOrder order = GetHermitianTridiagGridOrder();
+    if( approach == HERMITIAN_TRIDIAG_TWO_STAGE )
+        throw std::logic_error
+        ("The two-stage approach requires HermitianTridiagTwoStage");
     if( approach == HERMITIAN_TRIDIAG_NORMAL )
     {
         // Use the pipelined algorithm for nonsquare meshes
@@ -202,7 +251,7 @@ HermitianTridiag
     else
     {
         // Use the normal approach unless we're already on a square 
-        // grid, in which case we use the fast square method.
+        // grid, in which case we use the fast square method
         if( g.Height() == g.Width() )
         {
             if( uplo == LOWER )
@@ -223,20 +272,142 @@ HermitianTridiag
 #endif
 }
 
+//
+// Reduce A to banded form using BLAS-3 operations and then chase the bulges
+// out of a replicated copy of the band. On exit, d and e hold the diagonal 
+// and subdiagonal of the real symmetric tridiagonal matrix, the lower band 
+// of A holds the intermediate banded matrix, the Householder vectors of the 
+// first stage are stored below the band of A (with their scalars in t in 
+// the complex case), and 'bulges' holds what is needed to regenerate the 
+// reflectors of the second stage.
+//
+template<typename F>
+void HermitianTridiagTwoStage
+( UpperOrLower uplo, 
+  DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t,
+  DistMatrix<typename Base<F>::type,STAR,STAR>& d,
+  DistMatrix<typename Base<F>::type,STAR,STAR>& e,
+  HermitianTridiagBulges<F>& bulges )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianTridiagTwoStage");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( A.Grid() != t.Grid() || A.Grid() != d.Grid() || A.Grid() != e.Grid() )
+        throw std::logic_error("{A,t,d,e} must share the same grid");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int bandwidth = 
+        std::max(1,std::min(GetHermitianTridiagBandwidth(),n-1));
+    d.ResizeTo( n, 1 );
+    e.ResizeTo( std::max(n-1,0), 1 );
+    if( n == 0 )
+    {
+        t.ResizeTo( 0, 1 );
+        bulges.height = 0;
+        bulges.bandwidth = bandwidth;
+        bulges.sweepOffsets.assign( 1, 0 );
+        bulges.checkpoints.clear();
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    // The first stage only works with the lower triangle
+    if( uplo == UPPER )
+        MakeHermitian( UPPER, A );
+    hermitian_tridiag::ReduceToBand( A, t, bandwidth );
+
+    // Replicate the band
+    const int ld = 2*bandwidth;
+    const int bandSize = (ld+1)*n;
+    std::vector<F> band( bandSize, F(0) );
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const int i = colShift + iLocal*colStride;
+            if( i >= j && i-j <= bandwidth )
+                band[i+j*ld] = A.GetLocal(iLocal,jLocal);
+        }
+    }
+    mpi::AllReduce( &band[0], bandSize, mpi::SUM, g.VCComm() );
+
+    hermitian_tridiag::BandToTridiag( n, bandwidth, band, bulges );
+    for( int j=0; j<n; ++j )
+        d.SetLocal( j, 0, RealPart(band[j+j*ld]) );
+    for( int j=0; j<n-1; ++j )
+        e.SetLocal( j, 0, RealPart(band[j+1+j*ld]) );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+void ApplyHermitianTridiagBulges
+( const HermitianTridiagBulges<F>& bulges, Matrix<F>& Z )
+{
+#ifndef RELEASE
+    PushCallStack("ApplyHermitianTridiagBulges");
+#endif
+    hermitian_tridiag::ApplyBulges( bulges, Z );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename F>
+void ApplyHermitianTridiagBand
+( const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& t,
+  const HermitianTridiagBulges<F>& bulges, DistMatrix<F>& Z )
+{
+#ifndef RELEASE
+    PushCallStack("ApplyHermitianTridiagBand");
+    if( A.Height() != Z.Height() )
+        throw std::logic_error("A and Z must be the same height");
+#endif
+    if( A.Height() > bulges.bandwidth )
+        hermitian_tridiag::ApplyBand( A, t, bulges.bandwidth, Z );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
 #ifndef DISABLE_FLOAT
 template void HermitianTridiag<float>( UpperOrLower uplo, Matrix<float>& A );
 template void HermitianTridiag<float>( UpperOrLower uplo, DistMatrix<float>& A );
+template void HermitianTridiagTwoStage( UpperOrLower uplo, DistMatrix<float>& A, DistMatrix<float,STAR,STAR>& t, DistMatrix<float,STAR,STAR>& d, DistMatrix<float,STAR,STAR>& e, HermitianTridiagBulges<float>& bulges );
+template void ApplyHermitianTridiagBulges( const HermitianTridiagBulges<float>& bulges, Matrix<float>& Z );
+template void ApplyHermitianTridiagBand( const DistMatrix<float>& A, const DistMatrix<float,STAR,STAR>& t, const HermitianTridiagBulges<float>& bulges, DistMatrix<float>& Z );
 #ifndef DISABLE_COMPLEX
 template void HermitianTridiag<float>( UpperOrLower uplo, Matrix<Complex<float> >& A, Matrix<Complex<float> >& t );
 template void HermitianTridiag<float>( UpperOrLower uplo, DistMatrix<Complex<float> >& A, DistMatrix<Complex<float>,STAR,STAR>& t );
+template void HermitianTridiagTwoStage( UpperOrLower uplo, DistMatrix<Complex<float> >& A, DistMatrix<Complex<float>,STAR,STAR>& t, DistMatrix<float,STAR,STAR>& d, DistMatrix<float,STAR,STAR>& e, HermitianTridiagBulges<Complex<float> >& bulges );
+template void ApplyHermitianTridiagBulges( const HermitianTridiagBulges<Complex<float> >& bulges, Matrix<Complex<float> >& Z );
+template void ApplyHermitianTridiagBand( const DistMatrix<Complex<float> >& A, const DistMatrix<Complex<float>,STAR,STAR>& t, const HermitianTridiagBulges<Complex<float> >& bulges, DistMatrix<Complex<float> >& Z );
 #endif // ifndef DISABLE_COMPLEX
 #endif // ifndef DISABLE_FLOAT
 
 template void HermitianTridiag<double>( UpperOrLower uplo, Matrix<double>& A );
 template void HermitianTridiag<double>( UpperOrLower uplo, DistMatrix<double>& A );
+template void HermitianTridiagTwoStage( UpperOrLower uplo, DistMatrix<double>& A, DistMatrix<double,STAR,STAR>& t, DistMatrix<double,STAR,STAR>& d, DistMatrix<double,STAR,STAR>& e, HermitianTridiagBulges<double>& bulges );
+template void ApplyHermitianTridiagBulges( const HermitianTridiagBulges<double>& bulges, Matrix<double>& Z );
+template void ApplyHermitianTridiagBand( const DistMatrix<double>& A, const DistMatrix<double,STAR,STAR>& t, const HermitianTridiagBulges<double>& bulges, DistMatrix<double>& Z );
 #ifndef DISABLE_COMPLEX
 template void HermitianTridiag<double>( UpperOrLower uplo, Matrix<Complex<double> >& A, Matrix<Complex<double> >& t );
 template void HermitianTridiag<double>( UpperOrLower uplo, DistMatrix<Complex<double> >& A, DistMatrix<Complex<double>,STAR,STAR>& t );
+template void HermitianTridiagTwoStage( UpperOrLower uplo, DistMatrix<Complex<double> >& A, DistMatrix<Complex<double>,STAR,STAR>& t, DistMatrix<double,STAR,STAR>& d, DistMatrix<double,STAR,STAR>& e, HermitianTridiagBulges<Complex<double> >& bulges );
+template void ApplyHermitianTridiagBulges( const HermitianTridiagBulges<Complex<double> >& bulges, Matrix<Complex<double> >& Z );
+template void ApplyHermitianTridiagBand( const DistMatrix<Complex<double> >& A, const DistMatrix<Complex<double>,STAR,STAR>& t, const HermitianTridiagBulges<Complex<double> >& bulges, DistMatrix<Complex<double> >& Z );
 #endif // ifndef DISABLE_COMPLEX
 
 } // namespace elem
@@ -0,0 +1,236 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef LAPACK_HERMITIANTRIDIAG_BANDTOTRIDIAG_HPP
+#define LAPACK_HERMITIANTRIDIAG_BANDTOTRIDIAG_HPP
+
+#include "elemental/lapack-like/Reflector.hpp"
+
+#include <cmath>
+
+//
+// The lower triangle of a Hermitian band matrix of bandwidth nb is stored in
+// a buffer of size (2nb+1) x n such that entry (i,j), 0 <= i-j <= 2nb, lives
+// at position i + j*2nb. Each column of the band is therefore contiguous and
+// any block lying within the band (including the fill created by the bulges)
+// can be handed directly to the BLAS with a leading dimension of 2nb.
+//
+
+namespace elem {
+namespace hermitian_tridiag {
+
+// The reflectors generated by a range of sweeps, in the order they were
+// generated. Reflector k acts on rows [offsets[2k],offsets[2k]+offsets[2k+1])
+// and its Householder vector (minus the implicit unit) is stored
+// contiguously in 'vectors'.
+template<typename F>
+struct BulgeReflectors
+{
+    std::vector<int> offsets;
+    std::vector<F> taus, vectors;
+};
+
+//
+// Chase the bulge created by annihilating column j of the band down to the
+// bottom-right corner of the matrix. If 'reflectors' is non-NULL, the
+// generated Householder transformations are appended to it.
+//
+template<typename F>
+inline void
+ChaseSweep
+( int n, int bandwidth, int j, F* band, BulgeReflectors<F>* reflectors )
+{
+    const int ld = 2*bandwidth;
+    std::vector<F> u(bandwidth,0), w(bandwidth,0);
+
+    int col = j, rowBeg = j+1, prevLen = 0;
+    while( rowBeg < n )
+    {
+        const int len = std::min(bandwidth,n-rowBeg);
+        const bool first = ( prevLen == 0 );
+        // A complex subdiagonal entry must still be made real
+        if( len < 2 && !(first && IsComplex<F>::val) )
+            break;
+
+        // Annihilate band(rowBeg+1:rowBeg+len-1,col)
+        F* chi = &band[rowBeg+col*ld];
+        const F tau = Reflector( chi[0], len-1, &chi[1], 1 );
+        u[0] = 1;
+        for( int i=1; i<len; ++i )
+        {
+            u[i] = chi[i];
+            chi[i] = 0;
+        }
+
+        // Apply H^H from the left to the remainder of the previous bulge
+        if( !first && prevLen > 1 )
+        {
+            F* B = &band[rowBeg+(col+1)*ld];
+            blas::Gemv
+            ( 'C', len, prevLen-1, F(1), B, ld, &u[0], 1, F(0), &w[0], 1 );
+            blas::Gerc
+            ( len, prevLen-1, -Conj(tau), &u[0], 1, &w[0], 1, B, ld );
+        }
+
+        // Apply H from both sides to the diagonal block
+        F* D = &band[rowBeg+rowBeg*ld];
+        blas::Hemv( 'L', len, tau, D, ld, &u[0], 1, F(0), &w[0], 1 );
+        const F alpha = -tau*blas::Dot( len, &w[0], 1, &u[0], 1 )/F(2);
+        blas::Axpy( len, alpha, &u[0], 1, &w[0], 1 );
+        blas::Her2( 'L', len, F(-1), &u[0], 1, &w[0], 1, D, ld );
+
+        // Apply H from the right to the block below, creating the next bulge
+        const int belowHeight = std::min(bandwidth,n-rowBeg-len);
+        if( belowHeight > 0 )
+        {
+            F* C = &band[rowBeg+len+rowBeg*ld];
+            blas::Gemv
+            ( 'N', belowHeight, len, F(1), C, ld, &u[0], 1, F(0), &w[0], 1 );
+            blas::Gerc( belowHeight, len, -tau, &w[0], 1, &u[0], 1, C, ld );
+        }
+
+        if( reflectors != 0 )
+        {
+            reflectors->offsets.push_back( rowBeg );
+            reflectors->offsets.push_back( len );
+            reflectors->taus.push_back( tau );
+            reflectors->vectors.insert
+            ( reflectors->vectors.end(), u.begin()+1, u.begin()+len );
+        }
+
+        prevLen = len;
+        col = rowBeg;
+        rowBeg += len;
+    }
+}
+
+//
+// Reduce the (replicated) band to real symmetric tridiagonal form, saving
+// a copy of the band before each chunk of sweeps. Storing every reflector
+// would require O(n^2) memory on each process; with roughly
+// sqrt(n/(2nb+1)) chunks, the checkpoints and the reflectors of a single
+// chunk both require O(n^{3/2} nb^{1/2}).
+//
+template<typename F>
+inline void
+BandToTridiag
+( int n, int bandwidth, std::vector<F>& band,
+  HermitianTridiagBulges<F>& bulges )
+{
+#ifndef RELEASE
+    PushCallStack("hermitian_tridiag::BandToTridiag");
+#endif
+    const int ldab = 2*bandwidth+1;
+    const int bandSize = ldab*n;
+    const int numSweeps = std::max(n-1,0);
+    const int numChunks =
+        std::max(1,int(std::sqrt(double(numSweeps)/double(ldab))));
+    const int chunkSize = (numSweeps+numChunks-1)/numChunks;
+
+    bulges.height = n;
+    bulges.bandwidth = bandwidth;
+    bulges.sweepOffsets.resize( numChunks+1 );
+    bulges.checkpoints.resize( numChunks*bandSize );
+    for( int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const int sweepBeg = std::min(chunk*chunkSize,numSweeps);
+        const int sweepEnd = std::min(sweepBeg+chunkSize,numSweeps);
+        bulges.sweepOffsets[chunk] = sweepBeg;
+        MemCopy( &bulges.checkpoints[chunk*bandSize], &band[0], bandSize );
+        for( int j=sweepBeg; j<sweepEnd; ++j )
+            ChaseSweep( n, bandwidth, j, &band[0], (BulgeReflectors<F>*)0 );
+    }
+    bulges.sweepOffsets[numChunks] = numSweeps;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// Z := Q2 Z, where Q2 = H_0 H_1 ... H_{m-1} is the product of the bulge-
+// chasing reflectors in the order they were generated. The chunks are
+// processed in reverse order, each by regenerating its reflectors from the
+// corresponding checkpoint and then applying them (in reverse) to column
+// panels of Z.
+//
+template<typename F>
+inline void
+ApplyBulges( const HermitianTridiagBulges<F>& bulges, Matrix<F>& Z )
+{
+#ifndef RELEASE
+    PushCallStack("hermitian_tridiag::ApplyBulges");
+    if( Z.Height() != bulges.height )
+        throw std::logic_error("Z is the wrong height");
+#endif
+    const int n = bulges.height;
+    const int bandwidth = bulges.bandwidth;
+    const int bandSize = (2*bandwidth+1)*n;
+    const int numChunks = bulges.sweepOffsets.size()-1;
+    const int width = Z.Width();
+    const int ldim = Z.LDim();
+    const int panelSize = Blocksize();
+    if( n == 0 || width == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    std::vector<F> band( bandSize, 0 ), w( panelSize, 0 );
+    for( int chunk=numChunks-1; chunk>=0; --chunk )
+    {
+        const int sweepBeg = bulges.sweepOffsets[chunk];
+        const int sweepEnd = bulges.sweepOffsets[chunk+1];
+        if( sweepBeg == sweepEnd )
+            continue;
+
+        BulgeReflectors<F> reflectors;
+        MemCopy( &band[0], &bulges.checkpoints[chunk*bandSize], bandSize );
+        for( int j=sweepBeg; j<sweepEnd; ++j )
+            ChaseSweep( n, bandwidth, j, &band[0], &reflectors );
+
+        const int numReflectors = reflectors.taus.size();
+        for( int jBeg=0; jBeg<width; jBeg+=panelSize )
+        {
+            const int nb = std::min(panelSize,width-jBeg);
+            int vecOffset = reflectors.vectors.size();
+            for( int k=numReflectors-1; k>=0; --k )
+            {
+                const int rowBeg = reflectors.offsets[2*k];
+                const int len = reflectors.offsets[2*k+1];
+                const F tau = reflectors.taus[k];
+                vecOffset -= len-1;
+
+                // Z1 := Z1 - tau [1; v] ([1; v]^H Z1)
+                F* Z1 = Z.Buffer( rowBeg, jBeg );
+                for( int jj=0; jj<nb; ++jj )
+                    w[jj] = Conj(Z1[jj*ldim]);
+                if( len > 1 )
+                {
+                    const F* v = &reflectors.vectors[vecOffset];
+                    blas::Gemv
+                    ( 'C', len-1, nb, 
+                      F(1), &Z1[1], ldim, v, 1, F(1), &w[0], 1 );
+                    blas::Gerc
+                    ( len-1, nb, -tau, v, 1, &w[0], 1, &Z1[1], ldim );
+                }
+                for( int jj=0; jj<nb; ++jj )
+                    Z1[jj*ldim] -= tau*Conj(w[jj]);
+            }
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace hermitian_tridiag
+} // namespace elem
+
+#endif // ifndef LAPACK_HERMITIANTRIDIAG_BANDTOTRIDIAG_HPP
@@ -0,0 +1,269 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef LAPACK_HERMITIANTRIDIAG_LBAND_HPP
+#define LAPACK_HERMITIANTRIDIAG_LBAND_HPP
+
+#include "elemental/blas-like/level1/MakeTrapezoidal.hpp"
+#include "elemental/blas-like/level1/SetDiagonal.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Hemm.hpp"
+#include "elemental/blas-like/level3/Herk.hpp"
+#include "elemental/blas-like/level3/Trsm.hpp"
+#include "elemental/lapack-like/ApplyPackedReflectors/Util.hpp"
+#include "elemental/lapack-like/QR.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+namespace elem {
+namespace hermitian_tridiag {
+
+//
+// Given the unit lower-trapezoidal Householder vectors V (and the inverse of
+// the upper-triangular matrix S such that Q = I - V S V^H), overwrite the
+// lower triangle of A with that of Q^H A Q using only BLAS-3 operations:
+//
+//   Y := A V S,
+//   X := Y - 1/2 V (S^H V^H Y),
+//   A := A - X V^H - V X^H.
+//
+template<typename F>
+inline void
+TwoSidedBandUpdate
+( const DistMatrix<F,VC,STAR>& V_VC_STAR,
+  const DistMatrix<F>& V,
+  const DistMatrix<F,STAR,STAR>& SInv_STAR_STAR,
+        DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    PushCallStack("hermitian_tridiag::TwoSidedBandUpdate");
+#endif
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int r = V.Width();
+
+    DistMatrix<F> Y(g);
+    DistMatrix<F,VC,  STAR> X_VC_STAR(g);
+    DistMatrix<F,MC,  STAR> V_MC_STAR(g), X_MC_STAR(g);
+    DistMatrix<F,MR,  STAR> V_MR_STAR(g), X_MR_STAR(g);
+    DistMatrix<F,STAR,STAR> Z_STAR_STAR(g);
+
+    Y.AlignWith( A );
+    Zeros( m, r, Y );
+    Hemm( LEFT, LOWER, F(1), A, V, F(0), Y );
+
+    X_VC_STAR.AlignWith( V_VC_STAR );
+    X_VC_STAR = Y;
+    Y.Empty();
+    LocalTrsm
+    ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), SInv_STAR_STAR, X_VC_STAR );
+
+    Zeros( r, r, Z_STAR_STAR );
+    Gemm
+    ( ADJOINT, NORMAL,
+      F(1), V_VC_STAR.LockedMatrix(), X_VC_STAR.LockedMatrix(),
+      F(0), Z_STAR_STAR.Matrix() );
+    Z_STAR_STAR.SumOverGrid();
+    Trsm
+    ( LEFT, UPPER, ADJOINT, NON_UNIT,
+      F(1), SInv_STAR_STAR.LockedMatrix(), Z_STAR_STAR.Matrix() );
+    Gemm
+    ( NORMAL, NORMAL,
+      F(-1)/F(2), V_VC_STAR.LockedMatrix(), Z_STAR_STAR.LockedMatrix(),
+      F(1),       X_VC_STAR.Matrix() );
+
+    V_MC_STAR.AlignWith( A );
+    V_MR_STAR.AlignWith( A );
+    X_MC_STAR.AlignWith( A );
+    X_MR_STAR.AlignWith( A );
+    V_MC_STAR = V_VC_STAR;
+    V_MR_STAR = V_VC_STAR;
+    X_MC_STAR = X_VC_STAR;
+    X_MR_STAR = X_VC_STAR;
+    LocalTrr2k
+    ( LOWER, ADJOINT, ADJOINT,
+      F(-1), V_MC_STAR, X_MR_STAR,
+             X_MC_STAR, V_MR_STAR,
+      F(1),  A );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// Reduce the lower triangle of A to a band of width 'bandwidth' by computing
+// the QR decomposition of each panel below the band and applying the
+// resulting unitary matrix from both sides of the trailing matrix. Unlike
+// the one-stage reduction, which spends half of its flops in distributed
+// Symv/Hemv, every update is a Hemm, Gemm, or Trr2k.
+//
+// On exit, the band of A holds the banded matrix and the Householder vectors
+// are stored below it with an implicit one on the 'bandwidth' subdiagonal.
+//
+template<typename R>
+inline void
+LBand( DistMatrix<R>& A, int bandwidth )
+{
+#ifndef RELEASE
+    PushCallStack("hermitian_tridiag::LBand");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( bandwidth < 1 )
+        throw std::logic_error("Bandwidth must be positive");
+#endif
+    const Grid& g = A.Grid();
+
+    // Matrix views
+    DistMatrix<R>
+        ATL(g), ATR(g),  A00(g), A01(g), A02(g),
+        ABL(g), ABR(g),  A10(g), A11(g), A12(g),
+                         A20(g), A21(g), A22(g);
+
+    // Temporary distributions
+    DistMatrix<R> V(g);
+    DistMatrix<R,VC,  STAR> V_VC_STAR(g);
+    DistMatrix<R,STAR,STAR> SInv_STAR_STAR(g);
+
+    PushBlocksizeStack( bandwidth );
+    PartitionDownDiagonal
+    ( A, ATL, ATR,
+         ABL, ABR, 0 );
+    while( ATL.Height() < A.Height() )
+    {
+        RepartitionDownDiagonal
+        ( ATL, /**/ ATR,  A00, /**/ A01, A02,
+         /*************/ /******************/
+               /**/       A10, /**/ A11, A12,
+          ABL, /**/ ABR,  A20, /**/ A21, A22 );
+
+        if( A22.Height() > 0 )
+        {
+            const int numReflectors = std::min(A21.Height(),A21.Width());
+            //----------------------------------------------------------------//
+            QR( A21 );
+
+            LockedView( V, A21, 0, 0, A21.Height(), numReflectors );
+            DistMatrix<R> VCopy( V );
+            MakeTrapezoidal( LEFT, LOWER, 0, VCopy );
+            SetDiagonal( LEFT, 0, VCopy, R(1) );
+
+            V_VC_STAR = VCopy;
+            Zeros( numReflectors, numReflectors, SInv_STAR_STAR );
+            Herk
+            ( UPPER, ADJOINT,
+              R(1), V_VC_STAR.LockedMatrix(),
+              R(0), SInv_STAR_STAR.Matrix() );
+            SInv_STAR_STAR.SumOverGrid();
+            HalveMainDiagonal( SInv_STAR_STAR );
+
+            TwoSidedBandUpdate( V_VC_STAR, VCopy, SInv_STAR_STAR, A22 );
+            //----------------------------------------------------------------//
+        }
+
+        SlidePartitionDownDiagonal
+        ( ATL, /**/ ATR,  A00, A01, /**/ A02,
+               /**/       A10, A11, /**/ A12,
+         /*************/ /******************/
+          ABL, /**/ ABR,  A20, A21, /**/ A22 );
+    }
+    PopBlocksizeStack();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+inline void
+LBand
+( DistMatrix<Complex<R> >& A, DistMatrix<Complex<R>,STAR,STAR>& t,
+  int bandwidth )
+{
+#ifndef RELEASE
+    PushCallStack("hermitian_tridiag::LBand");
+    if( A.Grid() != t.Grid() )
+        throw std::logic_error("{A,t} must be distributed over the same grid");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+    if( bandwidth < 1 )
+        throw std::logic_error("Bandwidth must be positive");
+    if( t.Viewing() )
+        throw std::logic_error("t must not be a view");
+#endif
+    typedef Complex<R> C;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    t.ResizeTo( std::max(n-bandwidth,0), 1 );
+
+    // Matrix views
+    DistMatrix<C>
+        ATL(g), ATR(g),  A00(g), A01(g), A02(g),
+        ABL(g), ABR(g),  A10(g), A11(g), A12(g),
+                         A20(g), A21(g), A22(g);
+    DistMatrix<C,STAR,STAR> t1(g);
+
+    // Temporary distributions
+    DistMatrix<C> V(g);
+    DistMatrix<C,MD,  STAR> t1_MD_STAR(g);
+    DistMatrix<C,VC,  STAR> V_VC_STAR(g);
+    DistMatrix<C,STAR,STAR> t1_STAR_STAR(g);
+    DistMatrix<C,STAR,STAR> SInv_STAR_STAR(g);
+
+    PushBlocksizeStack( bandwidth );
+    PartitionDownDiagonal
+    ( A, ATL, ATR,
+         ABL, ABR, 0 );
+    while( ATL.Height() < A.Height() )
+    {
+        RepartitionDownDiagonal
+        ( ATL, /**/ ATR,  A00, /**/ A01, A02,
+         /*************/ /******************/
+               /**/       A10, /**/ A11, A12,
+          ABL, /**/ ABR,  A20, /**/ A21, A22 );
+
+        if( A22.Height() > 0 )
+        {
+            const int numReflectors = std::min(A21.Height(),A21.Width());
+            View( t1, t, A00.Height(), 0, numReflectors, 1 );
+            //----------------------------------------------------------------//
+            QR( A21, t1_MD_STAR );
+            t1_STAR_STAR = t1_MD_STAR;
+            t1 = t1_STAR_STAR;
+
+            LockedView( V, A21, 0, 0, A21.Height(), numReflectors );
+            DistMatrix<C> VCopy( V );
+            MakeTrapezoidal( LEFT, LOWER, 0, VCopy );
+            SetDiagonal( LEFT, 0, VCopy, C(1) );
+
+            V_VC_STAR = VCopy;
+            Zeros( numReflectors, numReflectors, SInv_STAR_STAR );
+            Herk
+            ( UPPER, ADJOINT,
+              C(1), V_VC_STAR.LockedMatrix(),
+              C(0), SInv_STAR_STAR.Matrix() );
+            SInv_STAR_STAR.SumOverGrid();
+            FixDiagonal( UNCONJUGATED, t1_STAR_STAR, SInv_STAR_STAR );
+
+            TwoSidedBandUpdate( V_VC_STAR, VCopy, SInv_STAR_STAR, A22 );
+            //----------------------------------------------------------------//
+        }
+
+        SlidePartitionDownDiagonal
+        ( ATL, /**/ ATR,  A00, A01, /**/ A02,
+               /**/       A10, A11, /**/ A12,
+         /*************/ /******************/
+          ABL, /**/ ABR,  A20, A21, /**/ A22 );
+    }
+    PopBlocksizeStack();
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace hermitian_tridiag
+} // namespace elem
+
+#endif // ifndef LAPACK_HERMITIANTRIDIAG_LBAND_HPP
@@ -0,0 +1,446 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental-lite.hpp"
+
+#include "./HermitianTridiagEig/DivideAndConquer.hpp"
+
+namespace elem {
+
+namespace hermitian_tridiag_eig {
+
+template<typename R>
+inline void
+CopyTridiag
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  std::vector<R>& dVector, std::vector<R>& eVector )
+{
+    const int n = d.Height();
+#ifndef RELEASE
+    if( d.Width() != 1 || e.Width() != 1 )
+        throw std::logic_error("d and e must be column vectors");
+    if( e.Height() != std::max(n-1,0) )
+        throw std::logic_error("e must be one entry shorter than d");
+#endif
+    dVector.resize( n );
+    eVector.resize( std::max(n-1,1) );
+    if( n > 0 )
+        MemCopy( &dVector[0], d.LockedBuffer(), n );
+    if( n > 1 )
+        MemCopy( &eVector[0], e.LockedBuffer(), n-1 );
+}
+
+// Compute all of the eigenpairs, returning the eigenvalues in ascending order
+// and, in 'order', the column of Q holding each of the corresponding
+// eigenvectors
+template<typename R>
+inline void
+Eig
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  std::vector<R>& lambda, std::vector<int>& order, DistMatrix<R>& Q )
+{
+    std::vector<R> eVector;
+    CopyTridiag( d, e, lambda, eVector );
+    DivideAndConquer( lambda, eVector, Q );
+
+    const int n = lambda.size();
+    std::vector<IndexedValue<R> > pairs( n );
+    for( int j=0; j<n; ++j )
+    {
+        pairs[j].value = lambda[j];
+        pairs[j].index = j;
+    }
+    std::stable_sort( pairs.begin(), pairs.end(), IndexedValueLess<R> );
+    order.resize( n );
+    for( int j=0; j<n; ++j )
+    {
+        lambda[j] = pairs[j].value;
+        order[j] = pairs[j].index;
+    }
+}
+
+// Compute all of the eigenvalues in ascending order. As in LAPACK's dstedc,
+// there is no benefit to divide and conquer without eigenvectors.
+template<typename R>
+inline void
+Eig
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  std::vector<R>& lambda )
+{
+    std::vector<R> eVector;
+    CopyTridiag( d, e, lambda, eVector );
+    const int n = lambda.size();
+    lapack::TridiagQRAlg( n, &lambda[0], &eVector[0], (R*)0, 1 );
+    std::sort( lambda.begin(), lambda.end() );
+}
+
+template<typename R>
+inline void
+ExtractEigenvalues
+( const std::vector<R>& lambda, int a, int b, DistMatrix<R,VR,STAR>& w )
+{
+    w.ResizeTo( b-a, 1 );
+    const int colShift = w.ColShift();
+    const int colStride = w.ColStride();
+    const int localHeight = w.LocalHeight();
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        w.SetLocal( iLocal, 0, lambda[a+colShift+iLocal*colStride] );
+}
+
+// Gather the eigenvectors of the eigenvalues lambda[a],...,lambda[b-1] into
+// Z[* ,VR]. Q is freed in the process (and may be Z itself).
+template<typename R,Distribution U,Distribution V>
+inline void
+ExtractEigenvectors
+( const std::vector<int>& order, int a, int b,
+  DistMatrix<R,U,V>& Q, DistMatrix<R,STAR,VR>& Z )
+{
+    const Grid& g = Q.Grid();
+    const int n = Q.Height();
+    const int k = b-a;
+
+    DistMatrix<R,VC,STAR> Z_VC_STAR( g );
+    {
+        DistMatrix<R,VC,STAR> Q_VC_STAR( Q );
+        Q.Empty();
+        Z_VC_STAR.AlignWith( Q_VC_STAR );
+        Z_VC_STAR.ResizeTo( n, k );
+        const int localHeight = Q_VC_STAR.LocalHeight();
+        for( int j=0; j<k; ++j )
+            MemCopy
+            ( Z_VC_STAR.Buffer(0,j), Q_VC_STAR.LockedBuffer(0,order[a+j]),
+              localHeight );
+    }
+    Z = Z_VC_STAR;
+}
+
+// Each process receives a contiguous block of the spectrum from PMRRR, so
+// the computed eigenpairs must be permuted into ascending order
+template<typename R>
+inline void
+SortEigenpairs
+( const DistMatrix<R,VR,STAR>& wUnsorted, DistMatrix<R,STAR,VR>& ZUnsorted,
+  DistMatrix<R,VR,STAR>& w, DistMatrix<R,STAR,VR>& Z )
+{
+    const int k = wUnsorted.Height();
+    const DistMatrix<R,STAR,STAR> w_STAR_STAR( wUnsorted );
+    std::vector<IndexedValue<R> > pairs( k );
+    for( int j=0; j<k; ++j )
+    {
+        pairs[j].value = w_STAR_STAR.GetLocal(j,0);
+        pairs[j].index = j;
+    }
+    std::stable_sort( pairs.begin(), pairs.end(), IndexedValueLess<R> );
+    std::vector<R> lambda( k );
+    std::vector<int> order( k );
+    for( int j=0; j<k; ++j )
+    {
+        lambda[j] = pairs[j].value;
+        order[j] = pairs[j].index;
+    }
+    ExtractEigenvalues( lambda, 0, k, w );
+    ExtractEigenvectors( order, 0, k, ZUnsorted, Z );
+}
+
+// PMRRR is only available in double precision, so the remaining datatypes
+// always use divide and conquer
+template<typename R>
+inline bool
+TryPMRRR
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  DistMatrix<R,VR,STAR>& w, DistMatrix<R,STAR,VR>& Z,
+  int lowerBound, int upperBound )
+{ return false; }
+
+template<typename R>
+inline bool
+TryPMRRR
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  DistMatrix<R,VR,STAR>& w, DistMatrix<R,STAR,VR>& Z,
+  R lowerBound, R upperBound )
+{ return false; }
+
+#ifdef HAVE_PMRRR
+// PMRRR requires the local portions of w[VR,* ] and Z[* ,VR] to be aligned
+// at zero and e to be of length n
+template<>
+inline bool
+TryPMRRR
+( const DistMatrix<double,STAR,STAR>& d, const DistMatrix<double,STAR,STAR>& e,
+  DistMatrix<double,VR,STAR>& w, DistMatrix<double,STAR,VR>& Z,
+  int lowerBound, int upperBound )
+{
+    if( GetHermitianTridiagEigApproach() ==
+        HERMITIAN_TRIDIAG_EIG_DIVIDE_AND_CONQUER )
+        return false;
+    const Grid& g = d.Grid();
+    const int n = d.Height();
+    const int k = (upperBound-lowerBound) + 1;
+    std::vector<double> dVector, eVector, wVector( std::max(n,1) );
+    CopyTridiag( d, e, dVector, eVector );
+    eVector.resize( std::max(n,1) );
+
+    DistMatrix<double,VR,STAR> w_VR_STAR( k, 1, g );
+    DistMatrix<double,STAR,VR> Z_STAR_VR( g );
+    DistMatrix<double,STAR,VR>& ZOut = ( Z.Viewing() ? Z_STAR_VR : Z );
+    ZOut.Empty();
+    ZOut.ResizeTo( n, k );
+    if( n > 0 )
+        pmrrr::Eig
+        ( n, &dVector[0], &eVector[0], &wVector[0], ZOut.Buffer(), n,
+          g.VRComm(), lowerBound, upperBound );
+    for( int iLocal=0; iLocal<w_VR_STAR.LocalHeight(); ++iLocal )
+        w_VR_STAR.SetLocal( iLocal, 0, wVector[iLocal] );
+    SortEigenpairs( w_VR_STAR, ZOut, w, Z );
+    return true;
+}
+
+template<>
+inline bool
+TryPMRRR
+( const DistMatrix<double,STAR,STAR>& d, const DistMatrix<double,STAR,STAR>& e,
+  DistMatrix<double,VR,STAR>& w, DistMatrix<double,STAR,VR>& Z,
+  double lowerBound, double upperBound )
+{
+    if( GetHermitianTridiagEigApproach() ==
+        HERMITIAN_TRIDIAG_EIG_DIVIDE_AND_CONQUER )
+        return false;
+    const Grid& g = d.Grid();
+    const int n = d.Height();
+    std::vector<double> dVector, eVector, wVector( std::max(n,1) );
+    CopyTridiag( d, e, dVector, eVector );
+    eVector.resize( std::max(n,1) );
+    if( n == 0 )
+    {
+        w.ResizeTo( 0, 1 );
+        Z.ResizeTo( 0, 0 );
+        return true;
+    }
+
+    // PMRRR overwrites d and e while estimating the number of eigenvalues
+    std::vector<double> dCopy( dVector ), eCopy( eVector );
+    const pmrrr::Estimate estimate = pmrrr::EigEstimate
+    ( n, &dCopy[0], &eCopy[0], &wVector[0], g.VRComm(),
+      lowerBound, upperBound );
+
+    DistMatrix<double,STAR,VR> Z_STAR_VR( g );
+    DistMatrix<double,STAR,VR>& ZOut = ( Z.Viewing() ? Z_STAR_VR : Z );
+    ZOut.Empty();
+    ZOut.ResizeTo( n, estimate.numGlobalEigenvalues );
+    const pmrrr::Info info = pmrrr::Eig
+    ( n, &dVector[0], &eVector[0], &wVector[0], ZOut.Buffer(), n,
+      g.VRComm(), lowerBound, upperBound );
+    const int k = info.numGlobalEigenvalues;
+    ZOut.ResizeTo( n, k );
+
+    DistMatrix<double,VR,STAR> w_VR_STAR( k, 1, g );
+    for( int iLocal=0; iLocal<w_VR_STAR.LocalHeight(); ++iLocal )
+        w_VR_STAR.SetLocal( iLocal, 0, wVector[iLocal] );
+    SortEigenpairs( w_VR_STAR, ZOut, w, Z );
+    return true;
+}
+#endif // ifdef HAVE_PMRRR
+
+template<typename R>
+inline void
+CheckIndexRange( int n, int lowerBound, int upperBound )
+{
+    if( lowerBound < 0 || upperBound >= n || upperBound < lowerBound-1 )
+    {
+        std::ostringstream msg;
+        msg << "Invalid eigenvalue index range, [" << lowerBound << ","
+            << upperBound << "], for a " << n << " x " << n << " matrix";
+        throw std::logic_error( msg.str().c_str() );
+    }
+}
+
+} // namespace hermitian_tridiag_eig
+
+//----------------------------------------------------------------------------//
+// Grab the full set of eigenpairs of the real, symmetric tridiagonal matrix  //
+//----------------------------------------------------------------------------//
+template<typename R>
+void HermitianTridiagEig
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  DistMatrix<R,VR,STAR>& w, DistMatrix<R,STAR,VR>& Z )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianTridiagEig");
+#endif
+    const int n = d.Height();
+    if( hermitian_tridiag_eig::TryPMRRR( d, e, w, Z, 0, n-1 ) )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+    std::vector<R> lambda;
+    std::vector<int> order;
+    DistMatrix<R> Q( d.Grid() );
+    hermitian_tridiag_eig::Eig( d, e, lambda, order, Q );
+    hermitian_tridiag_eig::ExtractEigenvalues( lambda, 0, n, w );
+    hermitian_tridiag_eig::ExtractEigenvectors( order, 0, n, Q, Z );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//----------------------------------------------------------------------------//
+// Grab the eigenpairs with zero-indexed indices in the inclusive range       //
+//   a,a+1,...,b    ; a >= 0, b < n                                           //
+// (where a=lowerBound, b=upperBound)                                         //
+//----------------------------------------------------------------------------//
+template<typename R>
+void HermitianTridiagEig
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  DistMatrix<R,VR,STAR>& w, DistMatrix<R,STAR,VR>& Z,
+  int lowerBound, int upperBound )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianTridiagEig");
+#endif
+    hermitian_tridiag_eig::CheckIndexRange<R>
+    ( d.Height(), lowerBound, upperBound );
+    if( hermitian_tridiag_eig::TryPMRRR
+        ( d, e, w, Z, lowerBound, upperBound ) )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+    std::vector<R> lambda;
+    std::vector<int> order;
+    DistMatrix<R> Q( d.Grid() );
+    hermitian_tridiag_eig::Eig( d, e, lambda, order, Q );
+    hermitian_tridiag_eig::ExtractEigenvalues
+    ( lambda, lowerBound, upperBound+1, w );
+    hermitian_tridiag_eig::ExtractEigenvectors
+    ( order, lowerBound, upperBound+1, Q, Z );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//----------------------------------------------------------------------------//
+// Grab the eigenpairs with eigenvalues in the half-open interval (a,b]       //
+// (where a=lowerBound, b=upperBound)                                         //
+//----------------------------------------------------------------------------//
+template<typename R>
+void HermitianTridiagEig
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  DistMatrix<R,VR,STAR>& w, DistMatrix<R,STAR,VR>& Z,
+  R lowerBound, R upperBound )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianTridiagEig");
+#endif
+    if( hermitian_tridiag_eig::TryPMRRR
+        ( d, e, w, Z, lowerBound, upperBound ) )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+    std::vector<R> lambda;
+    std::vector<int> order;
+    DistMatrix<R> Q( d.Grid() );
+    hermitian_tridiag_eig::Eig( d, e, lambda, order, Q );
+    const int a =
+        std::upper_bound( lambda.begin(), lambda.end(), lowerBound ) -
+        lambda.begin();
+    const int b =
+        std::upper_bound( lambda.begin(), lambda.end(), upperBound ) -
+        lambda.begin();
+    hermitian_tridiag_eig::ExtractEigenvalues( lambda, a, std::max(a,b), w );
+    hermitian_tridiag_eig::ExtractEigenvectors
+    ( order, a, std::max(a,b), Q, Z );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//----------------------------------------------------------------------------//
+// Grab the full set of eigenvalues of the real, symmetric tridiagonal matrix //
+//----------------------------------------------------------------------------//
+template<typename R>
+void HermitianTridiagEig
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  DistMatrix<R,VR,STAR>& w )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianTridiagEig");
+#endif
+    std::vector<R> lambda;
+    hermitian_tridiag_eig::Eig( d, e, lambda );
+    hermitian_tridiag_eig::ExtractEigenvalues( lambda, 0, d.Height(), w );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+void HermitianTridiagEig
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  DistMatrix<R,VR,STAR>& w, int lowerBound, int upperBound )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianTridiagEig");
+#endif
+    hermitian_tridiag_eig::CheckIndexRange<R>
+    ( d.Height(), lowerBound, upperBound );
+    std::vector<R> lambda;
+    hermitian_tridiag_eig::Eig( d, e, lambda );
+    hermitian_tridiag_eig::ExtractEigenvalues
+    ( lambda, lowerBound, upperBound+1, w );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+void HermitianTridiagEig
+( const DistMatrix<R,STAR,STAR>& d, const DistMatrix<R,STAR,STAR>& e,
+  DistMatrix<R,VR,STAR>& w, R lowerBound, R upperBound )
+{
+#ifndef RELEASE
+    PushCallStack("HermitianTridiagEig");
+#endif
+    std::vector<R> lambda;
+    hermitian_tridiag_eig::Eig( d, e, lambda );
+    const int a =
+        std::upper_bound( lambda.begin(), lambda.end(), lowerBound ) -
+        lambda.begin();
+    const int b =
+        std::upper_bound( lambda.begin(), lambda.end(), upperBound ) -
+        lambda.begin();
+    hermitian_tridiag_eig::ExtractEigenvalues( lambda, a, std::max(a,b), w );
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+#ifndef DISABLE_FLOAT
+template void HermitianTridiagEig( const DistMatrix<float,STAR,STAR>& d, const DistMatrix<float,STAR,STAR>& e, DistMatrix<float,VR,STAR>& w, DistMatrix<float,STAR,VR>& Z );
+template void HermitianTridiagEig( const DistMatrix<float,STAR,STAR>& d, const DistMatrix<float,STAR,STAR>& e, DistMatrix<float,VR,STAR>& w, DistMatrix<float,STAR,VR>& Z, int lowerBound, int upperBound );
+template void HermitianTridiagEig( const DistMatrix<float,STAR,STAR>& d, const DistMatrix<float,STAR,STAR>& e, DistMatrix<float,VR,STAR>& w, DistMatrix<float,STAR,VR>& Z, float lowerBound, float upperBound );
+template void HermitianTridiagEig( const DistMatrix<float,STAR,STAR>& d, const DistMatrix<float,STAR,STAR>& e, DistMatrix<float,VR,STAR>& w );
+template void HermitianTridiagEig( const DistMatrix<float,STAR,STAR>& d, const DistMatrix<float,STAR,STAR>& e, DistMatrix<float,VR,STAR>& w, int lowerBound, int upperBound );
+template void HermitianTridiagEig( const DistMatrix<float,STAR,STAR>& d, const DistMatrix<float,STAR,STAR>& e, DistMatrix<float,VR,STAR>& w, float lowerBound, float upperBound );
+#endif // ifndef DISABLE_FLOAT
+
+template void HermitianTridiagEig( const DistMatrix<double,STAR,STAR>& d, const DistMatrix<double,STAR,STAR>& e, DistMatrix<double,VR,STAR>& w, DistMatrix<double,STAR,VR>& Z );
+template void HermitianTridiagEig( const DistMatrix<double,STAR,STAR>& d, const DistMatrix<double,STAR,STAR>& e, DistMatrix<double,VR,STAR>& w, DistMatrix<double,STAR,VR>& Z, int lowerBound, int upperBound );
+template void HermitianTridiagEig( const DistMatrix<double,STAR,STAR>& d, const DistMatrix<double,STAR,STAR>& e, DistMatrix<double,VR,STAR>& w, DistMatrix<double,STAR,VR>& Z, double lowerBound, double upperBound );
+template void HermitianTridiagEig( const DistMatrix<double,STAR,STAR>& d, const DistMatrix<double,STAR,STAR>& e, DistMatrix<double,VR,STAR>& w );
+template void HermitianTridiagEig( const DistMatrix<double,STAR,STAR>& d, const DistMatrix<double,STAR,STAR>& e, DistMatrix<double,VR,STAR>& w, int lowerBound, int upperBound );
+template void HermitianTridiagEig( const DistMatrix<double,STAR,STAR>& d, const DistMatrix<double,STAR,STAR>& e, DistMatrix<double,VR,STAR>& w, double lowerBound, double upperBound );
+
+} // namespace elem
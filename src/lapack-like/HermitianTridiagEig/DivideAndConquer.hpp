@@ -0,0 +1,429 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef LAPACK_HERMITIANTRIDIAGEIG_DIVIDEANDCONQUER_HPP
+#define LAPACK_HERMITIANTRIDIAGEIG_DIVIDEANDCONQUER_HPP
+
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+//
+// Cuppen's divide-and-conquer algorithm for the real symmetric tridiagonal
+// eigenvalue problem, with the deflation strategy and the Gu/Eisenstat
+// recomputation of the updating vector used by LAPACK's dstedc.
+//
+// The tridiagonal matrix T is split as
+//
+//   T = | T1-rho e_m e_m^T         0          | + rho v v^T,
+//       |        0          T2-rho e_1 e_1^T  |
+//
+// where beta = T(m,m-1), rho = |beta|, and v = [e_m; sign(beta) e_1]. Since
+// the O(n) work on eigenvalues is negligible relative to the O(n^3) work on
+// the eigenvectors, every process redundantly holds the eigenvalues and
+// solves the secular equations, while the eigenvectors are kept in a
+// block-diagonal [MC,MR] matrix Q so that each merge is a pair of
+// distributed Gemms (one per diagonal block) with the eigenvectors of the
+// rank-one modification. They are only redistributed to [* ,VR] at the end.
+//
+
+namespace elem {
+namespace hermitian_tridiag_eig {
+
+template<typename R>
+struct IndexedValue
+{
+    R value;
+    int index;
+};
+
+template<typename R>
+inline bool
+IndexedValueLess( const IndexedValue<R>& a, const IndexedValue<R>& b )
+{ return a.value < b.value; }
+
+// Solve the leaf problem T(offset:offset+n-1,offset:offset+n-1) with the
+// QR algorithm on every process and store its eigenvectors into the
+// corresponding diagonal block of Q
+template<typename R>
+inline void
+Leaf
+( int offset, int n, std::vector<R>& d, const std::vector<R>& e,
+  DistMatrix<R>& Q )
+{
+#ifndef RELEASE
+    PushCallStack("hermitian_tridiag_eig::Leaf");
+#endif
+    std::vector<R> eLeaf( std::max(n-1,1) ), ZLeaf( n*n );
+    if( n > 1 )
+        MemCopy( &eLeaf[0], &e[offset], n-1 );
+    lapack::TridiagQRAlg( n, &d[offset], &eLeaf[0], &ZLeaf[0], n );
+
+    DistMatrix<R> QLeaf( Q.Grid() );
+    View( QLeaf, Q, offset, offset, n, n );
+    const int colShift = QLeaf.ColShift();
+    const int rowShift = QLeaf.RowShift();
+    const int colStride = QLeaf.ColStride();
+    const int rowStride = QLeaf.RowStride();
+    const int localHeight = QLeaf.LocalHeight();
+    const int localWidth = QLeaf.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const int i = colShift + iLocal*colStride;
+            QLeaf.SetLocal( iLocal, jLocal, ZLeaf[i+j*n] );
+        }
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+//
+// Given the eigenvalues d(offset:offset+n-1) and eigenvectors (in the
+// block-diagonal portion of Q) of the two torn subproblems of sizes m and n-m,
+// overwrite them with those of the merged problem.
+//
+template<typename R>
+inline void
+Merge
+( int offset, int n, int m, R beta, std::vector<R>& d, DistMatrix<R>& Q )
+{
+#ifndef RELEASE
+    PushCallStack("hermitian_tridiag_eig::Merge");
+#endif
+    const Grid& g = Q.Grid();
+    DistMatrix<R> QB( g );
+    View( QB, Q, offset, offset, n, n );
+
+    // z := Q^T v / sqrt(2), which requires the last row of Q1 and the first
+    // row of Q2. Since the off-diagonal blocks of QB are zero, both can be
+    // read from rows m-1 and m of QB.
+    std::vector<R> z( n );
+    {
+        DistMatrix<R> QRows( g );
+        LockedView( QRows, QB, m-1, 0, 2, n );
+        DistMatrix<R,STAR,STAR> QRows_STAR_STAR( QRows );
+        const R sqrtTwo = Sqrt( R(2) );
+        const R sign = ( beta >= 0 ? R(1) : R(-1) );
+        for( int j=0; j<m; ++j )
+            z[j] = QRows_STAR_STAR.GetLocal(0,j) / sqrtTwo;
+        for( int j=m; j<n; ++j )
+            z[j] = sign*QRows_STAR_STAR.GetLocal(1,j) / sqrtTwo;
+    }
+    const R rho = 2*Abs(beta);
+
+    // Sort the eigenvalues of the subproblems into ascending order
+    std::vector<IndexedValue<R> > pairs( n );
+    for( int j=0; j<n; ++j )
+    {
+        pairs[j].value = d[offset+j];
+        pairs[j].index = j;
+    }
+    std::stable_sort( pairs.begin(), pairs.end(), IndexedValueLess<R> );
+    std::vector<R> dSort( n ), zSort( n );
+    std::vector<int> perm( n );
+    R dMax = 0, zMax = 0;
+    for( int j=0; j<n; ++j )
+    {
+        perm[j] = pairs[j].index;
+        dSort[j] = pairs[j].value;
+        zSort[j] = z[perm[j]];
+        dMax = std::max( dMax, Abs(dSort[j]) );
+        zMax = std::max( zMax, Abs(zSort[j]) );
+    }
+    const R tol = 8*lapack::MachineEpsilon<R>()*std::max(dMax,zMax);
+
+    // Deflate both small components of z and pairs of (nearly) equal
+    // eigenvalues, the latter by rotating the corresponding eigenvectors so
+    // that one of the components of z is zeroed
+    std::vector<int> kept, deflated, rotationCols;
+    std::vector<R> rotations;
+    // Track whether each column of QB is nonzero in its top rows (1), its
+    // bottom rows (2), or both (3), as rotations can mix the two halves
+    std::vector<int> colType( n );
+    for( int j=0; j<n; ++j )
+        colType[j] = ( j < m ? 1 : 2 );
+    int prev = -1;
+    for( int j=0; j<n; ++j )
+    {
+        if( rho*Abs(zSort[j]) <= tol )
+        {
+            deflated.push_back( j );
+            continue;
+        }
+        if( prev >= 0 )
+        {
+            const R tau = lapack::SafeNorm( zSort[j], zSort[prev] );
+            const R c = zSort[j] / tau;
+            const R s = -zSort[prev] / tau;
+            const R t = dSort[j] - dSort[prev];
+            if( Abs(t*c*s) <= tol )
+            {
+                zSort[j] = tau;
+                zSort[prev] = 0;
+                rotationCols.push_back( perm[prev] );
+                rotationCols.push_back( perm[j] );
+                rotations.push_back( c );
+                rotations.push_back( s );
+                const int mixedType = colType[perm[prev]] | colType[perm[j]];
+                colType[perm[prev]] = mixedType;
+                colType[perm[j]] = mixedType;
+                const R dPrev = dSort[prev]*c*c + dSort[j]*s*s;
+                dSort[j] = dSort[prev]*s*s + dSort[j]*c*c;
+                dSort[prev] = dPrev;
+                deflated.push_back( prev );
+            }
+            else
+                kept.push_back( prev );
+        }
+        prev = j;
+    }
+    if( prev >= 0 )
+        kept.push_back( prev );
+    const int k = kept.size();
+
+    // Group the non-deflated eigenvectors into those which only live in the
+    // top rows, those which live in both, and those which only live in the
+    // bottom rows, so that each half of QB only multiplies its nonzero columns
+    std::vector<int> grouped;
+    grouped.reserve( k );
+    const int typeOrder[3] = { 1, 3, 2 };
+    int numTopOnly=0, numMixed=0;
+    for( int t=0; t<3; ++t )
+    {
+        for( int j=0; j<k; ++j )
+        {
+            if( colType[perm[kept[j]]] == typeOrder[t] )
+            {
+                grouped.push_back( j );
+                if( t == 0 )
+                    ++numTopOnly;
+                else if( t == 1 )
+                    ++numMixed;
+            }
+        }
+    }
+    const int numTop = numTopOnly + numMixed;
+
+    // Apply the rotations and move the non-deflated eigenvectors to the front
+    {
+        DistMatrix<R,VC,STAR> QB_VC_STAR( QB );
+        R* buffer = QB_VC_STAR.Buffer();
+        const int ldim = QB_VC_STAR.LDim();
+        const int localHeight = QB_VC_STAR.LocalHeight();
+        const int numRotations = rotations.size()/2;
+        for( int r=0; r<numRotations; ++r )
+        {
+            const R c = rotations[2*r];
+            const R s = rotations[2*r+1];
+            R* x = &buffer[rotationCols[2*r]*ldim];
+            R* y = &buffer[rotationCols[2*r+1]*ldim];
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            {
+                const R chi = x[iLocal];
+                const R psi = y[iLocal];
+                x[iLocal] = c*chi + s*psi;
+                y[iLocal] = c*psi - s*chi;
+            }
+        }
+
+        std::vector<int> order( n );
+        for( int j=0; j<k; ++j )
+            order[j] = perm[kept[grouped[j]]];
+        for( int j=k; j<n; ++j )
+            order[j] = perm[deflated[j-k]];
+        std::vector<R> row( n );
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            for( int j=0; j<n; ++j )
+                row[j] = buffer[iLocal+order[j]*ldim];
+            for( int j=0; j<n; ++j )
+                buffer[iLocal+j*ldim] = row[j];
+        }
+        QB = QB_VC_STAR;
+    }
+    for( int j=k; j<n; ++j )
+        d[offset+j] = dSort[deflated[j-k]];
+    if( k == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    // Solve the secular equation for the non-deflated eigenvalues and,
+    // following Gu and Eisenstat, recompute z so that the eigenvectors of the
+    // rank-one modification are numerically orthogonal
+    std::vector<R> dKept( k ), zKept( k ), delta( k ), zHat( k, R(1) );
+    for( int j=0; j<k; ++j )
+    {
+        dKept[j] = dSort[kept[j]];
+        zKept[j] = zSort[kept[j]];
+    }
+    for( int j=0; j<k; ++j )
+    {
+        d[offset+j] =
+            lapack::SecularEigenvalue
+            ( k, j, &dKept[0], &zKept[0], rho, &delta[0] );
+        if( k > 2 )
+        {
+            for( int i=0; i<k; ++i )
+            {
+                zHat[i] *= delta[i];
+                if( i != j )
+                    zHat[i] /= dKept[i]-dKept[j];
+            }
+        }
+    }
+    for( int i=0; i<k; ++i )
+    {
+        const R sign = ( zKept[i] >= 0 ? R(1) : R(-1) );
+        zHat[i] = sign*Sqrt(Abs(zHat[i]));
+    }
+
+    // Form our local portion of the eigenvectors, U, of the rank-one
+    // modification (each process recomputes the roots for its columns)
+    DistMatrix<R> U( g );
+    Zeros( k, k, U );
+    {
+        const int colShift = U.ColShift();
+        const int rowShift = U.RowShift();
+        const int colStride = U.ColStride();
+        const int rowStride = U.RowStride();
+        const int localHeight = U.LocalHeight();
+        const int localWidth = U.LocalWidth();
+        std::vector<R> u( k );
+        for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        {
+            const int j = rowShift + jLocal*rowStride;
+            lapack::SecularEigenvalue
+            ( k, j, &dKept[0], &zKept[0], rho, &delta[0] );
+            if( k > 2 )
+            {
+                for( int i=0; i<k; ++i )
+                    u[i] = zHat[i] / delta[i];
+                const R norm = blas::Nrm2( k, &u[0], 1 );
+                for( int i=0; i<k; ++i )
+                    u[i] /= norm;
+            }
+            else
+                MemCopy( &u[0], &delta[0], k );
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            {
+                const int i = colShift + iLocal*colStride;
+                U.SetLocal( iLocal, jLocal, u[grouped[i]] );
+            }
+        }
+    }
+
+    // QB(0:m-1,0:k-1) := QB(0:m-1,0:numTop-1) U(0:numTop-1,:) and
+    // QB(m:n-1,0:k-1) := QB(m:n-1,numTopOnly:k-1) U(numTopOnly:k-1,:),
+    // which skips the zero off-diagonal blocks of the eigenvectors
+    if( numTop > 0 )
+    {
+        DistMatrix<R> QTopNonzero( g ), QTopCopy( g ), QTop( g ), UTop( g );
+        LockedView( QTopNonzero, QB, 0, 0, m, numTop );
+        QTopCopy = QTopNonzero;
+        View( QTop, QB, 0, 0, m, k );
+        LockedView( UTop, U, 0, 0, numTop, k );
+        Gemm( NORMAL, NORMAL, R(1), QTopCopy, UTop, R(0), QTop );
+    }
+    if( numTopOnly < k )
+    {
+        DistMatrix<R> QBottomNonzero( g ), QBottomCopy( g ), QBottom( g ),
+                      UBottom( g );
+        LockedView( QBottomNonzero, QB, m, numTopOnly, n-m, k-numTopOnly );
+        QBottomCopy = QBottomNonzero;
+        View( QBottom, QB, m, 0, n-m, k );
+        LockedView( UBottom, U, numTopOnly, 0, k-numTopOnly, k );
+        Gemm( NORMAL, NORMAL, R(1), QBottomCopy, UBottom, R(0), QBottom );
+    }
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+template<typename R>
+inline void
+Recurse
+( int offset, int n, std::vector<R>& d, const std::vector<R>& e,
+  DistMatrix<R>& Q, int leafSize )
+{
+    if( n <= leafSize )
+    {
+        Leaf( offset, n, d, e, Q );
+        return;
+    }
+
+    const int m = n/2;
+    const R beta = e[offset+m-1];
+    d[offset+m-1] -= Abs(beta);
+    d[offset+m] -= Abs(beta);
+    Recurse( offset,   m,   d, e, Q, leafSize );
+    Recurse( offset+m, n-m, d, e, Q, leafSize );
+    Merge( offset, n, m, beta, d, Q );
+}
+
+//
+// Overwrite d with the (unsorted) eigenvalues of the tridiagonal matrix with
+// diagonal d and subdiagonal e, and Q with the corresponding eigenvectors.
+// The subproblems are solved directly once they are no larger than the
+// current algorithmic blocksize.
+//
+template<typename R>
+inline void
+DivideAndConquer
+( std::vector<R>& d, std::vector<R>& e, DistMatrix<R>& Q )
+{
+#ifndef RELEASE
+    PushCallStack("hermitian_tridiag_eig::DivideAndConquer");
+#endif
+    const int n = d.size();
+    Zeros( n, n, Q );
+    if( n == 0 )
+    {
+#ifndef RELEASE
+        PopCallStack();
+#endif
+        return;
+    }
+
+    // Scale the matrix to unit max norm
+    R maxAbs = 0;
+    for( int j=0; j<n; ++j )
+        maxAbs = std::max( maxAbs, Abs(d[j]) );
+    for( int j=0; j<n-1; ++j )
+        maxAbs = std::max( maxAbs, Abs(e[j]) );
+    if( maxAbs != R(0) )
+    {
+        for( int j=0; j<n; ++j )
+            d[j] /= maxAbs;
+        for( int j=0; j<n-1; ++j )
+            e[j] /= maxAbs;
+    }
+
+    Recurse( 0, n, d, e, Q, std::max(Blocksize(),2) );
+
+    if( maxAbs != R(0) )
+        for( int j=0; j<n; ++j )
+            d[j] *= maxAbs;
+#ifndef RELEASE
+    PopCallStack();
+#endif
+}
+
+} // namespace hermitian_tridiag_eig
+} // namespace elem
+
+#endif // ifndef LAPACK_HERMITIANTRIDIAGEIG_DIVIDEANDCONQUER_HPP
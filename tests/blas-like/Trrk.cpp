@@ -0,0 +1,138 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Update the uplo triangle of C := alpha op(A) op(B) + beta C with Trrk and
+// compare it against Gemm. Since the inner dimension spans several blocks,
+// beta must be applied once overall rather than once per block. Also return
+// the size of any change to the opposite triangle.
+template<typename T>
+void TestTrrk
+( UpperOrLower uplo, Orientation orientationOfA, Orientation orientationOfB,
+  int m, int k, T alpha, T beta, const Grid& g )
+{
+    typedef typename Base<T>::type R;
+    DistMatrix<T> A(g), B(g), C(g), COrig(g), CRef(g), E(g);
+    if( orientationOfA == NORMAL )
+        Uniform( m, k, A );
+    else
+        Uniform( k, m, A );
+    if( orientationOfB == NORMAL )
+        Uniform( k, m, B );
+    else
+        Uniform( m, k, B );
+    Uniform( m, m, C );
+    COrig = C;
+    CRef = C;
+    Gemm( orientationOfA, orientationOfB, alpha, A, B, beta, CRef );
+    Trrk( uplo, orientationOfA, orientationOfB, alpha, A, B, beta, C );
+
+    MakeTriangular( uplo, CRef );
+    const R frobRef = FrobeniusNorm( CRef );
+    E = C;
+    MakeTriangular( uplo, E );
+    Axpy( T(-1), CRef, E );
+    const R error = FrobeniusNorm( E ) / frobRef;
+
+    // Subtract the change within the uplo triangle from the total change
+    Axpy( T(-1), COrig, C );
+    E = C;
+    MakeTriangular( uplo, E );
+    Axpy( T(-1), E, C );
+    const R otherChange = FrobeniusNorm( C );
+    if( g.Rank() == 0 )
+        cout << "  Trrk" << UpperOrLowerToChar(uplo)
+             << OrientationToChar(orientationOfA)
+             << OrientationToChar(orientationOfB) << ": "
+             << "||C - C_Gemm||_F / ||C_Gemm||_F = " << error
+             << ", change in other triangle = " << otherChange << endl;
+}
+
+template<typename T>
+void TestTrrkVariants( int m, int k, T alpha, T beta, const Grid& g )
+{
+    // Use adjoints for complex data so that the conjugated paths run as well
+    const Orientation adjOrTrans =
+        ( IsComplex<T>::val ? ADJOINT : TRANSPOSE );
+    const UpperOrLower uplos[2] = { LOWER, UPPER };
+    for( int i=0; i<2; ++i )
+    {
+        const UpperOrLower uplo = uplos[i];
+        TestTrrk( uplo, NORMAL, NORMAL, m, k, alpha, beta, g );
+        TestTrrk( uplo, NORMAL, adjOrTrans, m, k, alpha, beta, g );
+        TestTrrk( uplo, adjOrTrans, NORMAL, m, k, alpha, beta, g );
+        TestTrrk( uplo, adjOrTrans, TRANSPOSE, m, k, alpha, beta, g );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--r","height of process grid",0);
+        const int m = Input("--m","height of result",60);
+        const int k = Input("--k","inner dimension",70);
+        const int nb = Input("--nb","algorithmic blocksize",16);
+        const int nbLocal = Input("--nbLocal","local blocksize",8);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+        SetLocalTrrkBlocksize<double>( nbLocal );
+        SetLocalTrrkBlocksize<Complex<double> >( nbLocal );
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestTrrkVariants<double>( m, k, 3., 4., g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestTrrkVariants<Complex<double> >
+        ( m, k, Complex<double>(3,1), Complex<double>(4,-2), g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,192 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/convex/LogBarrier.hpp"
+#include "elemental/convex/LogDetDivergence.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/Determinant.hpp"
+#include "elemental/lapack-like/GaussianElimination.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+using namespace std;
+using namespace elem;
+
+// tr(A B^{-1}) - log(det(A B^{-1})) - n, formed from B^{-1} A (which has the
+// same trace and determinant) without any Cholesky factorizations
+template<typename F>
+typename Base<F>::type
+ExplicitLogDetDivergence( const DistMatrix<F>& A, const DistMatrix<F>& B )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    DistMatrix<F> BCopy(g), N(g);
+    BCopy = B;
+    N = A;
+    GaussianElimination( BCopy, N );
+
+    DistMatrix<F,STAR,STAR> N_STAR_STAR(g);
+    N_STAR_STAR = N;
+    R trace = 0;
+    for( int j=0; j<n; ++j )
+        trace += RealPart( N_STAR_STAR.GetLocal(j,j) );
+    const SafeProduct<F> det = SafeDeterminant( N );
+    return trace - det.kappa*det.n - R(n);
+}
+
+// Return the largest relative difference of the computed values from the
+// reference value
+template<typename R>
+R MaxRelativeError( const vector<R>& values, R reference )
+{
+    R maxError = 0;
+    for( size_t k=0; k<values.size(); ++k )
+        maxError = std::max( maxError, Abs(values[k]-reference)/Abs(reference) );
+    return maxError;
+}
+
+template<typename F>
+void TestUplo
+( UpperOrLower uplo, const DistMatrix<F>& AFull, const DistMatrix<F>& BFull,
+  typename Base<F>::type divergence, typename Base<F>::type barrier )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = AFull.Grid();
+
+    // Only the uplo triangles of the inputs should be accessed
+    DistMatrix<F> A(g), B(g), CA(g), CB(g), ACopy(g);
+    A = AFull;
+    B = BFull;
+    MakeTriangular( uplo, A );
+    MakeTriangular( uplo, B );
+    CA = A;
+    CB = B;
+    Cholesky( uplo, CA );
+    Cholesky( uplo, CB );
+
+    // Each process redundantly runs the sequential versions
+    DistMatrix<F,STAR,STAR> A_STAR_STAR(g), B_STAR_STAR(g),
+                            CA_STAR_STAR(g), CB_STAR_STAR(g),
+                            ACopy_STAR_STAR(g);
+    A_STAR_STAR = A;
+    B_STAR_STAR = B;
+    CA_STAR_STAR = CA;
+    CB_STAR_STAR = CB;
+    const Matrix<F>& ALoc = A_STAR_STAR.LockedMatrix();
+    const Matrix<F>& BLoc = B_STAR_STAR.LockedMatrix();
+    const Matrix<F>& CALoc = CA_STAR_STAR.LockedMatrix();
+    const Matrix<F>& CBLoc = CB_STAR_STAR.LockedMatrix();
+
+    vector<R> divergences, barriers;
+    divergences.push_back( LogDetDivergence( uplo, A, B ) );
+    divergences.push_back( FactoredLogDetDivergence( uplo, A, CB ) );
+    ACopy = A;
+    divergences.push_back( FactoredLogDetDivergence( uplo, ACopy, CB, true ) );
+    divergences.push_back( LogDetDivergence( uplo, ALoc, BLoc ) );
+    divergences.push_back( FactoredLogDetDivergence( uplo, ALoc, CBLoc ) );
+    ACopy_STAR_STAR = A;
+    divergences.push_back
+    ( FactoredLogDetDivergence( uplo, ACopy_STAR_STAR.Matrix(), CBLoc, true ) );
+
+    barriers.push_back( LogBarrier( uplo, A ) );
+    ACopy = A;
+    barriers.push_back( LogBarrier( uplo, ACopy, true ) );
+    barriers.push_back( FactoredLogBarrier( uplo, CA ) );
+    barriers.push_back( LogBarrier( uplo, ALoc ) );
+    barriers.push_back( FactoredLogBarrier( uplo, CALoc ) );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  " << ( uplo==LOWER ? "LOWER" : "UPPER" ) << ":\n"
+             << "    max relative error of the divergences = "
+             << MaxRelativeError( divergences, divergence ) << "\n"
+             << "    max relative error of the barriers    = "
+             << MaxRelativeError( barriers, barrier ) << endl;
+    }
+}
+
+template<typename F>
+void TestLogDetDivergence( int n, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    DistMatrix<F> A(g), B(g);
+    HermitianUniformSpectrum( n, A, R(1), R(10) );
+    HermitianUniformSpectrum( n, B, R(1), R(5) );
+
+    const R divergence = ExplicitLogDetDivergence( A, B );
+    const SafeProduct<F> detA = SafeDeterminant( A );
+    const R barrier = -detA.kappa*detA.n;
+    if( g.Rank() == 0 )
+        cout << "  tr(A B^-1) - log det(A B^-1) - n = " << divergence << "\n"
+             << "  -log det(A)                      = " << barrier << endl;
+    TestUplo( LOWER, A, B, divergence, barrier );
+    TestUplo( UPPER, A, B, divergence, barrier );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrices",100);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestLogDetDivergence<double>( n, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestLogDetDivergence<Complex<double> >( n, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
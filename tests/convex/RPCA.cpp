@@ -0,0 +1,175 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/convex/RPCA.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+using namespace std;
+using namespace elem;
+
+// Corrupt a portion of the entries with uniform samples from the unit ball
+template<typename F>
+void Corrupt( DistMatrix<F>& A, double probCorrupt )
+{
+    typedef typename Base<F>::type R;
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            if( Abs(SampleUnitBall<R>()) <= probCorrupt )
+                A.SetLocal
+                ( iLocal, jLocal, A.GetLocal(iLocal,jLocal)+SampleUnitBall<F>() );
+}
+
+template<typename F>
+void TestRPCA
+( const string& label, const DistMatrix<F>& LTrue, const DistMatrix<F>& STrue,
+  const DistMatrix<F>& M, const RPCACtrl<typename Base<F>::type>& ctrl )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = M.Grid();
+
+    DistMatrix<F> L(g), S(g);
+    const RPCAInfo<R> info = RPCA( M, L, S, ctrl );
+
+    // Check that M = L + S and compare against the true components
+    DistMatrix<F> E(g);
+    E = M;
+    Axpy( F(-1), L, E );
+    Axpy( F(-1), S, E );
+    const R frobResid = FrobeniusNorm( E );
+    Axpy( F(-1), LTrue, L );
+    Axpy( F(-1), STrue, S );
+    const R frobLError = FrobeniusNorm( L );
+    const R frobSError = FrobeniusNorm( S );
+    const R frobM = FrobeniusNorm( M );
+    const R frobLTrue = FrobeniusNorm( LTrue );
+    const R frobSTrue = FrobeniusNorm( STrue );
+    if( g.Rank() == 0 )
+    {
+        cout << "  " << label << ":\n"
+             << "    " << ( info.converged ? "converged" : "did NOT converge" )
+             << " after " << info.numIts << " iterations\n"
+             << "    rank(L)                   = " << info.rank << "\n"
+             << "    nnz(S)                    = " << info.numNonzeros << "\n"
+             << "    ||M - L - S||_F / ||M||_F = " << frobResid/frobM << "\n"
+             << "    ||L - L_true||_F / ||L_true||_F = "
+             << frobLError/frobLTrue << "\n"
+             << "    ||S - S_true||_F / ||S_true||_F = "
+             << frobSError/frobSTrue << endl;
+    }
+}
+
+template<typename F>
+void TestRPCAVariants
+( int m, int n, int rank, double probCorrupt, int maxIts, double tol,
+  const Grid& g )
+{
+    typedef typename Base<F>::type R;
+
+    DistMatrix<F> LTrue(g), STrue(g), M(g);
+    {
+        DistMatrix<F> U(g), V(g);
+        Uniform( m, rank, U );
+        Uniform( n, rank, V );
+        Zeros( m, n, LTrue );
+        Gemm( NORMAL, ADJOINT, F(R(1)/std::max(m,n)), U, V, F(0), LTrue );
+    }
+    Zeros( m, n, STrue );
+    Corrupt( STrue, probCorrupt );
+    M = LTrue;
+    Axpy( F(1), STrue, M );
+
+    RPCACtrl<R> ctrl;
+    ctrl.maxIts = maxIts;
+    ctrl.tol = tol;
+
+    ctrl.approach = RPCA_ALM;
+    ctrl.lowRankSVT = false;
+    TestRPCA( "ALM", LTrue, STrue, M, ctrl );
+
+    ctrl.lowRankSVT = true;
+    TestRPCA( "ALM with low-rank SVT", LTrue, STrue, M, ctrl );
+
+    ctrl.approach = RPCA_ADMM;
+    ctrl.lowRankSVT = false;
+    TestRPCA( "ADMM", LTrue, STrue, M, ctrl );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",100);
+        const int n = Input("--width","width of matrix",100);
+        const int rank = Input("--rank","rank of structured matrix",5);
+        const double probCorrupt =
+            Input("--probCorrupt","probability of corruption",0.05);
+        const int maxIts = Input("--maxIts","maximum iterations",1000);
+        const double tol = Input("--tol","tolerance",1.e-6);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestRPCAVariants<double>( m, n, rank, probCorrupt, maxIts, tol, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestRPCAVariants<Complex<double> >
+        ( m, n, rank, probCorrupt, maxIts, tol, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,175 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/LowRank.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/convex/SingularValueSoftThreshold.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+using namespace std;
+using namespace elem;
+
+// Print ||B - A||_F / ||A||_F, where A is the dense soft-thresholding and B
+// is the low-rank (randomized) one
+template<typename F>
+void ReportDifference
+( const string& label, int rankA, int rankB,
+  typename Base<F>::type frobA, typename Base<F>::type frobDiff,
+  bool print )
+{
+    if( print )
+    {
+        cout << "  " << label << ":\n"
+             << "    dense rank          = " << rankA << "\n"
+             << "    low-rank rank       = " << rankB << "\n"
+             << "    ||A_dense||_F       = " << frobA << "\n"
+             << "    ||A_lr - A_dense||_F = " << frobDiff << "\n"
+             << "    relative difference = " << frobDiff/frobA << endl;
+    }
+}
+
+template<typename F>
+void TestSequential( int m, int n, int r, typename Base<F>::type tau )
+{
+    typedef typename Base<F>::type R;
+    const int commRank = mpi::CommRank( mpi::COMM_WORLD );
+
+    // Form an exactly rank-r matrix so that the randomized range finder
+    // captures its range
+    Matrix<F> X, Y, A;
+    Uniform( m, r, X );
+    Uniform( n, r, Y );
+    Zeros( m, n, A );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, F(0), A );
+
+    Matrix<F> ADense, ALowRank, U, V;
+    Matrix<R> s;
+    ADense = A;
+    ALowRank = A;
+    const int denseRank = SingularValueSoftThreshold( ADense, tau );
+    const int lowRank = SingularValueSoftThreshold( ALowRank, tau, U, s, V );
+    const R frobA = FrobeniusNorm( ADense );
+    Axpy( F(-1), ADense, ALowRank );
+    ReportDifference<F>
+    ( "Sequential", denseRank, lowRank, frobA, FrobeniusNorm( ALowRank ),
+      commRank == 0 );
+}
+
+template<typename F>
+void TestDistributed
+( int m, int n, int r, typename Base<F>::type tau, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+
+    DistMatrix<F> X(g), Y(g), A(g);
+    Uniform( m, r, X );
+    Uniform( n, r, Y );
+    Zeros( m, n, A );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, F(0), A );
+
+    DistMatrix<F> ADense(g), ALowRank(g), U(g), V(g);
+    DistMatrix<R,VR,STAR> s(g);
+    ADense = A;
+    ALowRank = A;
+    const int denseRank = SingularValueSoftThreshold( ADense, tau );
+    const int lowRank = SingularValueSoftThreshold( ALowRank, tau, U, s, V );
+    const R frobA = FrobeniusNorm( ADense );
+    Axpy( F(-1), ADense, ALowRank );
+    ReportDifference<F>
+    ( "Distributed", denseRank, lowRank, frobA, FrobeniusNorm( ALowRank ),
+      g.Rank() == 0 );
+
+    // Warm-start a second thresholding with the previous right factor
+    ALowRank = A;
+    const int warmRank = SingularValueSoftThreshold( ALowRank, tau, U, s, V );
+    Axpy( F(-1), ADense, ALowRank );
+    ReportDifference<F>
+    ( "Distributed (warm-started)", denseRank, warmRank, frobA,
+      FrobeniusNorm( ALowRank ), g.Rank() == 0 );
+
+    // Return the result in factored form
+    LowRankDistMatrix<F> L(g);
+    const int factoredRank = SingularValueSoftThreshold( A, tau, L );
+    DistMatrix<F> ALowRankDense(g);
+    Zeros( m, n, ALowRankDense );
+    Axpy( F(1), L, ALowRankDense );
+    Axpy( F(-1), ADense, ALowRankDense );
+    ReportDifference<F>
+    ( "Distributed (factored)", denseRank, factoredRank, frobA,
+      FrobeniusNorm( ALowRankDense ), g.Rank() == 0 );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",100);
+        const int n = Input("--width","width of matrix",80);
+        const int rank = Input("--rank","rank of matrix",5);
+        const double tau = Input("--tau","soft-threshold",1.);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestSequential<double>( m, n, rank, tau );
+        TestDistributed<double>( m, n, rank, tau, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestSequential<Complex<double> >( m, n, rank, tau );
+        TestDistributed<Complex<double> >( m, n, rank, tau, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,223 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include <cstdio>
+using namespace std;
+using namespace elem;
+
+// Count the local entries of B which differ from the corresponding entries
+// of A, which is stored on every process
+template<typename T,Distribution U,Distribution V>
+int
+NumMismatches( const DistMatrix<T,STAR,STAR>& A, const DistMatrix<T,U,V>& B )
+{
+    if( B.Height() != A.Height() || B.Width() != A.Width() )
+        return 1;
+    int numWrong = 0;
+    if( B.Participating() )
+    {
+        const int colShift = B.ColShift();
+        const int rowShift = B.RowShift();
+        const int colStride = B.ColStride();
+        const int rowStride = B.RowStride();
+        for( int jLocal=0; jLocal<B.LocalWidth(); ++jLocal )
+        {
+            const int j = rowShift + jLocal*rowStride;
+            for( int iLocal=0; iLocal<B.LocalHeight(); ++iLocal )
+            {
+                const int i = colShift + iLocal*colStride;
+                if( B.GetLocal(iLocal,jLocal) != A.GetLocal(i,j) )
+                    ++numWrong;
+            }
+        }
+    }
+    return numWrong;
+}
+
+// Write A from a [U,V] copy and read it back into [* ,* ], then write it from
+// [* ,* ] and read it back into [U,V]. Returns 1 if both round trips are exact.
+template<typename T,Distribution U,Distribution V>
+int
+RoundTrip( const string& filename, const DistMatrix<T,STAR,STAR>& A )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<T,U,V> B(g), BRead(g);
+    DistMatrix<T,STAR,STAR> ARead(g);
+    B = A;
+    B.WriteBinary( filename );
+    ARead.ReadBinary( filename );
+    int numWrong = NumMismatches( A, ARead );
+
+    A.WriteBinary( filename );
+    BRead.ReadBinary( filename );
+    numWrong += NumMismatches( A, BRead );
+    mpi::AllReduce( &numWrong, 1, mpi::SUM, g.Comm() );
+    return numWrong == 0;
+}
+
+// Overwrite the replicas of A which should not be written with garbage, so
+// that the file only matches A if the expected process wrote each entry.
+// Returns 1 if it does.
+template<typename T,Distribution U,Distribution V>
+int
+ReplicatedWrite
+( const string& filename, const DistMatrix<T,STAR,STAR>& A, bool writer )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<T,U,V> B(g);
+    DistMatrix<T,STAR,STAR> ARead(g);
+    B = A;
+    if( !writer )
+        for( int jLocal=0; jLocal<B.LocalWidth(); ++jLocal )
+            for( int iLocal=0; iLocal<B.LocalHeight(); ++iLocal )
+                B.SetLocal( iLocal, jLocal, T(-7) );
+    B.WriteBinary( filename );
+    ARead.ReadBinary( filename );
+    int numWrong = NumMismatches( A, ARead );
+    mpi::AllReduce( &numWrong, 1, mpi::SUM, g.Comm() );
+    return numWrong == 0;
+}
+
+template<typename T>
+void TestBinaryIO( const string& filename, int m, int n, const Grid& g )
+{
+    DistMatrix<T,STAR,STAR> A(g);
+    Uniform( m, n, A );
+
+    int numMatches = 0;
+    numMatches += RoundTrip<T,MC,  MR  >( filename, A );
+    numMatches += RoundTrip<T,MC,  STAR>( filename, A );
+    numMatches += RoundTrip<T,STAR,MR  >( filename, A );
+    numMatches += RoundTrip<T,MR,  MC  >( filename, A );
+    numMatches += RoundTrip<T,MR,  STAR>( filename, A );
+    numMatches += RoundTrip<T,STAR,MC  >( filename, A );
+    numMatches += RoundTrip<T,VC,  STAR>( filename, A );
+    numMatches += RoundTrip<T,STAR,VC  >( filename, A );
+    numMatches += RoundTrip<T,VR,  STAR>( filename, A );
+    numMatches += RoundTrip<T,STAR,VR  >( filename, A );
+    numMatches += RoundTrip<T,MD,  STAR>( filename, A );
+    numMatches += RoundTrip<T,STAR,MD  >( filename, A );
+    numMatches += RoundTrip<T,STAR,STAR>( filename, A );
+
+    // A view, whose local leading dimension exceeds its local height
+    DistMatrix<T> B(g), BView(g);
+    DistMatrix<T,STAR,STAR> BView_STAR_STAR(g), BRead(g);
+    B = A;
+    View( BView, B, 1, 2, m-3, n-2 );
+    BView_STAR_STAR = BView;
+    BView.WriteBinary( filename );
+    BRead.ReadBinary( filename );
+    int numWrong = NumMismatches( BView_STAR_STAR, BRead );
+    mpi::AllReduce( &numWrong, 1, mpi::SUM, g.Comm() );
+    numMatches += ( numWrong == 0 );
+
+    // Only the first process (in the viewing communicator) which stores each
+    // set of replicated entries should write them. Since the processes are
+    // ordered column-major within the grid, that is the process in the first
+    // row or column of the grid which shares its row or column rank.
+    const bool root = ( mpi::CommRank( g.ViewingComm() ) == 0 );
+    int numReplicated = 0;
+    numReplicated += ReplicatedWrite<T,MC,  STAR>( filename, A, g.Col()==0 );
+    numReplicated += ReplicatedWrite<T,STAR,MC  >( filename, A, g.Col()==0 );
+    numReplicated += ReplicatedWrite<T,MR,  STAR>( filename, A, g.Row()==0 );
+    numReplicated += ReplicatedWrite<T,STAR,MR  >( filename, A, g.Row()==0 );
+    numReplicated += ReplicatedWrite<T,STAR,STAR>( filename, A, root );
+    if( g.Rank() == 0 )
+    {
+        cout << "  round trips which match: " << numMatches << " of 14\n"
+             << "  replicated writes which match: " << numReplicated
+             << " of 5" << endl;
+        std::remove( filename.c_str() );
+    }
+    mpi::Barrier( g.Comm() );
+}
+
+// Reading a file into a matrix of a different datatype of the same size
+// should throw on every process. Returns 1 if it did.
+template<typename T,typename S>
+int
+MismatchThrows( const string& filename, const Grid& g )
+{
+    DistMatrix<T> A(g);
+    DistMatrix<S> B(g);
+    A.ResizeTo( 5, 3 );
+    A.WriteBinary( filename );
+    int threw = 0;
+    try { B.ReadBinary( filename ); }
+    catch( std::logic_error& e ) { threw = 1; }
+    mpi::AllReduce( &threw, 1, mpi::MIN, g.Comm() );
+    if( g.Rank() == 0 )
+        std::remove( filename.c_str() );
+    mpi::Barrier( g.Comm() );
+    return threw;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",37);
+        const int n = Input("--width","width of matrix",23);
+        const string filename =
+            Input("--filename","scratch file",string("BinaryIOTest.bin"));
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestBinaryIO<double>( filename, m, n, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestBinaryIO<Complex<double> >( filename, m, n, g );
+
+        // The header records the datatype, not just the entry size
+        int numThrew = 0;
+        numThrew += MismatchThrows<float,int>( filename, g );
+        numThrew += MismatchThrows<double,Complex<float> >( filename, g );
+        if( commRank == 0 )
+            cout << "Mismatched datatypes which throw: " << numThrew << " of 2"
+                 << endl;
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,270 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/matrices/Zeros.hpp"
+using namespace std;
+using namespace elem;
+
+// Overwrite each entry with a value determined by its (global) indices
+struct FillVisitor
+{
+    int height;
+
+    template<typename T>
+    void operator()( Matrix<T>& A )
+    {
+        typename Matrix<T>::Iterator it = A.Begin();
+        for( ; it!=A.End(); ++it )
+            *it = T(it.Row()+it.Col()*height);
+    }
+
+    template<typename T>
+    void operator()( AbstractDistMatrix<T>& A )
+    {
+        typename AbstractDistMatrix<T>::Iterator it = A.Begin();
+        for( ; it!=A.End(); ++it )
+            *it = T(it.Row()+it.Col()*height);
+    }
+};
+
+// Count the entries whose value or indices disagree with FillVisitor and
+// the number of entries visited
+struct CheckVisitor
+{
+    int height, numVisited, numWrong;
+
+    template<typename T>
+    void operator()( const Matrix<T>& A )
+    {
+        typename Matrix<T>::ConstIterator it = A.LockedBegin();
+        for( ; it!=A.LockedEnd(); ++it, ++numVisited )
+            if( *it != T(it.Row()+it.Col()*height) ||
+                &*it != A.LockedBuffer(it.Row(),it.Col()) )
+                ++numWrong;
+    }
+
+    template<typename T>
+    void operator()( const AbstractDistMatrix<T>& A )
+    {
+        typename AbstractDistMatrix<T>::ConstIterator it = A.LockedBegin();
+        for( ; it!=A.LockedEnd(); ++it, ++numVisited )
+        {
+            const int iLocal = it.LocalRow();
+            const int jLocal = it.LocalCol();
+            if( *it != T(it.Row()+it.Col()*height) ||
+                it.Row() != A.ColShift()+iLocal*A.ColStride() ||
+                it.Col() != A.RowShift()+jLocal*A.RowStride() ||
+                &*it != A.LockedBuffer(iLocal,jLocal) )
+                ++numWrong;
+        }
+    }
+};
+
+// Fill A through the type-erased interface and check every local entry, and
+// that each was visited exactly once. Returns 1 on success.
+int
+VisitLocalEntries( AutoDistMatrix<int>& A )
+{
+    FillVisitor fill;
+    fill.height = A.Height();
+    A.Visit( fill );
+    CheckVisitor check;
+    check.height = A.Height();
+    check.numVisited = 0;
+    check.numWrong = 0;
+    const AutoDistMatrix<int>& ALocked = A;
+    ALocked.Visit( check );
+    int numWrong = check.numWrong;
+    if( A.Participating() &&
+        check.numVisited != A.LocalHeight()*A.LocalWidth() )
+        ++numWrong;
+    mpi::AllReduce( &numWrong, 1, mpi::SUM, A.Grid().Comm() );
+    return numWrong == 0;
+}
+
+template<typename T,Distribution U,Distribution V>
+int
+VisitDistribution( int m, int n, const Grid& g )
+{
+    DistMatrix<T,U,V> A(g);
+    Zeros( m, n, A );
+    return VisitLocalEntries( A );
+}
+
+// Write a block with a leading dimension larger than its height through the
+// type-erased interface, check that only the block changed, and then read
+// it back into a buffer with yet another leading dimension. Returns 1 on
+// success.
+template<typename T,Distribution U,Distribution V>
+int
+BlockRoundTrip( int m, int n, const Grid& g )
+{
+    DistMatrix<T,U,V> A(g);
+    Zeros( m, n, A );
+    AutoDistMatrix<int>& AAuto = A;
+
+    const int i = m/3, j = n/4, height = m/2, width = n/2;
+    const int ldimIn = height+3, ldimOut = height+5;
+    const T padding = T(-1);
+    std::vector<T> blockIn( ldimIn*width, padding ),
+                   blockOut( ldimOut*width, padding );
+    for( int jBlock=0; jBlock<width; ++jBlock )
+        for( int iBlock=0; iBlock<height; ++iBlock )
+            blockIn[iBlock+jBlock*ldimIn] = T(1+iBlock+jBlock*height);
+    AAuto.SetBlock( i, j, height, width, &blockIn[0], ldimIn );
+
+    int numWrong = 0;
+    DistMatrix<T,STAR,STAR> A_STAR_STAR(g);
+    A_STAR_STAR = A;
+    for( int jA=0; jA<n; ++jA )
+    {
+        for( int iA=0; iA<m; ++iA )
+        {
+            const bool inBlock =
+                iA >= i && iA < i+height && jA >= j && jA < j+width;
+            const T expected =
+                ( inBlock ? T(1+(iA-i)+(jA-j)*height) : T(0) );
+            if( A_STAR_STAR.GetLocal(iA,jA) != expected )
+                ++numWrong;
+        }
+    }
+
+    AAuto.GetBlock( i, j, height, width, &blockOut[0], ldimOut );
+    for( int jBlock=0; jBlock<width; ++jBlock )
+    {
+        for( int iBlock=0; iBlock<ldimOut; ++iBlock )
+        {
+            const T expected =
+                ( iBlock < height ? T(1+iBlock+jBlock*height) : padding );
+            if( blockOut[iBlock+jBlock*ldimOut] != expected )
+                ++numWrong;
+        }
+    }
+    mpi::AllReduce( &numWrong, 1, mpi::SUM, g.Comm() );
+    return numWrong == 0;
+}
+
+template<typename T>
+void TestBulkAccess( int m, int n, const Grid& g )
+{
+    int numVisits = 0;
+    numVisits += VisitDistribution<T,MC,  MR  >( m, n, g );
+    numVisits += VisitDistribution<T,MR,  MC  >( m, n, g );
+    numVisits += VisitDistribution<T,VC,  STAR>( m, n, g );
+    numVisits += VisitDistribution<T,STAR,VR  >( m, n, g );
+    numVisits += VisitDistribution<T,MD,  STAR>( m, n, g );
+    numVisits += VisitDistribution<T,STAR,STAR>( m, n, g );
+
+    // A view, whose iterators must skip the rows outside of it
+    DistMatrix<T> B(g), BView(g);
+    Zeros( m+3, n+2, B );
+    View( BView, B, 2, 1, m, n );
+    numVisits += VisitLocalEntries( BView );
+
+    // A sequential matrix with padding between its columns
+    Matrix<T> C( m, n, m+4 );
+    AutoMatrix<int>& CAuto = C;
+    FillVisitor fill;
+    fill.height = m;
+    CAuto.Visit( fill );
+    CheckVisitor check;
+    check.height = m;
+    check.numVisited = 0;
+    check.numWrong = 0;
+    const AutoMatrix<int>& CLocked = C;
+    CLocked.Visit( check );
+    numVisits += ( check.numWrong == 0 && check.numVisited == m*n );
+
+    int numBlocks = 0;
+    numBlocks += BlockRoundTrip<T,MC,  MR  >( m, n, g );
+    numBlocks += BlockRoundTrip<T,MR,  MC  >( m, n, g );
+    numBlocks += BlockRoundTrip<T,MC,  STAR>( m, n, g );
+    numBlocks += BlockRoundTrip<T,STAR,MR  >( m, n, g );
+    numBlocks += BlockRoundTrip<T,VC,  STAR>( m, n, g );
+    numBlocks += BlockRoundTrip<T,STAR,VR  >( m, n, g );
+    numBlocks += BlockRoundTrip<T,MD,  STAR>( m, n, g );
+    numBlocks += BlockRoundTrip<T,STAR,STAR>( m, n, g );
+
+    // The same round trip for a sequential matrix
+    const int height = m/2, width = n/2, ldim = height+3;
+    std::vector<T> blockIn( ldim*width, T(-1) ), blockOut( ldim*width, T(-1) );
+    for( int jBlock=0; jBlock<width; ++jBlock )
+        for( int iBlock=0; iBlock<height; ++iBlock )
+            blockIn[iBlock+jBlock*ldim] = T(1+iBlock+jBlock*height);
+    CAuto.SetBlock( 1, 2, height, width, &blockIn[0], ldim );
+    CAuto.GetBlock( 1, 2, height, width, &blockOut[0], ldim );
+    numBlocks += ( blockIn == blockOut &&
+                   C.Get(0,2) == T(2*m) &&
+                   C.Get(1,2) == T(1) );
+
+    // The typed versions reject a buffer of the wrong datatype
+    int threw = 0;
+    std::vector<int> wrongType( ldim*width );
+    try { CAuto.GetBlock( 1, 2, height, width, &wrongType[0], ldim ); }
+    catch( std::logic_error& e ) { threw = 1; }
+
+    if( g.Rank() == 0 )
+        cout << "  visits which match:           " << numVisits << " of 8\n"
+             << "  block round trips which match: " << numBlocks << " of 9\n"
+             << "  wrong buffer type throws:      " << ( threw ? "yes" : "NO" )
+             << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",17);
+        const int n = Input("--width","width of matrix",13);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestBulkAccess<double>( m, n, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestBulkAccess<Complex<double> >( m, n, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
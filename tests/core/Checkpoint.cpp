@@ -0,0 +1,252 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include <cstdio>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+using namespace std;
+using namespace elem;
+
+// Remove a checkpoint directory along with any shards and manifests left in
+// it by an earlier run, so that the epochs always start from zero
+void RemoveDirectory( const string& dir )
+{
+    if( mpi::CommRank( mpi::COMM_WORLD ) == 0 )
+    {
+        DIR* d = opendir( dir.c_str() );
+        if( d != 0 )
+        {
+            struct dirent* entry;
+            while( (entry = readdir( d )) != 0 )
+            {
+                const string name = entry->d_name;
+                if( name != "." && name != ".." )
+                {
+                    const string path = dir + "/" + name;
+                    if( std::remove( path.c_str() ) != 0 )
+                        rmdir( path.c_str() );
+                }
+            }
+            closedir( d );
+            rmdir( dir.c_str() );
+        }
+    }
+    mpi::Barrier( mpi::COMM_WORLD );
+}
+
+// Count the entries of B which differ from the corresponding entries of A,
+// which is stored on every process
+template<typename T,Distribution U,Distribution V>
+int
+NumMismatches( const DistMatrix<T,STAR,STAR>& A, const DistMatrix<T,U,V>& B )
+{
+    int numWrong = 0;
+    if( B.Height() != A.Height() || B.Width() != A.Width() )
+        numWrong = 1;
+    else if( B.Participating() )
+    {
+        const int colShift = B.ColShift();
+        const int rowShift = B.RowShift();
+        const int colStride = B.ColStride();
+        const int rowStride = B.RowStride();
+        for( int jLocal=0; jLocal<B.LocalWidth(); ++jLocal )
+        {
+            const int j = rowShift + jLocal*rowStride;
+            for( int iLocal=0; iLocal<B.LocalHeight(); ++iLocal )
+            {
+                const int i = colShift + iLocal*colStride;
+                if( B.GetLocal(iLocal,jLocal) != A.GetLocal(i,j) )
+                    ++numWrong;
+            }
+        }
+    }
+    mpi::AllReduce( &numWrong, 1, mpi::SUM, mpi::COMM_WORLD );
+    return numWrong;
+}
+
+template<typename F>
+void TestCheckpoint
+( const string& dir, int m, int n, const Grid& g, const Grid& gTrans,
+  const Grid& tailGrid )
+{
+    typedef typename Base<F>::type R;
+    const int commRank = mpi::CommRank( mpi::COMM_WORLD );
+
+    DistMatrix<F> A(g), B(g), AOrig(g);
+    Uniform( m, n, A );
+    Uniform( n, m, B );
+    AOrig = A;
+    const R frobA = FrobeniusNorm( A );
+    const R frobB = FrobeniusNorm( B );
+
+    RemoveDirectory( dir );
+    Checkpoint ckpt( dir, g );
+    const int startEpoch = ckpt.Epoch();
+    ckpt.Begin();
+    ckpt.Save( "A", A );
+    ckpt.SetScalar( "iteration", 7 );
+    ckpt.End();
+    ckpt.Wait();
+
+    // Swap the roles of A and B in a second checkpoint and modify A before
+    // the writes have drained, since Save copies the local entries
+    ckpt.Begin();
+    ckpt.Save( "A", B );
+    ckpt.Save( "B", A );
+    Uniform( m, n, A );
+    ckpt.SetScalar( "iteration", 8 );
+    ckpt.End();
+    ckpt.Wait();
+
+    // Reload through a new handle with different distributions
+    Checkpoint restart( dir, g );
+    DistMatrix<F,VR,STAR> AReload(g);
+    DistMatrix<F,STAR,MC> BReload(g);
+    restart.Load( "A", AReload );
+    restart.Load( "B", BReload );
+    DistMatrix<F> E(g);
+    E = AReload;
+    Axpy( F(-1), B, E );
+    const R frobAError = FrobeniusNorm( E );
+    E = BReload;
+    Axpy( F(-1), AOrig, E );
+    const R frobBError = FrobeniusNorm( E );
+    const double iteration = restart.Scalar( "iteration" );
+
+    // Reload onto the transposed grid and onto a subgrid
+    DistMatrix<F,STAR,STAR> A_STAR_STAR(g), B_STAR_STAR(g);
+    A_STAR_STAR = AOrig;
+    B_STAR_STAR = B;
+    Checkpoint transRestart( dir, gTrans );
+    DistMatrix<F> ATrans(gTrans);
+    transRestart.Load( "A", ATrans );
+    const int numTransWrong = NumMismatches( B_STAR_STAR, ATrans );
+    Checkpoint tailRestart( dir, tailGrid );
+    DistMatrix<F> ATail(tailGrid);
+    DistMatrix<F,VC,STAR> BTail(tailGrid);
+    tailRestart.Load( "A", ATail );
+    tailRestart.Load( "B", BTail );
+    const int numTailWrong = NumMismatches( B_STAR_STAR, ATail ) +
+                             NumMismatches( A_STAR_STAR, BTail );
+
+    // Make the manifest impossible to replace and check that every process
+    // throws while the previous checkpoint remains committed
+    const string blocker = dir + "/checkpoint.txt.tmp";
+    if( commRank == 0 )
+        mkdir( blocker.c_str(), 0755 );
+    ckpt.Begin();
+    ckpt.Save( "A", A );
+    ckpt.End();
+    int threw = 0;
+    try { ckpt.Wait(); }
+    catch( std::runtime_error& e ) { threw = 1; }
+    int numThrew;
+    mpi::AllReduce( &threw, &numThrew, 1, mpi::SUM, mpi::COMM_WORLD );
+    if( commRank == 0 )
+        rmdir( blocker.c_str() );
+    mpi::Barrier( mpi::COMM_WORLD );
+    Checkpoint afterFailure( dir, g );
+
+    if( commRank == 0 )
+    {
+        cout << "  epochs                          = " << startEpoch << " -> "
+             << restart.Epoch() << "\n"
+             << "  iteration                       = " << iteration << "\n"
+             << "  ||A_reload - B||_F / ||B||_F    = " << frobAError/frobB
+             << "\n"
+             << "  ||B_reload - A||_F / ||A||_F    = " << frobBError/frobA
+             << "\n"
+             << "  wrong entries on transposed grid = " << numTransWrong
+             << "\n"
+             << "  wrong entries on trailing grid   = " << numTailWrong
+             << "\n"
+             << "  processes which threw           = " << numThrew << " of "
+             << mpi::CommSize( mpi::COMM_WORLD ) << "\n"
+             << "  epoch after failed commit       = " << afterFailure.Epoch()
+             << endl;
+    }
+    RemoveDirectory( dir );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",100);
+        const int n = Input("--width","width of matrix",80);
+        const string dir =
+            Input("--dir","checkpoint directory",string("CheckpointTest"));
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        const Grid gTrans( comm, c, r );
+
+        // A grid over the trailing half of the processes, which does not
+        // own the root
+        const int tailSize = commSize - commSize/2;
+        std::vector<int> tailRanks(tailSize);
+        for( int i=0; i<tailSize; ++i )
+            tailRanks[i] = commSize/2 + i;
+        mpi::Group group, tailGroup;
+        mpi::CommGroup( comm, group );
+        mpi::GroupIncl( group, tailSize, &tailRanks[0], tailGroup );
+        {
+            const Grid tailGrid( comm, tailGroup );
+
+            if( commRank == 0 )
+            {
+                cout << "---------------------\n"
+                     << "Testing with doubles:\n"
+                     << "---------------------" << endl;
+            }
+            TestCheckpoint<double>
+            ( dir+"-double", m, n, g, gTrans, tailGrid );
+
+            if( commRank == 0 )
+            {
+                cout << "--------------------------------------\n"
+                     << "Testing with double-precision complex:\n"
+                     << "--------------------------------------" << endl;
+            }
+            TestCheckpoint<Complex<double> >
+            ( dir+"-complex", m, n, g, gTrans, tailGrid );
+        }
+        mpi::GroupFree( tailGroup );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
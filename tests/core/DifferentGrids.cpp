@@ -60,6 +60,41 @@ main( int argc, char* argv[] )
         A = ASqrt;
         if( print )
             A.Print("A := ASqrt");
+
+        // Extract the diagonal on a grid which does not own rank 0, which
+        // relies upon every viewer knowing the grid's diagonal paths
+        const int tailSize = commSize - commSize/2;
+        std::vector<int> tailRanks(tailSize);
+        for( int i=0; i<tailSize; ++i )
+            tailRanks[i] = commSize/2 + i;
+        mpi::Group tailGroup;
+        mpi::GroupIncl( group, tailSize, &tailRanks[0], tailGroup );
+        {
+            const Grid tailGrid( comm, tailGroup );
+            DistMatrix<double> ATail(tailGrid);
+            DistMatrix<double,MD,STAR> dTail(tailGrid);
+            DistMatrix<double,STAR,STAR> dTail_STAR_STAR(tailGrid);
+            ATail = A;
+            ATail.GetDiagonal( dTail );
+            dTail_STAR_STAR = dTail;
+            if( print )
+                dTail_STAR_STAR.Print("diag(A) on the trailing grid");
+
+            int numWrong = 0;
+            if( tailGrid.InGrid() )
+            {
+                if( dTail_STAR_STAR.Height() != std::min(m,n) )
+                    ++numWrong;
+                for( int i=0; i<dTail_STAR_STAR.LocalHeight(); ++i )
+                    if( dTail_STAR_STAR.GetLocal(i,0) != 2. )
+                        ++numWrong;
+            }
+            mpi::AllReduce( &numWrong, 1, mpi::SUM, comm );
+            if( commRank == 0 )
+                std::cout << "Incorrect entries of diag(A) on the trailing "
+                          << "grid: " << numWrong << std::endl;
+        }
+        mpi::GroupFree( tailGroup );
     }
     catch( ArgException& e ) { }
     catch( std::exception& e )
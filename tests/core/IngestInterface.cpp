@@ -0,0 +1,237 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+#include <cstdio>
+#include <fstream>
+using namespace std;
+using namespace elem;
+
+// Count the entries of B which differ from the corresponding entries of A,
+// which is stored on every process
+template<typename T,Distribution U,Distribution V>
+int
+NumMismatches( const DistMatrix<T,STAR,STAR>& A, const DistMatrix<T,U,V>& B )
+{
+    int numWrong = 0;
+    if( B.Height() != A.Height() || B.Width() != A.Width() )
+        numWrong = 1;
+    else
+    {
+        const int colShift = B.ColShift();
+        const int rowShift = B.RowShift();
+        const int colStride = B.ColStride();
+        const int rowStride = B.RowStride();
+        for( int jLocal=0; jLocal<B.LocalWidth(); ++jLocal )
+        {
+            const int j = rowShift + jLocal*rowStride;
+            for( int iLocal=0; iLocal<B.LocalHeight(); ++iLocal )
+            {
+                const int i = colShift + iLocal*colStride;
+                if( B.GetLocal(iLocal,jLocal) != A.GetLocal(i,j) )
+                    ++numWrong;
+            }
+        }
+    }
+    mpi::AllReduce( &numWrong, 1, mpi::SUM, B.Grid().Comm() );
+    return numWrong;
+}
+
+// Split the rows of A into blocks of one to three rows, visit the blocks in
+// a shuffled order, and deal them out to the processes. Each process ingests
+// its blocks in that order, alternating between column-major views of A and
+// row-major copies, whenever there is room in the buffer. Returns the number
+// of mismatched entries and sets the number of calls to Exchange.
+template<typename T,Distribution U,Distribution V>
+int
+IngestShuffled
+( const DistMatrix<T,STAR,STAR>& A, std::size_t bufferSize, int& numExchanges )
+{
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+    const int p = g.Size();
+    const int rank = g.VCRank();
+
+    std::vector<int> blockStarts;
+    for( int i=0; i<m; i+=1+(i%3) )
+        blockStarts.push_back( i );
+    const int numBlocks = blockStarts.size();
+    std::vector<int> myStarts, mySizes;
+    for( int k=0; k<numBlocks; ++k )
+    {
+        // 7919 is prime, so k -> 7919 k mod numBlocks is a permutation unless
+        // numBlocks is a multiple of it
+        const int b = (7919*k) % numBlocks;
+        if( k % p == rank )
+        {
+            const int iEnd = ( b+1 < numBlocks ? blockStarts[b+1] : m );
+            myStarts.push_back( blockStarts[b] );
+            mySizes.push_back( iEnd-blockStarts[b] );
+        }
+    }
+
+    DistMatrix<T,U,V> B(g);
+    Zeros( m, n, B );
+    IngestInterface<T> ingest( B, bufferSize );
+    std::size_t next = 0;
+    int offset = 0;
+    numExchanges = 0;
+    do
+    {
+        while( next < myStarts.size() )
+        {
+            const int i = myStarts[next] + offset;
+            const int numRows = mySizes[next] - offset;
+            int numIngested;
+            if( next % 2 == 0 )
+            {
+                Matrix<T> X;
+                LockedView( X, A.LockedMatrix(), i, 0, numRows, n );
+                numIngested = ingest.Ingest( X, i );
+            }
+            else
+            {
+                std::vector<T> rows( numRows*n );
+                for( int k=0; k<numRows; ++k )
+                    for( int j=0; j<n; ++j )
+                        rows[k*n+j] = A.GetLocal(i+k,j);
+                numIngested = ingest.Ingest( &rows[0], numRows, i );
+            }
+            offset += numIngested;
+            if( offset < mySizes[next] )
+                break;
+            ++next;
+            offset = 0;
+        }
+        ++numExchanges;
+    } while( ingest.Exchange( next < myStarts.size() ) );
+    return NumMismatches( A, B );
+}
+
+// Ingest A from a file which stores it in row-major order after a header of
+// 'offset' bytes
+template<typename T,Distribution U,Distribution V>
+int
+IngestFromFile
+( const string& filename, int offset, const DistMatrix<T,STAR,STAR>& A,
+  std::size_t bufferSize )
+{
+    DistMatrix<T,U,V> B(A.Grid());
+    Zeros( A.Height(), A.Width(), B );
+    IngestInterface<T> ingest( B, bufferSize );
+    ingest.IngestFile( filename, offset );
+    return NumMismatches( A, B );
+}
+
+template<typename T>
+void TestIngest( const string& filename, int m, int n, const Grid& g )
+{
+    DistMatrix<T,STAR,STAR> A(g);
+    Uniform( m, n, A );
+
+    // Room for two rows (with their indices) on the widest grid row
+    const std::size_t bufferSize = 2*(n*sizeof(T)+g.Width()*sizeof(int));
+    int numExchanges_VC_STAR, numExchanges_MC_MR;
+    const int numWrong_VC_STAR =
+        IngestShuffled<T,VC,STAR>( A, bufferSize, numExchanges_VC_STAR );
+    const int numWrong_MC_MR =
+        IngestShuffled<T,MC,MR>( A, bufferSize, numExchanges_MC_MR );
+
+    const int offset = 16;
+    if( g.Rank() == 0 )
+    {
+        std::ofstream file( filename.c_str(), std::ios::binary );
+        const std::vector<char> header( offset, 'x' );
+        file.write( &header[0], offset );
+        for( int i=0; i<m; ++i )
+            for( int j=0; j<n; ++j )
+            {
+                const T alpha = A.GetLocal(i,j);
+                file.write( (const char*)&alpha, sizeof(T) );
+            }
+    }
+    mpi::Barrier( g.Comm() );
+    const int numFileWrong_VC_STAR =
+        IngestFromFile<T,VC,STAR>( filename, offset, A, bufferSize );
+    const int numFileWrong_MC_MR =
+        IngestFromFile<T,MC,MR>( filename, offset, A, bufferSize );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  shuffled rows into [VC,* ]: " << numWrong_VC_STAR
+             << " mismatched entries after " << numExchanges_VC_STAR
+             << " exchanges\n"
+             << "  shuffled rows into [MC,MR]: " << numWrong_MC_MR
+             << " mismatched entries after " << numExchanges_MC_MR
+             << " exchanges\n"
+             << "  file into [VC,* ]: " << numFileWrong_VC_STAR
+             << " mismatched entries\n"
+             << "  file into [MC,MR]: " << numFileWrong_MC_MR
+             << " mismatched entries" << endl;
+        std::remove( filename.c_str() );
+    }
+    mpi::Barrier( g.Comm() );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",97);
+        const int n = Input("--width","width of matrix",13);
+        const string filename =
+            Input("--filename","scratch file",string("IngestTest.bin"));
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestIngest<double>( filename, m, n, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestIngest<Complex<double> >( filename, m, n, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,145 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Herk.hpp"
+#include "elemental/blas-like/LowRank.hpp"
+#include "elemental/lapack-like/LowRank.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void TestLowRank( int m, int n, int r, int k, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+
+    // Form U = [U0, U0] and V = [V0, V0], so that A = U diag(s) V^H only has
+    // rank r despite its factors having 2r columns
+    DistMatrix<F> U0(g), V0(g), U(g), V(g), UL(g), UR(g), VL(g), VRight(g);
+    DistMatrix<R,VR,STAR> s(g);
+    Uniform( m, r, U0 );
+    Uniform( n, r, V0 );
+    Uniform( 2*r, 1, s );
+    Zeros( m, 2*r, U );
+    Zeros( n, 2*r, V );
+    View( UL, U, 0, 0, m, r );
+    View( UR, U, 0, r, m, r );
+    View( VL, V, 0, 0, n, r );
+    View( VRight, V, 0, r, n, r );
+    UL = U0;
+    UR = U0;
+    VL = V0;
+    VRight = V0;
+    LowRankDistMatrix<F> L(g);
+    L.Set( U, s, V );
+
+    DistMatrix<F> A(g);
+    Zeros( m, n, A );
+    Axpy( F(1), L, A );
+    const R frobA = FrobeniusNorm( A );
+    const R frobL = FrobeniusNorm( L );
+
+    // Compare a product through the factors with the dense product
+    DistMatrix<F> B(g), C(g), CDense(g);
+    Uniform( n, k, B );
+    Zeros( m, k, C );
+    Zeros( m, k, CDense );
+    Gemm( NORMAL, NORMAL, F(1), L, B, F(0), C );
+    Gemm( NORMAL, NORMAL, F(1), A, B, F(0), CDense );
+    const R frobCDense = FrobeniusNorm( CDense );
+    Axpy( F(-1), CDense, C );
+    const R frobGemmError = FrobeniusNorm( C );
+
+    // Recompression should find the true rank without changing A
+    const int newRank = Recompress( L );
+    DistMatrix<F> E(g);
+    E = A;
+    Axpy( F(-1), L, E );
+    const R frobRecompressError = FrobeniusNorm( E );
+
+    DistMatrix<F> Z(g);
+    Identity( newRank, newRank, Z );
+    Herk( UPPER, ADJOINT, F(-1), L.LockedU(), F(1), Z );
+    const R frobOrthogError = HermitianFrobeniusNorm( UPPER, Z );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  ||A||_F                      = " << frobA << "\n"
+             << "  |FrobeniusNorm(L) - ||A||_F| = " << Abs(frobL-frobA) << "\n"
+             << "  ||L B - A B||_F / ||A B||_F  = "
+             << frobGemmError/frobCDense << "\n"
+             << "  rank after Recompress        = " << newRank
+             << " (expected " << r << ")\n"
+             << "  ||A - L||_F / ||A||_F        = "
+             << frobRecompressError/frobA << "\n"
+             << "  ||U^H U - I||_F              = " << frobOrthogError << endl;
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",100);
+        const int n = Input("--width","width of matrix",80);
+        const int rank = Input("--rank","rank of matrix",10);
+        const int k = Input("--numRhs","width of multiplied matrix",20);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestLowRank<double>( m, n, rank, k, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestLowRank<Complex<double> >( m, n, rank, k, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
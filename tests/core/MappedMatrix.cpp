@@ -0,0 +1,161 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/blas-like/level3/Herk.hpp"
+#include "elemental/blas-like/level3/Trsm.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include <cstdio>
+using namespace std;
+using namespace elem;
+
+// A right-looking Cholesky factorization of the lower triangle of the mapped
+// matrix, which pages each panel in before it is factored and writes it back
+// (and drops its pages) once it is final
+template<typename F>
+void MappedCholesky( MappedMatrix<F>& A, int nb )
+{
+    const int n = A.Height();
+    A.Advise( MAPPED_SEQUENTIAL );
+    A.Prefetch( 0, std::min(nb,n) );
+    for( int k=0; k<n; k+=nb )
+    {
+        const int b = std::min(nb,n-k);
+        if( k+b < n )
+            A.Prefetch( k+b, std::min(nb,n-k-b) );
+
+        Matrix<F> A11, A21, A22;
+        View( A11, A, k,   k,   b,     b     );
+        View( A21, A, k+b, k,   n-k-b, b     );
+        View( A22, A, k+b, k+b, n-k-b, n-k-b );
+        Cholesky( LOWER, A11 );
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21 );
+        Herk( LOWER, NORMAL, F(-1), A21, F(1), A22 );
+
+        A.Release( k, b );
+    }
+    A.Flush();
+}
+
+// Mapping the file as a matrix of a different datatype should throw.
+// Returns 1 if it did.
+template<typename T>
+int
+MismatchThrows( const string& filename )
+{
+    int threw = 0;
+    try { MappedMatrix<T> A( filename, true ); }
+    catch( std::logic_error& e ) { threw = 1; }
+    return threw;
+}
+
+// Factor a file written by WriteBinary in place through a mapping on the
+// root and compare the flushed file with the distributed factorization
+template<typename F,typename FOther>
+void TestMappedCholesky( const string& filename, int n, int nb, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+
+    DistMatrix<F> A(g), L(g);
+    HermitianUniformSpectrum( n, A, R(1), R(10) );
+    A.WriteBinary( filename );
+
+    int threw = 0;
+    if( g.Rank() == 0 )
+    {
+        MappedMatrix<F> AMapped( filename );
+        MappedCholesky( AMapped, nb );
+        threw = MismatchThrows<FOther>( filename );
+    }
+    mpi::Barrier( g.Comm() );
+    L.ReadBinary( filename );
+
+    Cholesky( LOWER, A );
+    MakeTriangular( LOWER, A );
+    MakeTriangular( LOWER, L );
+    const R frobL = FrobeniusNorm( A );
+    Axpy( F(-1), A, L );
+    const R frobError = FrobeniusNorm( L );
+    if( g.Rank() == 0 )
+    {
+        cout << "  ||L_mapped - L||_F / ||L||_F = " << frobError/frobL << "\n"
+             << "  mismatched datatype throws   = " << ( threw ? "yes" : "NO" )
+             << endl;
+        std::remove( filename.c_str() );
+    }
+    mpi::Barrier( g.Comm() );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrix",300);
+        const int nb = Input("--nb","panel width",64);
+        const string filename =
+            Input("--filename","scratch file",string("MappedMatrixTest.bin"));
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+
+        // Map the double-precision file as single-precision complex, which
+        // has the same entry size, so that only the datatype differs
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestMappedCholesky<double,Complex<float> >( filename, n, nb, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestMappedCholesky<Complex<double>,double>( filename, n, nb, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,172 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Format A in the same way as Print, but directly from the local entries of
+// a [* ,* ] copy
+template<typename T>
+string
+Reference( const DistMatrix<T,STAR,STAR>& A, const string& msg )
+{
+    ostringstream os;
+    if( msg != "" )
+        os << msg << endl;
+    if( A.Height() > 0 && A.Width() > 0 )
+    {
+        for( int i=0; i<A.Height(); ++i )
+        {
+            for( int j=0; j<A.Width(); ++j )
+                os << A.GetLocal(i,j) << " ";
+            os << "\n";
+        }
+        os << endl;
+    }
+    return os.str();
+}
+
+// Print B into a string and compare it with the output expected for A,
+// which holds the same matrix. Returns 1 if they match on the root.
+template<typename T,Distribution U,Distribution V>
+int
+Compare( const DistMatrix<T,STAR,STAR>& A, const DistMatrix<T,U,V>& B )
+{
+    ostringstream os;
+    B.Print( os, "B" );
+    int matches = 1;
+    if( B.Grid().Rank() == 0 )
+        matches = ( os.str() == Reference( A, "B" ) );
+    else
+        matches = ( os.str() == "" );
+    mpi::AllReduce( &matches, 1, mpi::MIN, B.Grid().Comm() );
+    return matches;
+}
+
+template<typename T,Distribution U,Distribution V>
+int
+CompareRedistributed( const DistMatrix<T>& A )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A.Grid() );
+    DistMatrix<T,U,V> B( A.Grid() );
+    A_STAR_STAR = A;
+    B = A_STAR_STAR;
+    return Compare( A_STAR_STAR, B );
+}
+
+template<typename T>
+void TestPrint( int m, int n, const Grid& g )
+{
+    DistMatrix<T> A(g);
+    Uniform( m, n, A );
+
+    int numMatches = 0;
+    numMatches += CompareRedistributed<T,MC,  MR  >( A );
+    numMatches += CompareRedistributed<T,MC,  STAR>( A );
+    numMatches += CompareRedistributed<T,STAR,MR  >( A );
+    numMatches += CompareRedistributed<T,MR,  MC  >( A );
+    numMatches += CompareRedistributed<T,MR,  STAR>( A );
+    numMatches += CompareRedistributed<T,STAR,MC  >( A );
+    numMatches += CompareRedistributed<T,VC,  STAR>( A );
+    numMatches += CompareRedistributed<T,STAR,VC  >( A );
+    numMatches += CompareRedistributed<T,VR,  STAR>( A );
+    numMatches += CompareRedistributed<T,STAR,VR  >( A );
+    numMatches += CompareRedistributed<T,MD,  STAR>( A );
+    numMatches += CompareRedistributed<T,STAR,MD  >( A );
+    numMatches += CompareRedistributed<T,STAR,STAR>( A );
+
+    // A view whose first entry is not owned by the root
+    DistMatrix<T> AView(g);
+    View( AView, A, 1, 2, m-3, n-2 );
+    numMatches += CompareRedistributed<T,MC,MR>( AView );
+    DistMatrix<T,VC,STAR> A_VC_STAR(g), AView_VC_STAR(g);
+    A_VC_STAR = A;
+    View( AView_VC_STAR, A_VC_STAR, 3, 1, m-4, n-1 );
+    DistMatrix<T,STAR,STAR> AView_STAR_STAR(g);
+    AView_STAR_STAR = AView_VC_STAR;
+    numMatches += Compare( AView_STAR_STAR, AView_VC_STAR );
+
+    // An empty matrix only prints the message
+    DistMatrix<T> E(g);
+    DistMatrix<T,STAR,STAR> E_STAR_STAR(g);
+    numMatches += Compare( E_STAR_STAR, E );
+
+    if( g.Rank() == 0 )
+        cout << "  distributions which print as [* ,* ]: " << numMatches
+             << " of 16" << endl;
+}
+
+// A matrix with more than 2^20 entries is printed in several panels
+template<typename T>
+void TestPanels( const Grid& g )
+{
+    DistMatrix<T> A(g);
+    Uniform( (1<<19)+3, 2, A );
+    const int matches = CompareRedistributed<T,MC,MR>( A );
+    if( g.Rank() == 0 )
+        cout << "  multiple panels print as [* ,* ]: "
+             << ( matches ? "yes" : "NO" ) << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",17);
+        const int n = Input("--width","width of matrix",13);
+        const bool testPanels = Input("--panels","test multiple panels?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestPrint<double>( m, n, g );
+        if( testPanels )
+            TestPanels<double>( g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestPrint<Complex<double> >( m, n, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
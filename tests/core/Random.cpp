@@ -0,0 +1,180 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Count the local entries of B which differ from the corresponding entries
+// of the reference matrix R, which is stored on every process
+template<typename T,Distribution U,Distribution V>
+int
+NumMismatches( const DistMatrix<T,STAR,STAR>& R, const DistMatrix<T,U,V>& B )
+{
+    if( B.Height() != R.Height() || B.Width() != R.Width() )
+        return 1;
+    int numWrong = 0;
+    if( B.Participating() )
+    {
+        const int colShift = B.ColShift();
+        const int rowShift = B.RowShift();
+        const int colStride = B.ColStride();
+        const int rowStride = B.RowStride();
+        for( int jLocal=0; jLocal<B.LocalWidth(); ++jLocal )
+        {
+            const int j = rowShift + jLocal*rowStride;
+            for( int iLocal=0; iLocal<B.LocalHeight(); ++iLocal )
+            {
+                const int i = colShift + iLocal*colStride;
+                if( B.GetLocal(iLocal,jLocal) != R.GetLocal(i,j) )
+                    ++numWrong;
+            }
+        }
+    }
+    return numWrong;
+}
+
+// Fill a matrix on the grid g from the given seed and compare it against R
+template<typename T,Distribution U,Distribution V>
+void
+TestDistribution
+( const string& label, unsigned seed, const DistMatrix<T,STAR,STAR>& R,
+  const Grid& g )
+{
+    DistMatrix<T,U,V> B(g);
+    SetRandomSeed( seed );
+    Uniform( R.Height(), R.Width(), B );
+    int numWrong = NumMismatches( R, B );
+    mpi::AllReduce( &numWrong, 1, mpi::SUM, mpi::COMM_WORLD );
+    if( mpi::CommRank( mpi::COMM_WORLD ) == 0 )
+        cout << "  " << label << ": " << numWrong << " mismatched entries"
+             << endl;
+}
+
+template<typename T>
+void TestRandom
+( int m, int n, unsigned seed, const Grid& g, const Grid& gTrans,
+  const Grid& tailGrid )
+{
+    // The first stream after setting the seed is stream 0
+    DistMatrix<T,STAR,STAR> R(g);
+    SetRandomSeed( seed );
+    Uniform( m, n, R );
+    int numWrong = 0;
+    for( int j=0; j<n; ++j )
+        for( int i=0; i<m; ++i )
+            if( R.GetLocal(i,j) != SampleUnitBall<T>( 0, i, j ) )
+                ++numWrong;
+    mpi::AllReduce( &numWrong, 1, mpi::SUM, g.Comm() );
+    if( g.Rank() == 0 )
+        cout << "  [* ,* ] vs. stream 0: " << numWrong
+             << " mismatched entries" << endl;
+
+    // The same seed should produce the same matrix in any distribution and on
+    // any grid
+    TestDistribution<T,MC,  MR  >( "[MC,MR]", seed, R, g );
+    TestDistribution<T,VC,  STAR>( "[VC,* ]", seed, R, g );
+    TestDistribution<T,STAR,VR  >( "[* ,VR]", seed, R, g );
+    TestDistribution<T,MD,  STAR>( "[MD,* ]", seed, R, g );
+    TestDistribution<T,MC,  MR  >( "[MC,MR] on the transposed grid",
+                                   seed, R, gTrans );
+    TestDistribution<T,MC,  MR  >( "[MC,MR] on the trailing subgrid",
+                                   seed, R, tailGrid );
+    TestDistribution<T,MD,  STAR>( "[MD,* ] on the trailing subgrid",
+                                   seed, R, tailGrid );
+
+    // Advance the stream counter only on the owners of the subgrid. The next
+    // fill on the full grid should agree upon the next stream everywhere.
+    DistMatrix<T> A(g);
+    DistMatrix<T,STAR,STAR> RNext(g);
+    SetRandomSeed( seed );
+    NewRandomStream( g );
+    Uniform( m, n, RNext );
+    SetRandomSeed( seed );
+    if( tailGrid.InGrid() )
+    {
+        DistMatrix<T> ATail(tailGrid);
+        Uniform( m, n, ATail );
+    }
+    Uniform( m, n, A );
+    numWrong = NumMismatches( RNext, A );
+    mpi::AllReduce( &numWrong, 1, mpi::SUM, g.Comm() );
+    if( g.Rank() == 0 )
+        cout << "  [MC,MR] after a fill on the subgrid alone: " << numWrong
+             << " mismatched entries" << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",37);
+        const int n = Input("--width","width of matrix",23);
+        const int seed = Input("--seed","random seed",13);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        const Grid gTrans( comm, c, r );
+
+        // A grid over the trailing half of the processes, which does not
+        // own the root
+        const int tailSize = commSize - commSize/2;
+        std::vector<int> tailRanks(tailSize);
+        for( int i=0; i<tailSize; ++i )
+            tailRanks[i] = commSize/2 + i;
+        mpi::Group group, tailGroup;
+        mpi::CommGroup( comm, group );
+        mpi::GroupIncl( group, tailSize, &tailRanks[0], tailGroup );
+        {
+            const Grid tailGrid( comm, tailGroup );
+
+            if( commRank == 0 )
+            {
+                cout << "---------------------\n"
+                     << "Testing with doubles:\n"
+                     << "---------------------" << endl;
+            }
+            TestRandom<double>( m, n, seed, g, gTrans, tailGrid );
+
+            if( commRank == 0 )
+            {
+                cout << "--------------------------------------\n"
+                     << "Testing with double-precision complex:\n"
+                     << "--------------------------------------" << endl;
+            }
+            TestRandom<Complex<double> >( m, n, seed, g, gTrans, tailGrid );
+        }
+        mpi::GroupFree( tailGroup );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,229 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Ones.hpp"
+using namespace std;
+using namespace elem;
+
+// Each task appends its index to a log, so that the order in which the tasks
+// were run can be checked
+
+// A := value ones(m,n), which (re)allocates A
+struct Fill
+{
+    DistMatrix<double>* A;
+    int m, n;
+    double value;
+    vector<int>* log;
+    int index;
+    Fill
+    ( DistMatrix<double>& A_, int m_, int n_, double value_,
+      vector<int>& log_, int index_ )
+    : A(&A_), m(m_), n(n_), value(value_), log(&log_), index(index_) { }
+    void operator()()
+    {
+        log->push_back( index );
+        Ones( m, n, *A );
+        Scale( value, *A );
+    }
+};
+
+// A := alpha A, where A may be a view
+struct InPlaceScale
+{
+    DistMatrix<double>* A;
+    double alpha;
+    vector<int>* log;
+    int index;
+    InPlaceScale
+    ( DistMatrix<double>& A_, double alpha_, vector<int>& log_, int index_ )
+    : A(&A_), alpha(alpha_), log(&log_), index(index_) { }
+    void operator()()
+    {
+        log->push_back( index );
+        Scale( alpha, *A );
+    }
+};
+
+// B := alpha A
+struct ScaledCopy
+{
+    const DistMatrix<double>* A;
+    DistMatrix<double>* B;
+    double alpha;
+    vector<int>* log;
+    int index;
+    ScaledCopy
+    ( const DistMatrix<double>& A_, DistMatrix<double>& B_, double alpha_,
+      vector<int>& log_, int index_ )
+    : A(&A_), B(&B_), alpha(alpha_), log(&log_), index(index_) { }
+    void operator()()
+    {
+        log->push_back( index );
+        *B = *A;
+        Scale( alpha, *B );
+    }
+};
+
+// Return ||A - value ones||_F
+double
+Error( const DistMatrix<double>& A, int m, int n, double value )
+{
+    const Grid& g = A.Grid();
+    if( A.Height() != m || A.Width() != n )
+        return -1;
+    DistMatrix<double> E(g);
+    Ones( m, n, E );
+    Scale( -value, E );
+    Axpy( 1., A, E );
+    return FrobeniusNorm( E );
+}
+
+void
+TestOrdering( int n, const Grid& g )
+{
+    const int commRank = mpi::CommRank( mpi::COMM_WORLD );
+    vector<int> log;
+
+    // X and Y are empty when queued, and Z is reallocated by the task which
+    // writes to it, so the dependencies upon them can only be found through
+    // the identity of the matrices. The dependency of task 5 upon task 4 is
+    // through two distinct views of the same memory, whereas task 6 touches
+    // disjoint memory and should run first due to its priority.
+    DistMatrix<double> X(g), Y(g), Z(g), W(g), M(g), P(g);
+    DistMatrix<double> ML(g), MLCopy(g), MR(g);
+    Ones( 1, 1, Z );
+    Ones( n, 2*n, M );
+    View( ML, M, 0, 0, n, n );
+    View( MLCopy, M, 0, 0, n, n );
+    View( MR, M, 0, n, n, n );
+
+    TaskGraph graph( g );
+    graph.Enqueue( Fill( X, n, n, 2., log, 0 ) ).Writes( X );
+    graph.Enqueue( ScaledCopy( X, Y, 3., log, 1 ), 10 ).Reads( X ).Writes( Y );
+    graph.Enqueue( Fill( Z, 2*n, 2*n, 5., log, 2 ) ).Writes( Z );
+    graph.Enqueue( ScaledCopy( Z, W, 7., log, 3 ), 10 ).Reads( Z ).Writes( W );
+    graph.Enqueue( InPlaceScale( ML, 2., log, 4 ) ).Writes( ML );
+    graph.Enqueue( ScaledCopy( MLCopy, P, 1., log, 5 ), 10 )
+         .Reads( MLCopy ).Writes( P );
+    graph.Enqueue( InPlaceScale( MR, 3., log, 6 ), 10 ).Writes( MR );
+    graph.Wait();
+
+    const int expected[] = { 6, 0, 1, 2, 3, 4, 5 };
+    const bool ordered =
+        ( log.size() == 7 && equal( log.begin(), log.end(), expected ) );
+    const double yError = Error( Y, n, n, 6. );
+    const double wError = Error( W, 2*n, 2*n, 35. );
+    const double pError = Error( P, n, n, 2. );
+    const double mrError = Error( MR, n, n, 3. );
+    if( commRank == 0 )
+    {
+        cout << "  order of tasks:";
+        for( std::size_t k=0; k<log.size(); ++k )
+            cout << " " << log[k];
+        cout << ( ordered ? " (as expected)" : " (expected 6 0 1 2 3 4 5)" )
+             << "\n"
+             << "  ||Y - 6||_F  = " << yError << "\n"
+             << "  ||W - 35||_F = " << wError << "\n"
+             << "  ||P - 2||_F  = " << pError << "\n"
+             << "  ||MR - 3||_F = " << mrError << endl;
+    }
+}
+
+// Tasks on disjoint subgrids are only run by their owners, and a task on
+// the full grid which depends upon both runs after them
+void
+TestSubgrids( int n, const Grid& g )
+{
+    const int commRank = mpi::CommRank( mpi::COMM_WORLD );
+    const int p = g.Size();
+    if( p < 2 )
+        return;
+
+    vector<int> ranks( p );
+    for( int q=0; q<p; ++q )
+        ranks[q] = q;
+    mpi::Group firstHalf, secondHalf;
+    mpi::GroupIncl( g.OwningGroup(), p/2, &ranks[0], firstHalf );
+    mpi::GroupIncl( g.OwningGroup(), p-p/2, &ranks[p/2], secondHalf );
+    {
+        const Grid g0( g.ViewingComm(), firstHalf ),
+                   g1( g.ViewingComm(), secondHalf );
+
+        vector<int> log;
+        DistMatrix<double> A0(g0), A1(g1), B(g);
+        Ones( n, n, B );
+        TaskGraph graph( g );
+        graph.Enqueue( Fill( A0, n, n, 2., log, 0 ), g0 ).Writes( A0 );
+        graph.Enqueue( Fill( A1, n, n, 3., log, 1 ), g1 ).Writes( A1 );
+        graph.Enqueue( InPlaceScale( B, 4., log, 2 ), 10 )
+             .Reads( A0 ).Reads( A1 ).Writes( B );
+        graph.Wait();
+
+        const int expected = ( g0.InGrid() ? 0 : 1 );
+        int ordered = ( log.size() == 2 && log[0] == expected && log[1] == 2 );
+        mpi::AllReduce( &ordered, 1, mpi::MIN, g.ViewingComm() );
+        double error = ( g0.InGrid() ? Error( A0, n, n, 2. ) : 0. );
+        if( g1.InGrid() )
+            error += Error( A1, n, n, 3. );
+        mpi::AllReduce( &error, 1, mpi::MAX, g.ViewingComm() );
+        const double bError = Error( B, n, n, 4. );
+        if( commRank == 0 )
+        {
+            cout << "  subgrid tasks ran only on their owners and before the "
+                 << "dependent task: " << ( ordered ? "yes" : "NO" ) << "\n"
+                 << "  max ||A_k - (k+2)||_F = " << error << "\n"
+                 << "  ||B - 4||_F           = " << bError << endl;
+        }
+    }
+    mpi::GroupFree( firstHalf );
+    mpi::GroupFree( secondHalf );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrices",20);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+
+        TestOrdering( n, g );
+        TestSubgrids( n, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
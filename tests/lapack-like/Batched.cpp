@@ -0,0 +1,240 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/DiagonalScale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Batched.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// The problems have different sizes so that the plan balances their costs
+int
+ProblemSize( int n, int k )
+{ return n + 10*k; }
+
+template<typename F>
+void
+Free( vector<DistMatrix<F>*>& A )
+{
+    for( size_t k=0; k<A.size(); ++k )
+        delete A[k];
+}
+
+template<typename R>
+void
+Free( vector<DistMatrix<R,VR,STAR>*>& w )
+{
+    for( size_t k=0; k<w.size(); ++k )
+        delete w[k];
+}
+
+template<typename F>
+void TestHPDSolve
+( int numProblems, int n, int numRhs, int minLocalSize, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+
+    vector<DistMatrix<F>*> A( numProblems ), B( numProblems ),
+                           AOrig( numProblems ), BOrig( numProblems );
+    for( int k=0; k<numProblems; ++k )
+    {
+        const int nk = ProblemSize( n, k );
+        A[k] = new DistMatrix<F>( g );
+        B[k] = new DistMatrix<F>( g );
+        AOrig[k] = new DistMatrix<F>( g );
+        BOrig[k] = new DistMatrix<F>( g );
+        HermitianUniformSpectrum( nk, *A[k], R(1), R(10) );
+        Uniform( nk, numRhs, *B[k] );
+        *AOrig[k] = *A[k];
+        *BOrig[k] = *B[k];
+    }
+    BatchedHPDSolve( LOWER, NORMAL, A, B, minLocalSize );
+
+    // max_k ||A_k X_k - B_k||_F / (||A_k||_F ||X_k||_F)
+    R maxResidual = 0;
+    for( int k=0; k<numProblems; ++k )
+    {
+        const R frobA = FrobeniusNorm( *AOrig[k] );
+        const R frobX = FrobeniusNorm( *B[k] );
+        Gemm( NORMAL, NORMAL, F(-1), *AOrig[k], *B[k], F(1), *BOrig[k] );
+        const R frobResid = FrobeniusNorm( *BOrig[k] );
+        maxResidual = std::max( maxResidual, frobResid/(frobA*frobX) );
+    }
+    if( g.Rank() == 0 )
+        cout << "  BatchedHPDSolve:\n"
+             << "    max ||A X - B||_F / (||A||_F ||X||_F)     = "
+             << maxResidual << endl;
+    Free( A );
+    Free( B );
+    Free( AOrig );
+    Free( BOrig );
+}
+
+template<typename F>
+void TestHermitianEig
+( int numProblems, int n, int minLocalSize, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+
+    vector<DistMatrix<F>*> A( numProblems ), Z( numProblems );
+    vector<DistMatrix<R,VR,STAR>*> w( numProblems );
+    for( int k=0; k<numProblems; ++k )
+    {
+        A[k] = new DistMatrix<F>( g );
+        Z[k] = new DistMatrix<F>( g );
+        w[k] = new DistMatrix<R,VR,STAR>( g );
+        HermitianUniformSpectrum( ProblemSize( n, k ), *A[k], R(-5), R(5) );
+    }
+    BatchedHermitianEig( LOWER, A, w, Z, minLocalSize );
+
+    // max_k ||A_k Z_k - Z_k diag(w_k)||_F / ||A_k||_F
+    R maxResidual = 0;
+    bool sizesMatch = true;
+    for( int k=0; k<numProblems; ++k )
+    {
+        const int nk = ProblemSize( n, k );
+        DistMatrix<F> ZW(g);
+        ZW = *Z[k];
+        DiagonalScale( RIGHT, NORMAL, *w[k], ZW );
+        Gemm( NORMAL, NORMAL, F(1), *A[k], *Z[k], F(-1), ZW );
+        const R frobA = FrobeniusNorm( *A[k] );
+        const R frobResid = FrobeniusNorm( ZW );
+        maxResidual = std::max( maxResidual, frobResid/frobA );
+        if( w[k]->Height() != nk || Z[k]->Height() != nk || 
+            Z[k]->Width() != nk )
+            sizesMatch = false;
+    }
+    if( g.Rank() == 0 )
+        cout << "  BatchedHermitianEig:\n"
+             << "    sizes of w and Z match A                  = "
+             << ( sizesMatch ? "yes" : "NO" ) << "\n"
+             << "    max ||A Z - Z diag(w)||_F / ||A||_F       = "
+             << maxResidual << endl;
+    Free( A );
+    Free( Z );
+    Free( w );
+}
+
+template<typename F>
+void TestSVD( int numProblems, int n, int minLocalSize, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+
+    vector<DistMatrix<F>*> A( numProblems ), AOrig( numProblems ),
+                           V( numProblems );
+    vector<DistMatrix<R,VR,STAR>*> s( numProblems );
+    for( int k=0; k<numProblems; ++k )
+    {
+        A[k] = new DistMatrix<F>( g );
+        AOrig[k] = new DistMatrix<F>( g );
+        V[k] = new DistMatrix<F>( g );
+        s[k] = new DistMatrix<R,VR,STAR>( g );
+        Uniform( ProblemSize( n, k )+5, ProblemSize( n, k ), *A[k] );
+        *AOrig[k] = *A[k];
+    }
+    BatchedSVD( A, s, V, minLocalSize );
+
+    // max_k ||A_k - U_k diag(s_k) V_k^H||_F / ||A_k||_F
+    R maxResidual = 0;
+    for( int k=0; k<numProblems; ++k )
+    {
+        const R frobA = FrobeniusNorm( *AOrig[k] );
+        DiagonalScale( RIGHT, NORMAL, *s[k], *A[k] );
+        Gemm( NORMAL, ADJOINT, F(-1), *A[k], *V[k], F(1), *AOrig[k] );
+        const R frobResid = FrobeniusNorm( *AOrig[k] );
+        maxResidual = std::max( maxResidual, frobResid/frobA );
+    }
+    if( g.Rank() == 0 )
+        cout << "  BatchedSVD:\n"
+             << "    max ||A - U diag(s) V^H||_F / ||A||_F    = "
+             << maxResidual << endl;
+    Free( A );
+    Free( AOrig );
+    Free( V );
+    Free( s );
+}
+
+template<typename F>
+void TestBatched
+( int numProblems, int n, int numRhs, int minLocalSize, const Grid& g )
+{
+    TestHPDSolve<F>( numProblems, n, numRhs, minLocalSize, g );
+    TestHermitianEig<F>( numProblems, n, minLocalSize, g );
+    TestSVD<F>( numProblems, n, minLocalSize, g );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int numProblems = Input("--numProblems","number of problems",5);
+        const int n = Input("--size","size of smallest problem",30);
+        const int numRhs = Input("--numRhs","number of right-hand sides",10);
+        const int minLocalSize =
+            Input("--minLocalSize","minimum local matrix size",20);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestBatched<double>( numProblems, n, numRhs, minLocalSize, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestBatched<Complex<double> >
+        ( numProblems, n, numRhs, minLocalSize, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
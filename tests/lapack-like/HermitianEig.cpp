@@ -338,6 +338,10 @@ main( int argc, char* argv[] )
         const int m = Input("--height","height of matrix",100);
         const int nb = Input("--nb","algorithmic blocksize",96);
         const int nbLocal = Input("--nbLocal","local blocksize",32);
+        const int bandwidth = Input
+            ("--bandwidth","bandwidth for two-stage tridiag",32);
+        const int sdcCutoff = Input
+            ("--sdcCutoff","largest subproblem solved directly by SDC",32);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -352,6 +356,7 @@ main( int argc, char* argv[] )
         SetBlocksize( nb );
         SetLocalSymvBlocksize<double>( nbLocal );
         SetLocalSymvBlocksize<Complex<double> >( nbLocal );
+        SetHermitianTridiagBandwidth( bandwidth );
         if( range != 'A' && range != 'I' && range != 'V' )
             throw logic_error("'range' must be 'A', 'I', or 'V'");
         if( onlyEigvals && testCorrectness && commRank==0 )
@@ -404,6 +409,17 @@ main( int argc, char* argv[] )
         ( testCorrectness, print, 
           onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
 
+        if( commRank == 0 )
+        {
+            cout << "---------------------------------------------\n"
+                 << "Double-precision two-stage tridiag algorithm:\n"
+                 << "---------------------------------------------" << endl;
+        }
+        SetHermitianTridiagApproach( HERMITIAN_TRIDIAG_TWO_STAGE );
+        TestHermitianEigDouble
+        ( testCorrectness, print, 
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
+
         if( commRank == 0 )
         {
             cout << "--------------------------------------------------\n"
@@ -443,6 +459,70 @@ main( int argc, char* argv[] )
         TestHermitianEigDoubleComplex
         ( testCorrectness, print, 
           onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
+
+        if( commRank == 0 )
+        {
+            cout << "-----------------------------------------------------\n"
+                 << "Double-precision complex two-stage tridiag algorithm:\n"
+                 << "-----------------------------------------------------"
+                 << endl;
+        }
+        SetHermitianTridiagApproach( HERMITIAN_TRIDIAG_TWO_STAGE );
+        TestHermitianEigDoubleComplex
+        ( testCorrectness, print, 
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------------------\n"
+                 << "Double-precision divide-and-conquer tridiag eig:\n"
+                 << "--------------------------------------------------" 
+                 << endl;
+        }
+        SetHermitianTridiagApproach( HERMITIAN_TRIDIAG_DEFAULT );
+        SetHermitianTridiagEigApproach
+        ( HERMITIAN_TRIDIAG_EIG_DIVIDE_AND_CONQUER );
+        TestHermitianEigDouble
+        ( testCorrectness, print, 
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
+
+        if( commRank == 0 )
+        {
+            cout << "------------------------------------------------\n"
+                 << "Double-precision complex divide-and-conquer \n"
+                 << "tridiag eig:\n"
+                 << "------------------------------------------------"
+                 << endl;
+        }
+        TestHermitianEigDoubleComplex
+        ( testCorrectness, print, 
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
+        SetHermitianTridiagEigApproach( HERMITIAN_TRIDIAG_EIG_DEFAULT );
+
+        // Spectral divide and conquer is only used for the full spectrum
+        if( commRank == 0 )
+        {
+            cout << "---------------------------------------------\n"
+                 << "Double-precision spectral divide and conquer:\n"
+                 << "---------------------------------------------" << endl;
+        }
+        SetHermitianEigApproach( HERMITIAN_EIG_SDC );
+        SetHermitianEigSDCCutoff( sdcCutoff );
+        TestHermitianEigDouble
+        ( testCorrectness, print, 
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
+
+        if( commRank == 0 )
+        {
+            cout << "-----------------------------------------------------\n"
+                 << "Double-precision complex spectral divide and conquer:\n"
+                 << "-----------------------------------------------------"
+                 << endl;
+        }
+        TestHermitianEigDoubleComplex
+        ( testCorrectness, print, 
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, g );
+        SetHermitianEigApproach( HERMITIAN_EIG_TRIDIAG );
     }
     catch( ArgException& e ) { }
     catch( exception& e )
@@ -0,0 +1,147 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/lapack-like/HermitianFunction.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename R>
+class ExpFunctor
+{
+public:
+    R operator()( R alpha ) const { return Exp(alpha); }
+};
+
+// The Fermi-Dirac function 1/(1+exp(beta (x-mu)))
+template<typename R>
+class FermiDiracFunctor
+{
+public:
+    FermiDiracFunctor( R beta, R mu ) : beta_(beta), mu_(mu) { }
+    R operator()( R alpha ) const { return 1/(1+Exp(beta_*(alpha-mu_))); }
+private:
+    R beta_, mu_;
+};
+
+// Compare the Chebyshev approximations of f(A), both distributed and
+// sequential, against the result of the eigenvalue decomposition
+template<typename F,class RealFunctor>
+void TestFunction
+( const string& label, const DistMatrix<F>& A, const RealFunctor& f )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+
+    DistMatrix<F> fA(g), fAEig(g);
+    // RealHermitianFunction only forms the lower triangle of f(A)
+    fAEig = A;
+    RealHermitianFunction( LOWER, fAEig, f );
+    MakeHermitian( LOWER, fAEig );
+    const R frobFAEig = FrobeniusNorm( fAEig );
+
+    fA = A;
+    const int degree = ChebyshevHermitianFunction( LOWER, fA, f );
+    Axpy( F(-1), fAEig, fA );
+    const R frobError = FrobeniusNorm( fA );
+
+    // Each process redundantly runs the sequential version
+    DistMatrix<F,STAR,STAR> A_STAR_STAR(g), fAEig_STAR_STAR(g);
+    A_STAR_STAR = A;
+    fAEig_STAR_STAR = fAEig;
+    const int seqDegree =
+        ChebyshevHermitianFunction( LOWER, A_STAR_STAR.Matrix(), f );
+    Axpy( F(-1), fAEig_STAR_STAR.LockedMatrix(), A_STAR_STAR.Matrix() );
+    const R frobSeqError = FrobeniusNorm( A_STAR_STAR.LockedMatrix() );
+    if( g.Rank() == 0 )
+    {
+        cout << "  " << label << ":\n"
+             << "    degree (distributed)           = " << degree << "\n"
+             << "    ||p(A) - f(A)||_F / ||f(A)||_F = "
+             << frobError/frobFAEig << "\n"
+             << "    degree (sequential)            = " << seqDegree << "\n"
+             << "    ||p(A) - f(A)||_F / ||f(A)||_F = "
+             << frobSeqError/frobFAEig << endl;
+    }
+}
+
+template<typename F>
+void TestChebyshev( int n, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    DistMatrix<F> A(g);
+    HermitianUniformSpectrum( n, A, R(-2), R(2) );
+    TestFunction( "exp", A, ExpFunctor<R>() );
+    TestFunction( "Fermi-Dirac", A, FermiDiracFunctor<R>( R(4), R(0) ) );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrix",100);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestChebyshev<double>( n, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestChebyshev<Complex<double> >( n, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,265 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/DiagonalScale.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Exp.hpp"
+#include "elemental/lapack-like/HermitianEig.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/Sign.hpp"
+#include "elemental/lapack-like/SquareRoot.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+using namespace std;
+using namespace elem;
+
+// Overwrite A with a random matrix whose eigenvalues are (with high
+// probability) clustered around shift for the first numPositive diagonal
+// entries and around -shift for the rest
+template<typename F>
+void ShiftedUniform
+( int n, int numPositive, typename Base<F>::type shift, DistMatrix<F>& A )
+{
+    Uniform( n, n, A );
+    for( int j=0; j<n; ++j )
+        A.Update( j, j, ( j < numPositive ? shift : -shift ) );
+}
+
+// Push the eigenvalues of the Hermitian matrix A at least a unit away from 0
+template<typename R>
+class SeparateFunctor
+{
+public:
+    R operator()( R alpha ) const { return ( alpha >= 0 ? alpha+1 : alpha-1 ); }
+};
+
+template<typename R>
+class SignFunctor
+{
+public:
+    R operator()( R alpha ) const { return ( alpha >= 0 ? R(1) : R(-1) ); }
+};
+
+template<typename R>
+class ExpFunctor
+{
+public:
+    R operator()( R alpha ) const { return Exp(alpha); }
+};
+
+// Overwrite the Hermitian matrix A with V f(Lambda) V^H, where A = V Lambda V^H
+// is formed by HermitianEig
+template<typename F,class RealFunctor>
+void ApplyToSpectrum( DistMatrix<F>& A, const RealFunctor& f )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    DistMatrix<R,VR,STAR> w(g);
+    DistMatrix<F> V(g), VW(g);
+    HermitianEig( LOWER, A, w, V );
+    for( int iLocal=0; iLocal<w.LocalHeight(); ++iLocal )
+        w.SetLocal( iLocal, 0, f(w.GetLocal(iLocal,0)) );
+    VW = V;
+    DiagonalScale( RIGHT, NORMAL, w, VW );
+    Gemm( NORMAL, ADJOINT, F(1), VW, V, F(0), A );
+}
+
+// A Hermitian matrix with eigenvalues in [-2,-1] and [1,2]
+template<typename F>
+void SeparatedHermitian( int n, DistMatrix<F>& A )
+{
+    typedef typename Base<F>::type R;
+    HermitianUniformSpectrum( n, A, R(-1), R(1) );
+    ApplyToSpectrum( A, SeparateFunctor<R>() );
+}
+
+template<typename F>
+void TestSign( int n, int maxIts, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+
+    // S = sign(A) should satisfy S^2 = I and S A = A S
+    DistMatrix<F> A(g), S(g), T(g), SA(g);
+    ShiftedUniform( n, n/2, 3*Sqrt(R(n)), A );
+    S = A;
+    const int numIts = Sign( S, maxIts );
+
+    Identity( n, n, T );
+    Gemm( NORMAL, NORMAL, F(1), S, S, F(-1), T );
+    const R frobS = FrobeniusNorm( S );
+    const R frobSquareError = FrobeniusNorm( T );
+
+    Zeros( n, n, SA );
+    Gemm( NORMAL, NORMAL, F(1), S, A, F(0), SA );
+    Gemm( NORMAL, NORMAL, F(-1), A, S, F(1), SA );
+    const R frobA = FrobeniusNorm( A );
+    const R frobCommError = FrobeniusNorm( SA );
+
+    // For Hermitian A, sign(A) = V sign(Lambda) V^H
+    DistMatrix<F> H(g), SH(g), SEig(g);
+    SeparatedHermitian( n, H );
+    SH = H;
+    const int numHermIts = Sign( SH, maxIts );
+    SEig = H;
+    ApplyToSpectrum( SEig, SignFunctor<R>() );
+    const R frobSEig = FrobeniusNorm( SEig );
+    Axpy( F(-1), SEig, SH );
+    const R frobHermError = FrobeniusNorm( SH );
+    if( g.Rank() == 0 )
+    {
+        cout << "  Sign:\n"
+             << "    iterations                         = " << numIts << "\n"
+             << "    ||S^2 - I||_F / ||S||_F^2          = "
+             << frobSquareError/(frobS*frobS) << "\n"
+             << "    ||S A - A S||_F / (||S||_F ||A||_F) = "
+             << frobCommError/(frobS*frobA) << "\n"
+             << "  Hermitian sign:\n"
+             << "    iterations                         = " << numHermIts
+             << "\n"
+             << "    ||S - V sign(L) V^H||_F / ||V sign(L) V^H||_F = "
+             << frobHermError/frobSEig << endl;
+    }
+}
+
+template<typename F>
+void TestExp( int n, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+
+    // exp(A) exp(-A) should be the identity
+    DistMatrix<F> A(g), EPlus(g), EMinus(g), T(g);
+    Uniform( n, n, A );
+    Scale( R(1)/Sqrt(R(n)), A );
+    EPlus = A;
+    Exp( EPlus );
+    EMinus = A;
+    Scale( F(-1), EMinus );
+    Exp( EMinus );
+
+    Identity( n, n, T );
+    Gemm( NORMAL, NORMAL, F(1), EPlus, EMinus, F(-1), T );
+    const R frobEPlus = FrobeniusNorm( EPlus );
+    const R frobEMinus = FrobeniusNorm( EMinus );
+    const R frobError = FrobeniusNorm( T );
+
+    // For Hermitian A, exp(A) = V exp(Lambda) V^H
+    DistMatrix<F> H(g), EH(g), EEig(g);
+    HermitianUniformSpectrum( n, H, R(-4), R(4) );
+    EH = H;
+    Exp( EH );
+    EEig = H;
+    ApplyToSpectrum( EEig, ExpFunctor<R>() );
+    const R frobEEig = FrobeniusNorm( EEig );
+    Axpy( F(-1), EEig, EH );
+    const R frobHermError = FrobeniusNorm( EH );
+    if( g.Rank() == 0 )
+    {
+        cout << "  Exp:\n"
+             << "    ||exp(A) exp(-A) - I||_F / "
+             << "(||exp(A)||_F ||exp(-A)||_F) = "
+             << frobError/(frobEPlus*frobEMinus) << "\n"
+             << "  Hermitian exp:\n"
+             << "    ||exp(A) - V exp(L) V^H||_F / ||V exp(L) V^H||_F = "
+             << frobHermError/frobEEig << endl;
+    }
+}
+
+template<typename F>
+void TestSquareRoot( int n, int maxIts, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+
+    // X = A^{1/2} should satisfy X^2 = A
+    DistMatrix<F> A(g), X(g), T(g);
+    ShiftedUniform( n, n, 3*Sqrt(R(n)), A );
+    X = A;
+    const int numIts = SquareRoot( X, maxIts );
+
+    T = A;
+    Gemm( NORMAL, NORMAL, F(1), X, X, F(-1), T );
+    const R frobA = FrobeniusNorm( A );
+    const R frobError = FrobeniusNorm( T );
+    if( g.Rank() == 0 )
+    {
+        cout << "  SquareRoot:\n"
+             << "    iterations              = " << numIts << "\n"
+             << "    ||X^2 - A||_F / ||A||_F = " << frobError/frobA << endl;
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrix",100);
+        const int maxIts = Input("--maxIts","maximum iterations",100);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestSign<double>( n, maxIts, g );
+        TestExp<double>( n, g );
+        TestSquareRoot<double>( n, maxIts, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestSign<Complex<double> >( n, maxIts, g );
+        TestExp<Complex<double> >( n, g );
+        TestSquareRoot<Complex<double> >( n, maxIts, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
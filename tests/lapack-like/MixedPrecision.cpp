@@ -0,0 +1,157 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Hemm.hpp"
+#include "elemental/lapack-like/MixedPrecision.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+using namespace std;
+using namespace elem;
+
+// Print ||B - op(A) X||_F / (||A||_F ||X||_F + ||B||_F), the (normwise)
+// backward error of the computed solution, which should be O(n eps) in
+// double precision despite the factorizations being in single precision
+template<typename F>
+void ReportBackwardError
+( const string& label, int numIts,
+  const DistMatrix<F>& A, const DistMatrix<F>& B, const DistMatrix<F>& X,
+  const DistMatrix<F>& Residual )
+{
+    typedef typename Base<F>::type R;
+    const R frobA = FrobeniusNorm( A );
+    const R frobB = FrobeniusNorm( B );
+    const R frobX = FrobeniusNorm( X );
+    const R frobResid = FrobeniusNorm( Residual );
+    if( A.Grid().Rank() == 0 )
+    {
+        cout << "  " << label << ":\n"
+             << "    iterations          = " << numIts << "\n"
+             << "    ||B - A X||_F       = " << frobResid << "\n"
+             << "    relative residual   = "
+             << frobResid/(frobA*frobX+frobB) << endl;
+    }
+}
+
+template<typename F>
+void TestMixedPrecision
+( int m, int numRhs, int krylovSize, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    DistMatrix<F> A(g), B(g), X(g), Residual(g);
+
+    // Classical refinement with a single-precision Cholesky factorization
+    HermitianUniformSpectrum( m, A, R(1), R(10) );
+    Uniform( m, numRhs, B );
+    X = B;
+    const int hpdIts =
+        mixed_precision::HPDSolve( LOWER, NORMAL, A, X, 50, krylovSize );
+    Residual = B;
+    Hemm( LEFT, LOWER, F(-1), A, X, F(1), Residual );
+    ReportBackwardError( "HPDSolve", hpdIts, A, B, X, Residual );
+
+    // Classical refinement with a single-precision LU factorization
+    Uniform( m, m, A );
+    X = B;
+    const int luIts =
+        mixed_precision::GaussianElimination( A, X, 50, krylovSize );
+    Residual = B;
+    Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), Residual );
+    ReportBackwardError( "GaussianElimination", luIts, A, B, X, Residual );
+
+    // GMRES-IR, preconditioned by the same single-precision LU factorization
+    mixed_precision::LUOperator<F> op( A );
+    Zeros( m, numRhs, X );
+    const int gmresIts = mixed_precision::GMRES( op, B, X, 50, krylovSize );
+    Residual = B;
+    Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), Residual );
+    ReportBackwardError( "GMRES", gmresIts, A, B, X, Residual );
+
+    // Refinement of the semi-normal equations, A^H A X = A^H B
+    DistMatrix<F> C(g), D(g), Y(g);
+    Uniform( 2*m, m, C );
+    Uniform( 2*m, numRhs, D );
+    const int lsIts = mixed_precision::LeastSquares( C, D, Y, 50, krylovSize );
+    DistMatrix<F> AHD(g);
+    Zeros( m, numRhs, AHD );
+    Gemm( ADJOINT, NORMAL, F(1), C, D, F(0), AHD );
+    Residual = D;
+    Gemm( NORMAL, NORMAL, F(-1), C, Y, F(1), Residual );
+    Zeros( m, numRhs, X );
+    Gemm( ADJOINT, NORMAL, F(1), C, Residual, F(0), X );
+    ReportBackwardError( "LeastSquares (A^H (B - A X))", lsIts, C, AHD, Y, X );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int m = Input("--height","height of matrix",100);
+        const int numRhs = Input("--numRhs","number of right-hand sides",10);
+        const int krylovSize = Input("--krylovSize","GMRES restart size",30);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+
+        if( commRank == 0 )
+        {
+            cout << "-------------------------------------------\n"
+                 << "Testing with doubles (float factorizations):\n"
+                 << "-------------------------------------------" << endl;
+        }
+        TestMixedPrecision<double>( m, numRhs, krylovSize, g );
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------------------------------------\n"
+                 << "Testing with double-precision complex (single-\n"
+                 << "precision complex factorizations):\n"
+                 << "---------------------------------------------------"
+                 << endl;
+        }
+        TestMixedPrecision<Complex<double> >( m, numRhs, krylovSize, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
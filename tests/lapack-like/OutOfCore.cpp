@@ -0,0 +1,184 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/LU.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/OutOfCore.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include <cstdio>
+using namespace std;
+using namespace elem;
+
+// The out-of-core factorizations should reproduce the in-core ones up to
+// the rounding errors from the different order of the updates
+template<typename F>
+void TestCholesky
+( const string& filename, int n, int panelWidth, int numResident,
+  const Grid& g )
+{
+    typedef typename Base<F>::type R;
+
+    DistMatrix<F> A(g), L(g);
+    HermitianUniformSpectrum( n, A, R(1), R(10) );
+    A.WriteBinary( filename );
+    OutOfCoreCholesky<F>( LOWER, filename, panelWidth, numResident, g );
+    L.ReadBinary( filename );
+
+    Cholesky( LOWER, A );
+    MakeTriangular( LOWER, A );
+    MakeTriangular( LOWER, L );
+    const R frobL = FrobeniusNorm( A );
+    Axpy( F(-1), A, L );
+    const R frobError = FrobeniusNorm( L );
+    if( g.Rank() == 0 )
+    {
+        cout << "  Cholesky:\n"
+             << "    ||L_ooc - L||_F / ||L||_F = " << frobError/frobL << endl;
+        std::remove( filename.c_str() );
+    }
+    mpi::Barrier( g.Comm() );
+}
+
+template<typename F>
+void TestLU
+( const string& filename, int n, int panelWidth, int numResident,
+  const Grid& g )
+{
+    typedef typename Base<F>::type R;
+
+    DistMatrix<F> A(g), B(g);
+    DistMatrix<int,VC,STAR> p(g), pInCore(g);
+    Uniform( n, n, A );
+    A.WriteBinary( filename );
+    OutOfCoreLU<F>( filename, p, panelWidth, numResident, g );
+    B.ReadBinary( filename );
+
+    LU( A, pInCore );
+    const R frobLU = FrobeniusNorm( A );
+    Axpy( F(-1), A, B );
+    const R frobError = FrobeniusNorm( B );
+
+    DistMatrix<int,STAR,STAR> p_STAR_STAR(g), pInCore_STAR_STAR(g);
+    p_STAR_STAR = p;
+    pInCore_STAR_STAR = pInCore;
+    int numMismatches = 0;
+    for( int i=0; i<n; ++i )
+        if( p_STAR_STAR.GetLocal(i,0) != pInCore_STAR_STAR.GetLocal(i,0) )
+            ++numMismatches;
+    if( g.Rank() == 0 )
+    {
+        cout << "  LU:\n"
+             << "    mismatched pivots               = " << numMismatches
+             << "\n"
+             << "    ||LU_ooc - LU||_F / ||LU||_F    = " << frobError/frobLU
+             << endl;
+        std::remove( filename.c_str() );
+    }
+    mpi::Barrier( g.Comm() );
+}
+
+// Both factorizations should reject a nonsquare file on every process
+template<typename F>
+void TestNonsquare
+( const string& filename, int n, int panelWidth, const Grid& g )
+{
+    DistMatrix<F> A(g);
+    DistMatrix<int,VC,STAR> p(g);
+    Uniform( n, n+1, A );
+    A.WriteBinary( filename );
+    int numThrew = 0;
+    try { OutOfCoreCholesky<F>( LOWER, filename, panelWidth, 1, g ); }
+    catch( std::logic_error& e ) { ++numThrew; }
+    try { OutOfCoreLU<F>( filename, p, panelWidth, 1, g ); }
+    catch( std::logic_error& e ) { ++numThrew; }
+    mpi::AllReduce( &numThrew, 1, mpi::MIN, g.Comm() );
+    if( g.Rank() == 0 )
+    {
+        cout << "  nonsquare file rejected by both: " 
+             << ( numThrew == 2 ? "yes" : "NO" ) << endl;
+        std::remove( filename.c_str() );
+    }
+    mpi::Barrier( g.Comm() );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrix",100);
+        const int panelWidth = Input("--panelWidth","width of panels",16);
+        const int numResident =
+            Input("--numResident","number of resident panels",1);
+        const string filename =
+            Input("--filename","matrix file",string("OutOfCoreTest.bin"));
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestCholesky<double>( filename, n, panelWidth, numResident, g );
+        TestLU<double>( filename, n, panelWidth, numResident, g );
+        TestNonsquare<double>( filename, n, panelWidth, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestCholesky<Complex<double> >
+        ( filename, n, panelWidth, numResident, g );
+        TestLU<Complex<double> >( filename, n, panelWidth, numResident, g );
+        TestNonsquare<Complex<double> >( filename, n, panelWidth, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
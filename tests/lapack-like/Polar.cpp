@@ -0,0 +1,173 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level3/Herk.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/Polar.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Overwrite A with a random n x n matrix whose singular values lie in
+// [shift-2 sqrt(n),shift+2 sqrt(n)] (with high probability)
+template<typename F>
+void ShiftedUniform( int n, typename Base<F>::type shift, Matrix<F>& A )
+{
+    Uniform( n, n, A );
+    for( int j=0; j<n; ++j )
+        A.Update( j, j, shift );
+}
+
+template<typename F>
+void ShiftedUniform( int n, typename Base<F>::type shift, DistMatrix<F>& A )
+{
+    Uniform( n, n, A );
+    for( int j=0; j<n; ++j )
+        A.Update( j, j, shift );
+}
+
+template<typename F>
+void TestSequential( int n, typename Base<F>::type shift, int maxIts )
+{
+    typedef typename Base<F>::type R;
+    const int commRank = mpi::CommRank( mpi::COMM_WORLD );
+
+    Matrix<F> A, Q, P, Z;
+    ShiftedUniform( n, shift, A );
+    Q = A;
+    const int numIts = polar::NewtonSchulz( Q, maxIts );
+
+    Identity( n, n, Z );
+    Herk( UPPER, ADJOINT, F(-1), Q, F(1), Z );
+    const R frobOrthog = HermitianFrobeniusNorm( UPPER, Z );
+
+    // Compare against the SVD-based polar factor
+    Polar( A, P );
+    const R frobQ = FrobeniusNorm( A );
+    Axpy( F(-1), A, Q );
+    const R frobDiff = FrobeniusNorm( Q );
+    if( commRank == 0 )
+    {
+        cout << "  Sequential:\n"
+             << "    iterations                    = " << numIts << "\n"
+             << "    ||Q^H Q - I||_F               = " << frobOrthog << "\n"
+             << "    ||Q - Q_svd||_F / ||Q_svd||_F = " << frobDiff/frobQ
+             << endl;
+    }
+}
+
+template<typename F>
+void TestDistributed
+( int n, typename Base<F>::type shift, int maxIts, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+
+    DistMatrix<F> A(g), Q(g), P(g), Z(g);
+    ShiftedUniform( n, shift, A );
+    Q = A;
+    const int numIts = polar::NewtonSchulz( Q, maxIts );
+
+    Identity( n, n, Z );
+    Herk( UPPER, ADJOINT, F(-1), Q, F(1), Z );
+    const R frobOrthog = HermitianFrobeniusNorm( UPPER, Z );
+
+    Polar( A, P );
+    const R frobQ = FrobeniusNorm( A );
+    Axpy( F(-1), A, Q );
+    const R frobDiff = FrobeniusNorm( Q );
+    if( g.Rank() == 0 )
+    {
+        cout << "  Distributed:\n"
+             << "    iterations                    = " << numIts << "\n"
+             << "    ||Q^H Q - I||_F               = " << frobOrthog << "\n"
+             << "    ||Q - Q_svd||_F / ||Q_svd||_F = " << frobDiff/frobQ
+             << endl;
+    }
+}
+
+template<typename F>
+void TestNewtonSchulz( int n, int maxIts, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    const R wellConditionedShift = 3*Sqrt(R(n));
+    if( g.Rank() == 0 )
+        cout << " Well-conditioned (Newton-Schulz only):" << endl;
+    TestSequential<F>( n, wellConditionedShift, maxIts );
+    TestDistributed<F>( n, wellConditionedShift, maxIts, g );
+
+    if( g.Rank() == 0 )
+        cout << " Ill-conditioned (falls back to QDWH):" << endl;
+    TestSequential<F>( n, R(0), maxIts );
+    TestDistributed<F>( n, R(0), maxIts, g );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrix",100);
+        const int maxIts = Input("--maxIts","maximum Newton-Schulz its",10);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestNewtonSchulz<double>( n, maxIts, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestNewtonSchulz<Complex<double> >( n, maxIts, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
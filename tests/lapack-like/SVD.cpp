@@ -0,0 +1,215 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/DiagonalScale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/SVD.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+using namespace std;
+using namespace elem;
+
+// || Q^H Q - I ||_F
+template<typename F>
+typename Base<F>::type
+Orthogonality( const DistMatrix<F>& Q )
+{
+    DistMatrix<F> X( Q.Grid() );
+    Identity( Q.Width(), Q.Width(), X );
+    Gemm( ADJOINT, NORMAL, F(1), Q, Q, F(-1), X );
+    return FrobeniusNorm( X );
+}
+
+// || A - U diag(s) V^H ||_F / || A ||_F
+template<typename F>
+typename Base<F>::type
+RelativeResidual
+( const DistMatrix<F>& A, const DistMatrix<F>& U,
+  const DistMatrix<typename Base<F>::type,VR,STAR>& s, const DistMatrix<F>& V )
+{
+    DistMatrix<F> E( A.Grid() ), US( A.Grid() );
+    E = A;
+    US = U;
+    DiagonalScale( RIGHT, NORMAL, s, US );
+    Gemm( NORMAL, ADJOINT, F(-1), US, V, F(1), E );
+    return FrobeniusNorm( E ) / FrobeniusNorm( A );
+}
+
+// Compute the SVD of A, then its singular values alone, and report the
+// residual, the orthogonality of both sets of singular vectors, and how
+// closely the two sets of singular values agree
+template<typename F>
+void TestSVD( const string& label, const DistMatrix<F>& A )
+{
+    typedef typename Base<F>::type R;
+    const Grid& g = A.Grid();
+    DistMatrix<F> U(g), V(g);
+    DistMatrix<R,VR,STAR> s(g), sOnly(g);
+    U = A;
+    SVD( U, s, V );
+    const R residual = RelativeResidual( A, U, s, V );
+    const R orthogU = Orthogonality( U );
+    const R orthogV = Orthogonality( V );
+
+    DistMatrix<F> B(g);
+    B = A;
+    SVD( B, sOnly );
+    Axpy( R(-1), s, sOnly );
+    const R sError = FrobeniusNorm( sOnly ) / FrobeniusNorm( s );
+    if( g.Rank() == 0 )
+        cout << "  " << label << ":\n"
+             << "    ||A - U S V^H||_F / ||A||_F = " << residual << "\n"
+             << "    ||U^H U - I||_F = " << orthogU << "\n"
+             << "    ||V^H V - I||_F = " << orthogV << "\n"
+             << "    ||s - s_only||_2 / ||s||_2 = " << sError << endl;
+}
+
+// Form the upper bidiagonal matrix with diagonal d and superdiagonal e
+template<typename F>
+void Bidiagonal
+( const DistMatrix<typename Base<F>::type,STAR,STAR>& d,
+  const DistMatrix<typename Base<F>::type,STAR,STAR>& e, DistMatrix<F>& B )
+{
+    const int k = d.Height();
+    Zeros( k, k, B );
+    for( int i=0; i<k; ++i )
+    {
+        B.Set( i, i, d.GetLocal(i,0) );
+        if( i+1 < k )
+            B.Set( i, i+1, e.GetLocal(i,0) );
+    }
+}
+
+// Run svd::BidiagSVD directly on a well-conditioned bidiagonal, which it
+// should accept, and on one with a tiny trailing diagonal entry, which it
+// should refuse so that GolubReinsch falls back to the bidiagonal QR algorithm
+template<typename F>
+void TestBidiagSVD( int k, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    DistMatrix<R,STAR,STAR> d(g), e(g);
+    Uniform( k, 1, d );
+    Uniform( k-1, 1, e );
+    for( int i=0; i<k; ++i )
+        d.SetLocal( i, 0, R(3)/R(2)+d.GetLocal(i,0)/R(2) );
+    for( int i=0; i<k-1; ++i )
+        e.SetLocal( i, 0, e.GetLocal(i,0)/R(4) );
+
+    DistMatrix<R,VR,STAR> s(g);
+    DistMatrix<F,STAR,VR> U_STAR_VR(g), V_STAR_VR(g);
+    const bool accepted = svd::BidiagSVD<F>( d, e, s, U_STAR_VR, V_STAR_VR );
+    DistMatrix<F> B(g), U(g), V(g);
+    Bidiagonal( d, e, B );
+    U = U_STAR_VR;
+    V = V_STAR_VR;
+    const R residual = RelativeResidual( B, U, s, V );
+    const R orthogU = Orthogonality( U );
+    const R orthogV = Orthogonality( V );
+
+    d.SetLocal( k-1, 0, R(1e-8) );
+    const bool refused = !svd::BidiagSVD<F>( d, e, s, U_STAR_VR, V_STAR_VR );
+    if( g.Rank() == 0 )
+        cout << "  BidiagSVD on a well-conditioned bidiagonal:\n"
+             << "    accepted = " << ( accepted ? "yes" : "NO" ) << "\n"
+             << "    ||B - U S V^H||_F / ||B||_F = " << residual << "\n"
+             << "    ||U^H U - I||_F = " << orthogU << "\n"
+             << "    ||V^H V - I||_F = " << orthogV << "\n"
+             << "  BidiagSVD on an ill-conditioned bidiagonal:\n"
+             << "    refused = " << ( refused ? "yes" : "NO" ) << endl;
+}
+
+template<typename F>
+void TestSVDPaths( int n, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    TestBidiagSVD<F>( n, g );
+
+    // Shifting a uniform matrix by n keeps its singular values within a
+    // constant factor of n, so BidiagSVD accepts its bidiagonal
+    DistMatrix<F> A(g);
+    Uniform( n, n, A );
+    for( int j=0; j<n; ++j )
+        A.Update( j, j, F(n) );
+    TestSVD( "well-conditioned square matrix", A );
+
+    // Scaling the columns geometrically down to 1e-10 forces the fallback
+    DistMatrix<R,VR,STAR> scales(g);
+    Zeros( n, 1, scales );
+    for( int j=0; j<n; ++j )
+        scales.Set( j, 0, Pow( R(10), -R(10)*j/std::max(n-1,1) ) );
+    DiagonalScale( RIGHT, NORMAL, scales, A );
+    TestSVD( "ill-conditioned square matrix", A );
+
+    // A matrix with between one and two times as many rows as there are
+    // columns on all of the processes only takes the tall-skinny path once
+    // the ratio is lowered from its default of two
+    const int p = g.Size();
+    const int nSkinny = std::max(n/4,1);
+    const int mSkinny = (3*p*nSkinny)/2 + 1;
+    const double ratio = GetSVDTallSkinnyRatio();
+    SetSVDTallSkinnyRatio( 1 );
+    Uniform( mSkinny, nSkinny, A );
+    TestSVD( "tall-skinny matrix with the ratio forced to one", A );
+    SetSVDTallSkinnyRatio( ratio );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--size","size of matrix",60);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestSVDPaths<double>( n, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestSVDPaths<Complex<double> >( n, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
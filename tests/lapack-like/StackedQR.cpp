@@ -0,0 +1,184 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/QR.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+using namespace std;
+using namespace elem;
+
+// The packed Householder QR factorization of a general matrix
+template<typename Real>
+void HouseholderQR( DistMatrix<Real>& A )
+{ QR( A ); }
+
+template<typename Real>
+void HouseholderQR( DistMatrix<Complex<Real> >& A )
+{
+    DistMatrix<Complex<Real>,MD,STAR> t( A.Grid() );
+    QR( A, t );
+}
+
+// || A - B ||_F / || B ||_F for sequential matrices
+template<typename F>
+typename Base<F>::type
+RelativeDifference( const Matrix<F>& A, const Matrix<F>& B )
+{
+    Matrix<F> E;
+    E = A;
+    Axpy( F(-1), B, E );
+    return FrobeniusNorm( E ) / FrobeniusNorm( B );
+}
+
+// Factor [A; B], with A m x n and B n x n upper triangular, with the stacked
+// routines and compare against the Householder QR factorization of the
+// explicit stacked matrix, both in parallel and sequentially
+template<typename F>
+void TestStacked( const string& label, int m, int n, bool identity,
+                  const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    DistMatrix<F> A(g), B(g), C(g), CT(g), CB(g);
+    Uniform( m, n, A );
+    if( identity )
+        Identity( n, n, B );
+    else
+    {
+        Uniform( n, n, B );
+        MakeTriangular( UPPER, B );
+    }
+    Zeros( m+n, n, C );
+    View( CT, C, 0, 0, m, n );
+    View( CB, C, m, 0, n, n );
+    CT = A;
+    CB = B;
+    const R frobC = FrobeniusNorm( C );
+
+    // Since the bottom block of each Householder vector is zero below the
+    // window of rows which qr::Stacked touches, the packed factorizations
+    // should agree entry for entry
+    DistMatrix<F> CStacked(g), CQR(g);
+    DistMatrix<F,MD,STAR> t(g);
+    CStacked = C;
+    qr::Stacked( CStacked, t );
+    CQR = C;
+    HouseholderQR( CQR );
+    const R frobCQR = FrobeniusNorm( CQR );
+    Axpy( F(-1), CStacked, CQR );
+    const R packedError = FrobeniusNorm( CQR ) / frobCQR;
+
+    DistMatrix<F> Q(g), QRef(g), RFact(g), RView(g), E(g), X(g);
+    Q = C;
+    qr::ExplicitStacked( Q );
+    QRef = C;
+    qr::Explicit( QRef );
+    Axpy( F(-1), Q, QRef );
+    const R QError = FrobeniusNorm( QRef ) / Sqrt( R(n) );
+
+    LockedView( RView, CStacked, 0, 0, n, n );
+    RFact = RView;
+    MakeTriangular( UPPER, RFact );
+    E = C;
+    Gemm( NORMAL, NORMAL, F(-1), Q, RFact, F(1), E );
+    const R residual = FrobeniusNorm( E ) / frobC;
+    Identity( n, n, X );
+    Gemm( ADJOINT, NORMAL, F(1), Q, Q, F(-1), X );
+    const R orthog = FrobeniusNorm( X );
+
+    // The sequential versions, on every process, against the parallel ones
+    DistMatrix<F,STAR,STAR> C_STAR_STAR(g), CStacked_STAR_STAR(g),
+                            Q_STAR_STAR(g);
+    C_STAR_STAR = C;
+    CStacked_STAR_STAR = CStacked;
+    Q_STAR_STAR = Q;
+    Matrix<F> CSeq, QSeq, tSeq;
+    CSeq = C_STAR_STAR.Matrix();
+    qr::Stacked( CSeq, tSeq );
+    QSeq = C_STAR_STAR.Matrix();
+    qr::ExplicitStacked( QSeq );
+    R seqError = std::max
+        ( RelativeDifference( CSeq, CStacked_STAR_STAR.Matrix() ),
+          RelativeDifference( QSeq, Q_STAR_STAR.Matrix() ) );
+    mpi::AllReduce( &seqError, 1, mpi::MAX, g.Comm() );
+
+    if( g.Rank() == 0 )
+        cout << "  " << label << ":\n"
+             << "    ||Stacked - QR||_F / ||QR||_F = " << packedError << "\n"
+             << "    ||Q_stacked - Q||_F / ||Q||_F = " << QError << "\n"
+             << "    ||[A; B] - Q R||_F / ||[A; B]||_F = " << residual << "\n"
+             << "    ||Q^H Q - I||_F = " << orthog << "\n"
+             << "    sequential vs. parallel = " << seqError << endl;
+}
+
+template<typename F>
+void TestStackedQR( int n, const Grid& g )
+{
+    TestStacked<F>( "square top block over the identity", n, n, true, g );
+    TestStacked<F>
+    ( "tall top block over an upper triangle", n+13, n, false, g );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--width","width of matrix",40);
+        const int nb = Input("--nb","algorithmic blocksize",16);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        SetBlocksize( nb );
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestStackedQR<double>( n, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestStackedQR<Complex<double> >( n, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/QR.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Factor a tall [VC,* ] matrix with qr::TS and report the residual, the
+// orthogonality of the explicit Q, and the size of the part of R below its
+// diagonal
+template<typename F>
+void TestTSQR( int m, int n, const Grid& g )
+{
+    typedef typename Base<F>::type R;
+    DistMatrix<F,VC,STAR> A_VC_STAR(g), Q_VC_STAR(g);
+    DistMatrix<F,STAR,STAR> R_STAR_STAR(g);
+    Uniform( m, n, A_VC_STAR );
+    Q_VC_STAR = A_VC_STAR;
+    qr::TS( Q_VC_STAR, R_STAR_STAR );
+
+    DistMatrix<F> A(g), Q(g), RFact(g), RLower(g), X(g);
+    A = A_VC_STAR;
+    Q = Q_VC_STAR;
+    RFact = R_STAR_STAR;
+    const R frobA = FrobeniusNorm( A );
+    Gemm( NORMAL, NORMAL, F(-1), Q, RFact, F(1), A );
+    const R residual = FrobeniusNorm( A ) / frobA;
+
+    Identity( n, n, X );
+    Gemm( ADJOINT, NORMAL, F(1), Q, Q, F(-1), X );
+    const R orthog = FrobeniusNorm( X );
+
+    RLower = RFact;
+    MakeTriangular( LOWER, RLower );
+    for( int j=0; j<n; ++j )
+        RLower.Set( j, j, F(0) );
+    const R frobLower = FrobeniusNorm( RLower );
+
+    // Fewer rows than the processes have columns between them should throw
+    int threw = 0;
+    DistMatrix<F,VC,STAR> B_VC_STAR(g);
+    Uniform( g.Size()*n-1, n, B_VC_STAR );
+    try { qr::TS( B_VC_STAR, R_STAR_STAR ); }
+    catch( std::logic_error& e ) { threw = 1; }
+    mpi::AllReduce( &threw, 1, mpi::MIN, g.Comm() );
+
+    if( g.Rank() == 0 )
+        cout << "  ||A - Q R||_F / ||A||_F = " << residual << "\n"
+             << "  ||Q^H Q - I||_F = " << orthog << "\n"
+             << "  ||tril(R,-1)||_F = " << frobLower << "\n"
+             << "  too few rows throws = " << ( threw ? "yes" : "NO" )
+             << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","height of process grid",0);
+        const int n = Input("--width","width of matrix",20);
+        int m = Input("--height","height of matrix (0 for 3/2 p n + 1)",0);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+
+        // By default, leave the processes with different numbers of rows
+        if( m == 0 )
+            m = (3*commSize*n)/2 + 1;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestTSQR<double>( m, n, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestTSQR<Complex<double> >( m, n, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}